@@ -0,0 +1,161 @@
+// ZelHash OpenCL Miner
+// Benchmark of the Stratum Message Parsers
+
+#include "../stratumJson.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+using namespace std;
+using namespace zelMiner;
+namespace pt = boost::property_tree;
+
+// Every heap allocation of the process goes through here
+static atomic<uint64_t> allocations(0);
+
+// All forms allocate with malloc and free with free, so every new matches every delete
+static void* countedAlloc(size_t size) {
+	allocations.fetch_add(1, memory_order_relaxed);
+	void* p = malloc(size ? size : 1);
+	if (p == NULL) throw bad_alloc();
+	return p;
+}
+
+static void countedFree(void* p) noexcept { free(p); }
+
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+
+void operator delete(void* p) noexcept { countedFree(p); }
+void operator delete(void* p, size_t) noexcept { countedFree(p); }
+void operator delete[](void* p) noexcept { countedFree(p); }
+void operator delete[](void* p, size_t) noexcept { countedFree(p); }
+
+
+static const char* sampleLines[] = {
+	"{\"id\":null,\"method\":\"mining.notify\",\"params\":[\"1a2b\",\"04000000\","
+		"\"a1b2c3d4e5f60718293a4b5c6d7e8f90a1b2c3d4e5f60718293a4b5c6d7e8f90\","
+		"\"0f1e2d3c4b5a69788796a5b4c3d2e1f00f1e2d3c4b5a69788796a5b4c3d2e1f0\","
+		"\"00112233445566778899aabbccddeeff00112233445566778899aabbccddeeff\","
+		"\"5d8b2a1c\",\"1c0ffff0\",true,\"ZelProof\"]}\n",
+	"{\"id\":null,\"method\":\"mining.set_target\",\"params\":[\"0007ffff00000000000000000000000000000000000000000000000000000000\"]}\n",
+	"{\"id\":4,\"result\":true,\"error\":null}\n"
+};
+static const uint32_t messageCount = sizeof(sampleLines) / sizeof(sampleLines[0]);
+
+
+// The parse of the previous read path: line copy, stream, case insensitive tree
+template <typename T = std::string> 
+T element_at(pt::iptree const& tree, std::string name, size_t n) {
+	auto r = tree.get_child(name).equal_range("");
+	for (; r.first != r.second && n; --n) ++r.first;
+	if (n || r.first==r.second) throw std::range_error("index out of bounds");
+	return r.first->second.get_value<T>();
+}
+
+vector<uint8_t> parseHex (string input) {
+	vector<uint8_t> result ;
+	result.reserve(input.length() / 2);
+	for (uint32_t i = 0; i < input.length(); i += 2){
+		uint32_t byte;
+		std::istringstream hex_byte(input.substr(i, 2));
+		hex_byte >> std::hex >> byte;
+		result.push_back(static_cast<unsigned char>(byte));
+	}
+	return result;
+}
+
+static uint64_t parseTree(const char* line) {
+	std::istringstream is(line);
+	std::string response;
+	getline(is, response);
+
+	pt::iptree jsonTree;
+	istringstream jsonStream(response);
+	pt::read_json(jsonStream,jsonTree);
+
+	uint64_t check = jsonTree.get<int>("id", -1);
+	string method = jsonTree.get<string>("method", "null");
+
+	if (method.compare("mining.set_target") == 0) {
+		check += parseHex(element_at<string>(jsonTree, "params", 0)).size();
+	}
+
+	if (method.compare("mining.notify") == 0) {
+		std::stringstream ssHeader;
+		ssHeader << element_at<string>(jsonTree, "params", 1) << element_at<string>(jsonTree, "params", 2) << element_at<string>(jsonTree, "params", 3)
+			 << element_at<string>(jsonTree, "params", 4) << element_at<string>(jsonTree, "params", 5) << element_at<string>(jsonTree, "params", 6);
+		check += parseHex(ssHeader.str()).size();
+		check += element_at<bool>(jsonTree, "params", 7);
+	}
+
+	if (jsonTree.count("result") > 0) check += jsonTree.get<bool>("result", false);
+	return check;
+}
+
+
+// The current read path, the header vector stands in for the job snapshot
+static uint64_t parseStream(const char* line, vector<uint8_t> &header) {
+	string_view response(line);
+	while ((response.size() > 0) && ((response.back() == '\n') || (response.back() == '\r'))) response.remove_suffix(1);
+
+	stratumMessage msg;
+	if (!msg.parse(response)) return 0;
+
+	uint64_t check = msg.id;
+
+	if (msg.method.compare("mining.set_target") == 0) {
+		header.clear();
+		appendHex(msg.param(0).text, header);
+		check += header.size();
+	}
+
+	if (msg.method.compare("mining.notify") == 0) {
+		header.clear();
+		for (uint32_t i=1; i<7; i++) appendHex(msg.param(i).text, header);
+		check += header.size();
+		check += msg.param(7).isTrue();
+	}
+
+	if (msg.result.type != jsonMissing) check += msg.result.isTrue();
+	return check;
+}
+
+
+template<typename F> static void run(const char* name, uint32_t iterations, F parse) {
+	uint64_t check = 0;
+	uint64_t allocStart = allocations.load();
+	auto start = chrono::steady_clock::now();
+
+	for (uint32_t i=0; i<iterations; i++) {
+		check += parse(sampleLines[i % messageCount]);
+	}
+
+	double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+	double allocs = (double) (allocations.load() - allocStart) / iterations;
+
+	cout << name << ": " << ns / iterations << " ns/message, " << allocs << " allocations/message (check " << check << ")" << endl;
+}
+
+
+int main(int argc, char* argv[]) {
+	uint32_t iterations = (argc > 1) ? atoi(argv[1]) : 300000;
+
+	vector<uint8_t> header;
+	header.reserve(256);
+
+	cout << "Parsing " << iterations << " stratum messages (notify, set_target, submit reply)" << endl;
+	run("property tree", iterations, [](const char* line) { return parseTree(line); });
+	run("stream parser", iterations, [&header](const char* line) { return parseStream(line, header); });
+
+	return 0;
+}
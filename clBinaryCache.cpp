@@ -0,0 +1,107 @@
+// ZelHash OpenCL Miner
+// On Disk Cache for Compiled OpenCL Program Binaries
+
+#include "clBinaryCache.h"
+#include "crypto/sha256.c"
+
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+#include <direct.h>
+#define makeDir(path) _mkdir(path)
+#else
+#include <sys/stat.h>
+#define makeDir(path) mkdir(path, 0755)
+#endif
+
+namespace zelMiner {
+
+// Each file starts with the key it was written for and the binary size, a file that
+// does not match them (e.g. from a crashed write) is ignored and rebuilt.
+static const size_t headerSize = 64 + sizeof(uint64_t);
+
+
+string clBinaryCache::key(const string &source, const string &options, cl::Device &device) {
+	string name, driver;
+	device.getInfo(CL_DEVICE_NAME, &name);
+	device.getInfo(CL_DRIVER_VERSION, &driver);
+
+	// Separate the parts, so moving text between them changes the key
+	string keyData = source + '\0' + options + '\0' + name + '\0' + driver;
+
+	uint8_t digest[SHA256_DIGEST_SIZE];
+	Sha256_Onestep((const uint8_t*) keyData.data(), keyData.size(), digest);
+
+	stringstream ss;
+	for (uint32_t i=0; i<SHA256_DIGEST_SIZE; i++) ss << hex << setfill('0') << setw(2) << (uint32_t) digest[i];
+	return ss.str();
+}
+
+
+string clBinaryCache::fileName(const string &key) {
+	return directory + "/" + key + ".bin";
+}
+
+
+bool clBinaryCache::load(const string &key, vector<unsigned char> &binary) {
+	if (loaded.count(key) > 0) {
+		binary = loaded[key];
+		return true;
+	}
+
+	ifstream file(fileName(key), ios::binary);
+	if (!file.good()) return false;
+
+	char header[headerSize];
+	if (!file.read(header, headerSize)) return false;
+	if (string(header, 64).compare(key) != 0) return false;
+
+	uint64_t size;
+	memcpy(&size, &header[64], sizeof(uint64_t));
+	if ((size == 0) || (size > (1ULL << 30))) return false;
+
+	binary.resize(size);
+	if (!file.read((char*) binary.data(), size)) return false;
+	if (file.peek() != EOF) return false;
+
+	loaded[key] = binary;
+	return true;
+}
+
+
+// Writes to a temporary file first, so other miners never read a half written binary
+void clBinaryCache::store(const string &key, const vector<unsigned char> &binary) {
+	loaded[key] = binary;
+
+	makeDir(directory.c_str());
+
+	string target = fileName(key);
+	string temp = target + ".tmp";
+
+	ofstream file(temp, ios::binary | ios::trunc);
+	if (!file.good()) {
+		cout << "   Could not write kernel cache " << target << endl;
+		return;
+	}
+
+	uint64_t size = binary.size();
+	file.write(key.data(), 64);
+	file.write((const char*) &size, sizeof(uint64_t));
+	file.write((const char*) binary.data(), binary.size());
+	file.close();
+
+	if (file.fail()) {
+		remove(temp.c_str());
+		return;
+	}
+
+	remove(target.c_str());				// rename does not replace on Windows
+	if (rename(temp.c_str(), target.c_str()) != 0) remove(temp.c_str());
+}
+
+}
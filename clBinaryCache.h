@@ -0,0 +1,38 @@
+// ZelHash OpenCL Miner
+// On Disk Cache for Compiled OpenCL Program Binaries
+// Copyright 2019 Wilke Trei
+
+#ifndef zelMinerBinaryCache_H
+#define zelMinerBinaryCache_H
+
+#include <CL/cl.hpp>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+
+using namespace std;
+
+namespace zelMiner {
+
+// Binaries are stored in one file per key. The key is a SHA-256 over kernel source,
+// build options, device name and driver version, so any change of them misses the cache.
+class clBinaryCache {
+	private:
+	string directory = "zelMiner-kernels";
+
+	// Binaries loaded or built in this run, identical devices only compile once
+	map<string, vector<unsigned char> > loaded;
+
+	string fileName(const string &);
+
+	public:
+	string key(const string &, const string &, cl::Device &);
+
+	bool load(const string &, vector<unsigned char> &);
+	void store(const string &, const vector<unsigned char> &);
+};
+
+}
+
+#endif
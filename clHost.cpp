@@ -2,10 +2,15 @@
 // OpenCL Host Interface
 
 #include "clHost.h"
+#include "metricsServer.h"
 #include "./kernels/equihash_125_4_inc.h"
 
 namespace zelMiner {
 
+// Loss counters of the LOSS_STATS kernel build, must match lossBase and lossCount in the kernel
+static const uint32_t lossBase = 262160;
+static const uint32_t lossCount = 11;
+
 // Helper functions to split a string
 inline vector<string> &split(const string &s, char delim, vector<string> &elems) {
     stringstream ss(s);
@@ -44,11 +49,14 @@ void CL_CALLBACK CCallbackFunc(cl_event ev, cl_int err , void* data) {
 	self->callbackFunc(err,data);
 }
 
+void CL_CALLBACK CSwitchCallbackFunc(cl_event ev, cl_int err , void* data) {
+	clHost* self = static_cast<clHost*>(((clSwitchProbe*) data)->host);
+	self->switchCallbackFunc(data);
+}
 
-// Function to load the OpenCL kernel and prepare our device for mining
-void clHost::loadAndCompileKernel(cl::Device &device, uint32_t pl, bool use3G) {
-	cout << "   Loading and compiling ZelHash OpenCL Kernel" << endl;
 
+// Builds the kernel source for one device with the given compiler options
+bool clHost::buildProgram(cl::Device &device, uint32_t pl, string options, cl::Program &program) {
 	// reading the kernel
 	string progStr = string((const char*) __equihash_125_4_cl, __equihash_125_4_cl_len); 
 
@@ -56,65 +64,472 @@ void clHost::loadAndCompileKernel(cl::Device &device, uint32_t pl, bool use3G) {
 	string progStr(istreambuf_iterator<char>(file),(istreambuf_iterator<char>())); */
 	cl::Program::Sources source(1,std::make_pair(progStr.c_str(), progStr.length()+1));
 
-	// Create a program object and build it
 	vector<cl::Device> devicesTMP;
 	devicesTMP.push_back(device);
 
-	cl::Program program(contexts[pl], source);
 	cl_int err;
-	if (!use3G) {
-		err = program.build(devicesTMP,"");
-	} else {
-		err = program.build(devicesTMP,"-DMEM3G");
+
+	// Try the binary cache first
+	string cacheKey = binaryCache.key(progStr, options, device);
+	vector<unsigned char> binary;
+
+	if (binaryCache.load(cacheKey, binary)) {
+		cl::Program::Binaries binaries(1, std::make_pair((const void*) binary.data(), binary.size()));
+		vector<int32_t> binaryStatus;
+
+		program = cl::Program(contexts[pl], devicesTMP, binaries, &binaryStatus, &err);
+		if ((err == CL_SUCCESS) && (binaryStatus[0] == CL_SUCCESS)) {
+			err = program.build(devicesTMP, options.c_str());
+			if (err == CL_SUCCESS) {
+				cout << "   Loaded cached kernel binary " << cacheKey.substr(0,16) << endl;
+				return true;
+			}
+		}
+
+		cout << "   Cached kernel binary is not usable, compiling from source" << endl;
+	}
+
+	// Create a program object and build it
+	program = cl::Program(contexts[pl], source);
+	err = program.build(devicesTMP, options.c_str());
+
+	if (err) {
+		cout << "   Program build error, device will not be used. " << endl;
+		// Print error msg so we can debug the kernel source
+		cout << "   Build Log: "     << program.getBuildInfo<CL_PROGRAM_BUILD_LOG>(devicesTMP[0]) << endl;
+		return false;
+	}
+
+	// Store the binary for the next start and other devices of the same model
+	vector<size_t> sizes = program.getInfo<CL_PROGRAM_BINARY_SIZES>();
+	vector<char*> programBinaries = program.getInfo<CL_PROGRAM_BINARIES>();
+
+	if ((sizes.size() == 1) && (sizes[0] > 0) && (programBinaries[0] != NULL)) {
+		binary.assign(programBinaries[0], programBinaries[0] + sizes[0]);
+		binaryCache.store(cacheKey, binary);
+	}
+	for (uint32_t i=0; i<programBinaries.size(); i++) delete[] programBinaries[i];
+
+	return true;
+}
+
+
+vector<cl::Kernel> clHost::createKernels(cl::Program &program) {
+	cl_int err;
+	vector<cl::Kernel> newKernels;	
+	newKernels.push_back(cl::Kernel(program, "clearCounter", &err));
+	newKernels.push_back(cl::Kernel(program, "round0", &err));
+	newKernels.push_back(cl::Kernel(program, "round1", &err));
+	newKernels.push_back(cl::Kernel(program, "round2", &err));
+	newKernels.push_back(cl::Kernel(program, "round3", &err));
+	newKernels.push_back(cl::Kernel(program, "round4", &err));
+	newKernels.push_back(cl::Kernel(program, "combine", &err));
+	return newKernels;
+}
+
+
+// Memory footprint of a kernel variant on a device, including the buffers of all pipeline slots
+memoryPlan clHost::planMemory(cl::Device &device, bool use3G, const kernelConfig &config) {
+	uint64_t align = device.getInfo<CL_DEVICE_MEM_BASE_ADDR_ALIGN>() / 8;
+	uint64_t maxAlloc = device.getInfo<CL_DEVICE_MAX_MEM_ALLOC_SIZE>();
+	uint64_t slotBytes = pipelineDepth * (sizeof(cl_uint) * 324 + sizeof(iterationParams)) + sizeof(cl_uint);
+
+	return memoryPlan(config, use3G, hostIndexes, slotBytes, align, maxAlloc);
+}
+
+
+// Creates the element, index, counter and result buffers for a kernel configuration.
+// The working buffers are sub-buffers of the allocations of the memory plan.
+bool clHost::createBuffers(uint32_t pl, cl::Device &device, bool use3G, const kernelConfig &config, vector<cl::Buffer> &newBuffers) {
+	cl_int err;
+	memoryPlan plan = planMemory(device, use3G, config);
+
+	newBuffers.clear();
+
+	vector<cl::Buffer> allocations;
+	for (uint32_t i=0; i<plan.allocations.size(); i++) {
+		allocations.push_back(cl::Buffer(contexts[pl], CL_MEM_READ_WRITE, plan.allocations[i], NULL, &err));
+		if (err != CL_SUCCESS) {
+			cout << "   Could not allocate " << plan.allocations[i] / (1024*1024) << " MByte of device memory (error " << err << ")" << endl;
+			return false;
+		}
+	}
+
+	for (uint32_t i=0; i<plan.regions.size(); i++) {
+		const memoryRegion &region = plan.regions[i];
+
+		if (region.aliasOf >= 0) {
+			newBuffers.push_back(newBuffers[region.aliasOf]);
+			continue;
+		}
+
+		if (region.host) {
+			newBuffers.push_back(cl::Buffer(contexts[pl], CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, region.size, NULL, &err));
+			if (err != CL_SUCCESS) {
+				cout << "   Could not allocate the " << region.name << " buffer in host memory (error " << err << ")" << endl;
+				return false;
+			}
+			continue;
+		}
+
+		// A buffer that fills a whole allocation needs no sub-buffer
+		if ((region.offset == 0) && (region.size == plan.allocations[region.allocation])) {
+			newBuffers.push_back(allocations[region.allocation]);
+			continue;
+		}
+
+		cl_buffer_region info = {region.offset, region.size};
+		newBuffers.push_back(allocations[region.allocation].createSubBuffer(CL_MEM_READ_WRITE, CL_BUFFER_CREATE_TYPE_REGION, &info, &err));
+		if (err != CL_SUCCESS) {
+			cout << "   Could not create the " << region.name << " buffer (error " << err << ")" << endl;
+			return false;
+		}
+	}
+
+	// One result buffer per pipeline slot
+	for (uint32_t i=0; i<pipelineDepth; i++) {
+		newBuffers.push_back(cl::Buffer(contexts[pl], CL_MEM_READ_WRITE,  sizeof(cl_uint) * 324, NULL, &err));  
+		if (err != CL_SUCCESS) return false;
+	}
+
+	// One parameter buffer per pipeline slot
+	for (uint32_t i=0; i<pipelineDepth; i++) {
+		newBuffers.push_back(cl::Buffer(contexts[pl], CL_MEM_READ_ONLY,  sizeof(iterationParams), NULL, &err));  
+		if (err != CL_SUCCESS) return false;
+	}
+
+	return true;
+}
+
+
+// Binds the buffers of a device to the kernels of all its pipeline slots. Only needs
+// to run again when kernels or buffers are recreated, launches do not set any argument.
+void clHost::bindKernelArgs(uint32_t gpuIndex) {
+	vector<cl::Buffer> &buf = buffers[gpuIndex];
+
+	for (uint32_t slot=0; slot<pipelineDepth; slot++) {
+		vector<cl::Kernel> &kern = kernels[gpuIndex*pipelineDepth + slot];
+
+		// Kernel arguments for cleanCounter
+		kern[0].setArg(0, buf[5]); 
+		kern[0].setArg(1, buf[6+slot]);
+
+		// Kernel arguments for round0
+		kern[1].setArg(0, buf[0]); 
+		kern[1].setArg(1, buf[3]); 
+		kern[1].setArg(2, buf[5]); 
+		kern[1].setArg(3, buf[6+pipelineDepth+slot]); 	// Work, nonce and epoch are uploaded here
+
+		// Kernel arguments for round1
+		kern[2].setArg(0, buf[0]); 
+		kern[2].setArg(1, buf[1]);	// Index tree will be stored here 
+		kern[2].setArg(2, buf[5]); 
+
+		// Kernel arguments for round2
+		kern[3].setArg(0, buf[1]); 
+		kern[3].setArg(1, buf[0]); 	// Index tree will be stored here 
+		kern[3].setArg(2, buf[5]); 
+
+		// Kernel arguments for round3
+		kern[4].setArg(0, buf[0]); 
+		kern[4].setArg(1, buf[2]); 	// Index tree will be stored here 
+		kern[4].setArg(2, buf[5]);  
+
+		// Kernel arguments for round4
+		kern[5].setArg(0, buf[2]); 
+		kern[5].setArg(1, buf[4]); 	// Index tree will be stored here 
+		kern[5].setArg(2, buf[5]);  
+
+		// Round 0 - 4 stop early when the job of their iteration went stale
+		for (uint32_t k=1; k<6; k++) {
+			kern[k].setArg(3, buf[6+pipelineDepth+slot]);
+			kern[k].setArg(4, epochBuffers[gpuIndex]);
+		}
+
+		// Kernel arguments for Combine
+		kern[6].setArg(0, buf[0]); 
+		kern[6].setArg(1, buf[1]); 	
+		kern[6].setArg(2, buf[2]); 
+		kern[6].setArg(3, buf[3]); 	
+		kern[6].setArg(4, buf[4]); 
+		kern[6].setArg(5, buf[5]); 	
+		kern[6].setArg(6, buf[6+slot]);
+	}
+}
+
+
+// Compiler options of a kernel configuration plus the options set for all devices
+string clHost::kernelOptions(const kernelConfig &config, bool use3G) {
+	string options = config.buildOptions(use3G);
+	if (lossStats) options += " -DLOSS_STATS";
+	return options;
+}
+
+
+// Builds a kernel configuration and replaces kernels and buffers of a device with it
+bool clHost::installConfig(uint32_t gpuIndex, uint32_t pl, bool use3G, const kernelConfig &config) {
+	cl::Program program;
+	if (!buildProgram(devices[gpuIndex], pl, kernelOptions(config, use3G), program)) return false;
+
+	for (uint32_t slot=0; slot<pipelineDepth; slot++) {
+		kernels[gpuIndex*pipelineDepth + slot] = createKernels(program);
 	}
 
+	// The buffers only need to be reallocated if their size changes
+	if ((buffers[gpuIndex].size() == 0) || (config.subBucketSize != configs[gpuIndex].subBucketSize)) {
+		buffers[gpuIndex].clear();
+		if (!createBuffers(pl, devices[gpuIndex], use3G, config, buffers[gpuIndex])) {
+			buffers[gpuIndex].clear();
+			return false;
+		}
+	}
+
+	bindKernelArgs(gpuIndex);
+
+	configs[gpuIndex] = config;
+	return true;
+}
+
+
+// Runs iterations on synthetic work with a kernel configuration and measures the
+// solution rate. All configurations see the same work, so yields are comparable.
+bool clHost::measureConfig(uint32_t gpuIndex, uint32_t pl, bool use3G, const kernelConfig &config, uint32_t iterations, tuningResult &result) {
+	if (!installConfig(gpuIndex, pl, use3G, config)) return false;
+
+	cl_ulong8 work;
+	for (uint32_t i=0; i<8; i++) work.s[i] = 0x0123456789ABCDEFULL * (i+1);
+
+	vector<uint32_t> solutions(iterations, 0);
+
+	// Tuning runs before the first job arrives, so the epoch is still 0
+	// First iteration is a warm up
+	enqueueIteration(gpuIndex, 0, work, 0, 0);
+	if (queues[gpuIndex].finish() != CL_SUCCESS) return false;
+
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t i=0; i<iterations; i++) {
+		enqueueIteration(gpuIndex, 0, work, i+1, 0);
+		queues[gpuIndex].enqueueReadBuffer(buffers[gpuIndex][6], CL_FALSE, 0, sizeof(cl_uint), &solutions[i]);
+	}
+	if (queues[gpuIndex].finish() != CL_SUCCESS) return false;
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	uint32_t total = 0;
+	for (uint32_t i=0; i<iterations; i++) total += min<uint32_t>(solutions[i], 20);	// The result buffer holds 20
+
+	result.msPerIteration = 1000.0 * seconds / iterations;
+	result.solPerIteration = (double) total / iterations;
+	result.solPerSec = (double) total / seconds;
+	return true;
+}
+
+
+// Measures all candidates and installs the one with the highest solution rate on the device
+kernelConfig clHost::selectConfig(uint32_t gpuIndex, uint32_t pl, bool use3G, vector<kernelConfig> candidates, uint32_t iterations, tuningResult &best) {
+	kernelConfig loaded = configs[gpuIndex];		// The default the device was loaded with
+	kernelConfig bestConfig = loaded;
+	bool found = false;
+
+	for (uint32_t i=0; i<candidates.size(); i++) {
+		tuningResult result;
+		if (!measureConfig(gpuIndex, pl, use3G, candidates[i], iterations, result)) {
+			cout << "      " << candidates[i].describe() << ": failed" << endl;
+			continue;
+		}
+
+		cout << "      " << candidates[i].describe() << ": " << fixed << setprecision(2) << result.msPerIteration << " ms, " 
+		     << result.solPerIteration << " sol/iteration, " << result.solPerSec << " sol/s" << endl;
+
+		// Prefer the solution rate, the time decides if no solutions were found
+		bool better = !found || (result.solPerSec > best.solPerSec);
+		better = better || ((result.solPerSec == best.solPerSec) && (result.msPerIteration < best.msPerIteration));
+
+		if (better) {
+			found = true;
+			best = result;
+			bestConfig = candidates[i];
+		}
+	}
+
+	if (!installConfig(gpuIndex, pl, use3G, bestConfig)) {
+		cout << "   Could not install kernel " << bestConfig.describe() << ", going back to the default" << endl;
+		bestConfig = loaded;
+		found = false;
+
+		// The default worked before, without it the device has neither kernels nor buffers
+		if (!installConfig(gpuIndex, pl, use3G, bestConfig)) {
+			cout << "   Could not restore the default kernel. Closing zelMiner." << endl;
+			exit(1);
+		}
+	}
+
+	// The default is not measured, a zero result keeps it out of the tuning database
+	if (!found) best = tuningResult();
+
+	cout << "   Using kernel: " << bestConfig.describe() << endl;
+	return bestConfig;
+}
+
+
+// Sweeps the tunable kernel parameters on a device and stores the winner in the tuning database
+void clHost::autotuneDevice(uint32_t gpuIndex, uint32_t pl, bool use3G, string key) {
+	cout << "   Tuning kernel parameters, this will take a while" << endl;
+
+	uint64_t deviceMemory = devices[gpuIndex].getInfo<CL_DEVICE_GLOBAL_MEM_SIZE>();
+	uint64_t maxAlloc = devices[gpuIndex].getInfo<CL_DEVICE_MAX_MEM_ALLOC_SIZE>();
+
+	const uint32_t subBucketSizes[4] = {1088, 1120, 1152, 1216};
+	const uint32_t chainCaps[3] = {32, 40, 64};
+
+	vector<kernelConfig> candidates;
+	for (uint32_t i=0; i<4; i++) {
+		kernelConfig config;
+		config.subBucketSize = subBucketSizes[i];
+
+		// Skip sizes that do not fit the device, the default size is always tried
+		uint64_t elements = config.bufferElements();
+		uint64_t needed = planMemory(devices[gpuIndex], use3G, config).total();
+		bool fits = (needed < deviceMemory) && (elements * sizeof(cl_uint4) <= maxAlloc);
+		if (!fits && (config.subBucketSize != kernelConfig().subBucketSize)) continue;
+
+		for (uint32_t j=0; j<3; j++) {
+			config.collision = collisionList;
+			config.chainCap = chainCaps[j];
+			candidates.push_back(config);
+		}
+
+		config.collision = collisionSort;
+		config.chainCap = kernelConfig().chainCap;
+		candidates.push_back(config);
+	}
+
+	tuningResult best;
+	kernelConfig config = selectConfig(gpuIndex, pl, use3G, candidates, 12, best);
+
+	if (best.msPerIteration > 0) {
+		tuning.store(key, config, best.solPerSec, best.solPerIteration);
+		tuning.save();
+	}
+}
+
+
+// Identifies a device and kernel variant in the tuning database, the 3G kernel is tuned on its own
+string clHost::deviceKey(cl::Device &device, bool use3G) {
+	string name, driver;
+	device.getInfo(CL_DEVICE_NAME, &name); 
+	device.getInfo(CL_DRIVER_VERSION, &driver); 
+
+	// Get rid of strange characters at the end of the strings
+	while ((name.size() > 0) && (isalnum((int) name.back()) == 0)) name.pop_back();
+	while ((driver.size() > 0) && (isgraph((int) driver.back()) == 0)) driver.pop_back();
+
+	return name + " / " + driver + (use3G ? " / 3G" : "");
+}
+
+
+// Kernel configuration a device starts with: the tuned one from the database if it fits into
+// the given device memory, otherwise the default
+kernelConfig clHost::startConfig(cl::Device &device, bool use3G, uint64_t deviceMemory, bool &tuned) {
+	kernelConfig config;
+	if (collision == collisionSort) config.collision = collisionSort;
+
+	tuned = false;
+	if (autotune) return config;
+
+	kernelConfig tunedConfig;
+	if (!tuning.lookup(deviceKey(device, use3G), tunedConfig)) return config;
+
+	if (planMemory(device, use3G, tunedConfig).total() >= deviceMemory) {
+		cout << "   Tuned kernel " << tunedConfig.describe() << " does not fit into the device memory" << endl;
+		return config;
+	}
+
+	tuned = true;
+	return tunedConfig;
+}
+
+
+// Function to load the OpenCL kernel and prepare our device for mining
+// The configuration is the one the memory check was done with, see startConfig.
+void clHost::loadAndCompileKernel(cl::Device &device, uint32_t pl, bool use3G, kernelConfig config, bool tuned) {
+	cout << "   Loading and compiling ZelHash OpenCL Kernel" << endl;
+
+	string key = deviceKey(device, use3G);
+	if (tuned) cout << "   Found tuned kernel: " << config.describe() << endl;
+
+	cl::Program program;
+
 	// Check if the build was Ok
-	if (!err) {
+	if (buildProgram(device, pl, kernelOptions(config, use3G), program)) {
 		cout << "   Build sucessfull. " << endl;
 
+		// Allocate the buffers first, a device that can not hold them is not used at all
+		planMemory(device, use3G, config).print();
+
+		vector<cl::Buffer> newBuffers;	
+		if (!createBuffers(pl, device, use3G, config, newBuffers)) {
+			cout << "   Buffer allocation failed, device will not be used" << endl;
+			return;
+		}
+
 		// Store the device and create a queue for it
 		cl_command_queue_properties queue_prop = 0;  
+		if (profile) queue_prop |= CL_QUEUE_PROFILING_ENABLE;
 		devices.push_back(device);
 		queues.push_back(cl::CommandQueue(contexts[pl], devices[devices.size()-1], queue_prop, NULL)); 
-
-		// Reserve events, space for storing results and so on
-		events.push_back(cl::Event());
-		results.push_back(NULL);
-		currentWork.push_back(clCallbackData());
-		paused.push_back(true);
+		abortQueues.push_back(cl::CommandQueue(contexts[pl], devices[devices.size()-1], 0, NULL)); 
+
+		// No clean job has been seen yet, the epoch starts at 0
+		epochBuffers.push_back(cl::Buffer(contexts[pl], CL_MEM_READ_WRITE, sizeof(cl_uint), NULL, NULL));
+		queues.back().enqueueFillBuffer(epochBuffers.back(), (cl_uint) 0, 0, sizeof(cl_uint));
+		queues.back().finish();
+
+		startedEpoch.push_back(0);
+		switchLatencySum.push_back(0);
+		switchLatencyMax.push_back(0);
+		switchCount.push_back(0);
+
+		// Reserve events, space for storing results and so on for each pipeline slot
+		for (uint32_t i=0; i<pipelineDepth; i++) {
+			events.push_back(cl::Event());
+			results.push_back(NULL);
+			currentWork.push_back(clCallbackData());
+			switchEvents.push_back(cl::Event());
+			switchProbes.push_back(clSwitchProbe());
+			kernelEvents.push_back(vector<cl::Event>(7));
+			for (uint32_t j=0; j<lossCount; j++) lossRead.push_back(0);
+			paused.push_back(true);
+			launchTime.push_back(std::chrono::steady_clock::now());
+		}
+		deviceMutex.push_back(unique_ptr<mutex>(new mutex()));
 		is3G.push_back(use3G);
-		solutionCnt.push_back(0);
+		counters.push_back(unique_ptr<deviceCounters>(new deviceCounters()));
+		rates.push_back(unique_ptr<rateAverage>(new rateAverage()));
+		lastDone.push_back(std::chrono::steady_clock::now());
+		lastDoneValid.push_back(false);
+		lossTotals.push_back(vector<uint64_t>(lossCount, 0));
+		lossIterations.push_back(0);
+
+		// Create the kernels and buffers
+		for (uint32_t i=0; i<pipelineDepth; i++) kernels.push_back(createKernels(program));
+		configs.push_back(config);
+		buffers.push_back(newBuffers);		
 
-		// Create the kernels
-		vector<cl::Kernel> newKernels;	
-		newKernels.push_back(cl::Kernel(program, "clearCounter", &err));
-		newKernels.push_back(cl::Kernel(program, "round0", &err));
-		newKernels.push_back(cl::Kernel(program, "round1", &err));
-		newKernels.push_back(cl::Kernel(program, "round2", &err));
-		newKernels.push_back(cl::Kernel(program, "round3", &err));
-		newKernels.push_back(cl::Kernel(program, "round4", &err));
-		newKernels.push_back(cl::Kernel(program, "combine", &err));
+		uint32_t gpu = devices.size()-1;
+		bindKernelArgs(gpu);
 
-		kernels.push_back(newKernels);
+		if (autotune) {
+			autotuneDevice(gpu, pl, use3G, key);
+		} else if (!tuned && (collision == collisionAuto)) {
+			cout << "   Timing the collision search strategies" << endl;
 
-		// Create the buffers
-		vector<cl::Buffer> newBuffers;	
-		
-		newBuffers.push_back(cl::Buffer(contexts[pl], CL_MEM_READ_WRITE,  sizeof(cl_uint4) * 71303168, NULL, &err));
-		newBuffers.push_back(cl::Buffer(contexts[pl], CL_MEM_READ_WRITE,  sizeof(cl_uint4) * 71303168, NULL, &err)); 
-		newBuffers.push_back(cl::Buffer(contexts[pl], CL_MEM_READ_WRITE,  sizeof(cl_uint4) * 71303168, NULL, &err)); 
+			vector<kernelConfig> candidates(2, config);
+			candidates[1].collision = collisionSort;
 
-		newBuffers.push_back(cl::Buffer(contexts[pl], CL_MEM_READ_WRITE,  sizeof(cl_uint) * 71303168, NULL, &err)); 
-	
-		newBuffers.push_back(cl::Buffer(contexts[pl], CL_MEM_READ_WRITE,  sizeof(cl_uint4) * 256, NULL, &err));   
-		newBuffers.push_back(cl::Buffer(contexts[pl], CL_MEM_READ_WRITE,  sizeof(cl_uint) * 49152, NULL, &err));  
-		newBuffers.push_back(cl::Buffer(contexts[pl], CL_MEM_READ_WRITE,  sizeof(cl_uint) * 324, NULL, &err));  
-		buffers.push_back(newBuffers);		
-			
-	} else {
-		cout << "   Program build error, device will not be used. " << endl;
-		// Print error msg so we can debug the kernel source
-		cout << "   Build Log: "     << program.getBuildInfo<CL_PROGRAM_BUILD_LOG>(devicesTMP[0]) << endl;
+			tuningResult best;
+			selectConfig(gpu, pl, use3G, candidates, 4, best);
+		}
 	}
 }
 
@@ -175,8 +590,6 @@ void clHost::detectPlatFormDevices(vector<int32_t> selDev, bool allowCPU, bool f
 			if (pick) {
 				// Check if the CPU / GPU has enough memory
 				uint64_t deviceMemory = nDev[di].getInfo<CL_DEVICE_GLOBAL_MEM_SIZE>();
-				uint64_t needed_4G = 7* ((uint64_t) 570425344) + 4096 + 196608 + 1296; // <-need redone
-
 				cout << "   Device reports " << deviceMemory / (1024*1024) << "MByte total memory" << endl;
 
 				if ( hasExtension(nDev[di], "cl_amd_device_attribute_query") ) {
@@ -186,13 +599,23 @@ void clHost::detectPlatFormDevices(vector<int32_t> selDev, bool allowCPU, bool f
 					cout << "   Device reports " << freeDeviceMemory / (1024*1024) << "MByte free memory (AMD)" << endl;
 					deviceMemory = min<uint64_t>(deviceMemory, freeDeviceMemory);
 				}
+
+				// The check is done for the configurations that will be installed
+				bool tuned_4G, tuned_3G;
+				kernelConfig config_4G = startConfig(nDev[di], false, deviceMemory, tuned_4G);
+				kernelConfig config_3G = startConfig(nDev[di], true, deviceMemory, tuned_3G);
+				uint64_t needed_4G = planMemory(nDev[di], false, config_4G).total();
+				uint64_t needed_3G = planMemory(nDev[di], true, config_3G).total();
 				
 
-				if (deviceMemory > needed_4G) {
+				if ((deviceMemory > needed_4G) && !force3G) {
 					cout << "   Memory check for 4G kernel passed" << endl;
-					loadAndCompileKernel(nDev[di], pl, false);
+					loadAndCompileKernel(nDev[di], pl, false, config_4G, tuned_4G);
+				} else if (deviceMemory > needed_3G) {
+					cout << "   Memory check for 3G kernel passed" << endl;
+					loadAndCompileKernel(nDev[di], pl, true, config_3G, tuned_3G);
 				} else {
-					cout << "   Memory check failed, required minimum memory: " << needed_4G/(1024*1024) << endl;
+					cout << "   Memory check failed, required minimum memory: " << needed_3G/(1024*1024) << endl;
 				}
 			} else {
 				cout << "   Device will not be used, it was not included in --devices parameter." << endl;
@@ -201,18 +624,25 @@ void clHost::detectPlatFormDevices(vector<int32_t> selDev, bool allowCPU, bool f
 			curDiv++; 
 		}
 	}
-
-	if (devices.size() == 0) {
-		cout << "No compatible OpenCL devices found or all are deselected. Closing zelMiner." << endl;
-		exit(0);
-	}
 }
 
 
-// Setup function called from outside
-void clHost::setup(zelStratum* stratumIn, vector<int32_t> devSel,  bool allowCPU, bool force3G) {
+// Setup function called from outside, returns false if no device can be used
+bool clHost::setup(zelStratum* stratumIn, vector<int32_t> devSel,  bool allowCPU, bool force3G, bool hostIndexesIn, collisionMode collisionIn, bool autotuneIn, bool profileIn, bool lossStatsIn) {
 	stratum = stratumIn;
+	hostIndexes = hostIndexesIn;
+	collision = collisionIn;
+	autotune = autotuneIn;
+	profile = profileIn;
+	lossStats = lossStatsIn;
+
+	tuning.load("zelMiner-tuning.json");
+	validators.start(stratum, 2);
 	detectPlatFormDevices(devSel, allowCPU, force3G);
+	profiler.setup(devices.size());
+
+	stratum->setCleanJobHandler([this](uint32_t epoch) { abortStaleWork(epoch); });
+	return (devices.size() > 0);
 }
 
 
@@ -225,142 +655,538 @@ void clHost::queueKernels(uint32_t gpuIndex, clCallbackData* workData) {
 	stratum->getWork(workData->wd, (uint8_t *) &work);
 	nonce = workData->wd.nonce;
 
-	// Kernel arguments for cleanCounter
-	kernels[gpuIndex][0].setArg(0, buffers[gpuIndex][5]); 
-	kernels[gpuIndex][0].setArg(1, buffers[gpuIndex][6]);
-
-	// Kernel arguments for round0
-	kernels[gpuIndex][1].setArg(0, buffers[gpuIndex][0]); 
-	kernels[gpuIndex][1].setArg(1, buffers[gpuIndex][3]); 
-	kernels[gpuIndex][1].setArg(2, buffers[gpuIndex][5]); 
-	kernels[gpuIndex][1].setArg(3, work); 
-	kernels[gpuIndex][1].setArg(4, nonce); 
-
-	// Kernel arguments for round1
-	kernels[gpuIndex][2].setArg(0, buffers[gpuIndex][0]); 
-	kernels[gpuIndex][2].setArg(1, buffers[gpuIndex][1]);	// Index tree will be stored here 
-	kernels[gpuIndex][2].setArg(2, buffers[gpuIndex][5]); 
-
-	// Kernel arguments for round2
-	kernels[gpuIndex][3].setArg(0, buffers[gpuIndex][1]); 
-	kernels[gpuIndex][3].setArg(1, buffers[gpuIndex][0]); 	// Index tree will be stored here 
-	kernels[gpuIndex][3].setArg(2, buffers[gpuIndex][5]); 
-
-	// Kernel arguments for round3
-	kernels[gpuIndex][4].setArg(0, buffers[gpuIndex][0]); 
-	kernels[gpuIndex][4].setArg(1, buffers[gpuIndex][2]); 	// Index tree will be stored here 
-	kernels[gpuIndex][4].setArg(2, buffers[gpuIndex][5]);  
-
-	// Kernel arguments for round4
-	kernels[gpuIndex][5].setArg(0, buffers[gpuIndex][2]); 
-	kernels[gpuIndex][5].setArg(1, buffers[gpuIndex][4]); 	// Index tree will be stored here 
-	kernels[gpuIndex][5].setArg(2, buffers[gpuIndex][5]);  
-
-	// Kernel arguments for Combine
-	kernels[gpuIndex][6].setArg(0, buffers[gpuIndex][0]); 
-	kernels[gpuIndex][6].setArg(1, buffers[gpuIndex][1]); 	
-	kernels[gpuIndex][6].setArg(2, buffers[gpuIndex][2]); 
-	kernels[gpuIndex][6].setArg(3, buffers[gpuIndex][3]); 	
-	kernels[gpuIndex][6].setArg(4, buffers[gpuIndex][4]); 
-	kernels[gpuIndex][6].setArg(5, buffers[gpuIndex][5]); 	
-	kernels[gpuIndex][6].setArg(6, buffers[gpuIndex][6]);
+	// The first iteration of a clean job reports when its first kernel is done. On the in order
+	// queue that includes the wait for the stale iteration of the other slot to drain.
+	uint32_t id = gpuIndex*pipelineDepth + workData->slot;
+	cl::Event* started = NULL;
+	if (workData->wd.epoch != startedEpoch[gpuIndex]) {
+		startedEpoch[gpuIndex] = workData->wd.epoch;
+
+		switchProbes[id].host = (void*) this;
+		switchProbes[id].gpuIndex = gpuIndex;
+		switchProbes[id].epoch = workData->wd.epoch;
+		started = &switchEvents[id];
+	}
+
+	enqueueIteration(gpuIndex, workData->slot, work, nonce, workData->wd.epoch, started);
+}
+
+
+// Called from the stratum thread on a clean job. The new epoch is written through the
+// abort queues, so it reaches the kernels that are already queued or running.
+void clHost::abortStaleWork(uint32_t epoch) {
+	for (uint32_t i=0; i<devices.size(); i++) {
+		abortQueues[i].enqueueFillBuffer(epochBuffers[i], (cl_uint) epoch, 0, sizeof(cl_uint));
+		abortQueues[i].flush();
+	}
+}
+
+
+// Queues one full iteration of all kernels for the given work on the device,
+// the solutions are written to the result buffer of the pipeline slot
+// If started is given, it gets the event of the first kernel and a callback that reports the job switch.
+void clHost::enqueueIteration(uint32_t gpuIndex, uint32_t slot, cl_ulong8 &work, cl_uint nonce, cl_uint epoch, cl::Event* started) {
+	vector<cl::Kernel> &kern = kernels[gpuIndex*pipelineDepth + slot];
+
+	// Only ask for events when profiling, they are not free
+	vector<cl::Event> &ev = kernelEvents[gpuIndex*pipelineDepth + slot];
+	cl::Event* kernelEv[7];
+	for (uint32_t i=0; i<7; i++) kernelEv[i] = profile ? &ev[i] : NULL;
+	if ((started != NULL) && !profile) kernelEv[0] = started;
+
+	iterationParams params;
+	memset(&params, 0, sizeof(iterationParams));
+	params.blake_state = work;
+	params.nonce = nonce;
+	params.epoch = epoch;
+
+	// The fill pattern is copied when the command is queued, unlike the host memory
+	// of a non blocking write, so params may go out of scope right away
+	queues[gpuIndex].enqueueFillBuffer(buffers[gpuIndex][6+pipelineDepth+slot], params, 0, sizeof(iterationParams));
 
 	cl_int err;
 	// Queue the kernels
-	err = queues[gpuIndex].enqueueNDRangeKernel(kernels[gpuIndex][0], cl::NDRange(0), cl::NDRange(12288), cl::NDRange(256), NULL, NULL);
-	err = queues[gpuIndex].enqueueNDRangeKernel(kernels[gpuIndex][1], cl::NDRange(0), cl::NDRange(16777216), cl::NDRange(256), NULL, NULL);
-	err = queues[gpuIndex].enqueueNDRangeKernel(kernels[gpuIndex][2], cl::NDRange(0), cl::NDRange(16777216), cl::NDRange(256), NULL, NULL);
-	err = queues[gpuIndex].enqueueNDRangeKernel(kernels[gpuIndex][3], cl::NDRange(0), cl::NDRange(16777216), cl::NDRange(256), NULL, NULL);
+	err = queues[gpuIndex].enqueueNDRangeKernel(kern[0], cl::NDRange(0), cl::NDRange(65792), cl::NDRange(256), NULL, kernelEv[0]);
+
+	// Registered before the first flush, so the callback never runs inside this call
+	if (started != NULL) {
+		if (profile) *started = ev[0];
+		started->setCallback(CL_COMPLETE, &CSwitchCallbackFunc, (void*) &switchProbes[gpuIndex*pipelineDepth + slot]);
+	}
+
+	err = queues[gpuIndex].enqueueNDRangeKernel(kern[1], cl::NDRange(0), cl::NDRange(16777216), cl::NDRange(256), NULL, kernelEv[1]);
+	err = queues[gpuIndex].enqueueNDRangeKernel(kern[2], cl::NDRange(0), cl::NDRange(16777216), cl::NDRange(256), NULL, kernelEv[2]);
+	err = queues[gpuIndex].enqueueNDRangeKernel(kern[3], cl::NDRange(0), cl::NDRange(16777216), cl::NDRange(256), NULL, kernelEv[3]);
 	queues[gpuIndex].flush();
-	err = queues[gpuIndex].enqueueNDRangeKernel(kernels[gpuIndex][4], cl::NDRange(0), cl::NDRange(16777216), cl::NDRange(256), NULL, NULL);
-	err = queues[gpuIndex].enqueueNDRangeKernel(kernels[gpuIndex][5], cl::NDRange(0), cl::NDRange(16777216), cl::NDRange(256), NULL, NULL);
-	err = queues[gpuIndex].enqueueNDRangeKernel(kernels[gpuIndex][6], cl::NDRange(0), cl::NDRange(4096), cl::NDRange(16), NULL, NULL);	
+	err = queues[gpuIndex].enqueueNDRangeKernel(kern[4], cl::NDRange(0), cl::NDRange(16777216), cl::NDRange(256), NULL, kernelEv[4]);
+	err = queues[gpuIndex].enqueueNDRangeKernel(kern[5], cl::NDRange(0), cl::NDRange(16777216), cl::NDRange(256), NULL, kernelEv[5]);
+	err = queues[gpuIndex].enqueueNDRangeKernel(kern[6], cl::NDRange(0), cl::NDRange(4096), cl::NDRange(16), NULL, kernelEv[6]);	
 }
 
 
-// this function will submit the solutions done on GPU, then fetch new work and restart mining
+// Queues new work into a pipeline slot and registers the callback for its results.
+// Must be called with the device mutex held, the slots share the command queue.
+void clHost::launchSlot(uint32_t gpu, uint32_t slot) {
+	uint32_t id = gpu*pipelineDepth + slot;
+
+	launchTime[id] = std::chrono::steady_clock::now();
+	queueKernels(gpu, &currentWork[id]);
+
+	// The next slot clears the counters, so they are read right behind the kernels
+	if (lossStats) {
+		queues[gpu].enqueueReadBuffer(buffers[gpu][5], CL_FALSE, sizeof(cl_uint) * lossBase, sizeof(cl_uint) * lossCount, &lossRead[id*lossCount]);
+	}
+
+	results[id] = (unsigned *) queues[gpu].enqueueMapBuffer(buffers[gpu][6+slot], CL_FALSE, CL_MAP_READ, 0, sizeof(cl_uint4) * 81, NULL, &events[id], NULL);
+	events[id].setCallback(CL_COMPLETE, &CCallbackFunc, (void*) &currentWork[id]);
+	queues[gpu].flush();
+}
+
+
+// this function will hand the solutions done on GPU to the validation workers, then fetch new work
+// and restart mining. While it runs the device already works on the iteration queued in the other slot
 void clHost::callbackFunc(cl_int err , void* data){
 	clCallbackData* workInfo = (clCallbackData*) data;
 	uint32_t gpu = workInfo->gpuIndex;
+	uint32_t id = gpu*pipelineDepth + workInfo->slot;
 
-	// Read the number of solutions of the last iteration
-	uint32_t solutions = results[gpu][0];
+	// Checking and submitting is done by the workers, here the solutions are only copied out
+	uint32_t solutions = min<uint32_t>(results[id][0], 20);		// The result buffer holds 20
 	for (uint32_t  i=0; i<solutions; i++) {
-		vector<uint32_t> indexes;
-		indexes.assign(16,0);
-		memcpy(indexes.data(), &results[gpu][4 + 16*i], sizeof(uint32_t) * 16);
+		validators.submit(workInfo->wd, &results[id][4 + 16*i]);
+	}
+
+	// The kernels of this slot are done, their events are replaced by the next launch
+	if (profile) profiler.record(gpu, kernelEvents[id]);
+
+	// The slot is not launched again before this callback is done, so its launch time is stable
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now - launchTime[id]).count();
+	counters[gpu]->addIteration(solutions, ns);
 
-		stratum->handleSolution(workInfo->wd,indexes);
+	lock_guard<mutex> lock(*deviceMutex[gpu]);
+
+	if (lastDoneValid[gpu]) {
+		counters[gpu]->addInterval(std::chrono::duration_cast<std::chrono::nanoseconds>(now - lastDone[gpu]).count());
+	}
+	lastDone[gpu] = now;
+	lastDoneValid[gpu] = true;
+
+	if (lossStats) {
+		for (uint32_t i=0; i<lossCount; i++) lossTotals[gpu][i] += lossRead[id*lossCount + i];
+		lossIterations[gpu]++;
 	}
 
-	solutionCnt[gpu] += solutions;
+	queues[gpu].enqueueUnmapMemObject(buffers[gpu][6+workInfo->slot], results[id], NULL, NULL);
 
 	// Get new work and resume working
 	if (stratum->hasWork()) {
-		queues[gpu].enqueueUnmapMemObject(buffers[gpu][6], results[gpu], NULL, NULL);
-		queueKernels(gpu, &currentWork[gpu]);
-		results[gpu] = (unsigned *) queues[gpu].enqueueMapBuffer(buffers[gpu][6], CL_FALSE, CL_MAP_READ, 0, sizeof(cl_uint4) * 81, NULL, &events[gpu], NULL);
-		events[gpu].setCallback(CL_COMPLETE, &CCallbackFunc, (void*) &currentWork[gpu]);
-		queues[gpu].flush();
+		launchSlot(gpu, workInfo->slot);
 	} else {
-		paused[gpu] = true;
-		cout << "Device will be paused, waiting for new work" << endl;
+		paused[id] = true;
+		lastDoneValid[gpu] = false;		// The next interval would include the pause
+
+		bool allPaused = true;
+		for (uint32_t i=0; i<pipelineDepth; i++) allPaused = allPaused && paused[gpu*pipelineDepth + i];
+		if (allPaused) cout << "Device will be paused, waiting for new work" << endl;
+	}
+}
+
+
+// Called when the first kernel of the first iteration of a clean job is done on a device.
+// Takes its own mutex, the device mutex may be held by the thread that queued the kernel.
+void clHost::switchCallbackFunc(void* data) {
+	clSwitchProbe* probe = (clSwitchProbe*) data;
+
+	// Negative if an even newer clean job arrived meanwhile, that one will be reported instead
+	double ms = stratum->msSinceCleanJob(probe->epoch);
+	if (ms < 0) return;
+
+	lock_guard<mutex> lock(switchMutex);
+	uint32_t gpu = probe->gpuIndex;
+	switchLatencySum[gpu] += ms;
+	switchLatencyMax[gpu] = max(switchLatencyMax[gpu], ms);
+	switchCount[gpu]++;
+}
+
+
+// Prints how long the devices needed to start on the clean jobs since the last report
+void clHost::reportJobSwitches() {
+	stringstream ss;
+	bool any = false;
+
+	lock_guard<mutex> lock(switchMutex);
+	for (uint32_t i=0; i<devices.size(); i++) {
+		if (switchCount[i] == 0) continue;
+
+		ss << " " << i << ": " << fixed << setprecision(1) << switchLatencySum[i] / switchCount[i] << " ms (max " << switchLatencyMax[i] << ")";
+		any = true;
+
+		switchLatencySum[i] = 0;
+		switchLatencyMax[i] = 0;
+		switchCount[i] = 0;
 	}
+
+	if (any) cout << "Job switch latency:" << ss.str() << endl;
+}
+
+
+// Prints the average losses per iteration of a device since the last report
+void clHost::reportLosses(uint32_t gpu) {
+	vector<uint64_t> totals;
+	uint32_t iterations;
+	{
+		lock_guard<mutex> lock(*deviceMutex[gpu]);
+		totals = lossTotals[gpu];
+		iterations = lossIterations[gpu];
+		lossTotals[gpu].assign(lossCount, 0);
+		lossIterations[gpu] = 0;
+	}
+
+	if (iterations == 0) return;
+
+	double it = (double) iterations;
+	cout << "Losses of device " << gpu << " per iteration (" << iterations << " iterations):" << endl;
+	cout << fixed << setprecision(1);
+	cout << "   Sub bucket overflow  round0 " << totals[0] / it << ", round1 " << totals[1] / it;
+	cout << ", round2 " << totals[2] / it << ", round3 " << totals[3] / it << " elements" << endl;
+	cout << "   Chain cap reached    round1 " << totals[5] / it << ", round2 " << totals[6] / it;
+	cout << ", round3 " << totals[7] / it << ", round4 " << totals[8] / it << " threads" << endl;
+	cout << setprecision(3);
+	cout << "   Round 4 candidates beyond 256: " << totals[4] / it << ", solutions beyond 20: " << totals[9] / it << endl;
+	cout << "   Round 2 pairs pruned for a shared round 0 element: " << totals[10] / it << endl;
 }
 
 
 void clHost::startMining() {
 
-	// Start mining initially
+	// Start mining initially, each device gets all its pipeline slots filled
 	for (int i=0; i<devices.size(); i++) {	
-		paused[i] = false;
+		lock_guard<mutex> lock(*deviceMutex[i]);
+		rates[i]->start(counters[i]->solutions.load());
 
-		currentWork[i].gpuIndex = i;
-		currentWork[i].host = (void*) this;
-		queueKernels(i, &currentWork[i]);
+		for (uint32_t slot=0; slot<pipelineDepth; slot++) {
+			uint32_t id = i*pipelineDepth + slot;
+			paused[id] = false;
 
-		results[i] = (unsigned *) queues[i].enqueueMapBuffer(buffers[i][6], CL_FALSE, CL_MAP_READ, 0, sizeof(cl_uint4) * 81, NULL, &events[i], NULL);
-		events[i].setCallback(CL_COMPLETE, &CCallbackFunc, (void*) &currentWork[i]);
-		queues[i].flush();
+			currentWork[id].gpuIndex = i;
+			currentWork[id].slot = slot;
+			currentWork[id].host = (void*) this;
+			launchSlot(i, slot);
+		}
 	}
 
 
+	// Intervals between finished iterations and their summed time at the last report
+	vector<uint64_t> lastIntervals(devices.size(), 0);
+	vector<uint64_t> lastIntervalNs(devices.size(), 0);
+
 	// While the mining is running print some statistics
 	while (restart) {
 		this_thread::sleep_for(std::chrono::seconds(15));
 
-		// Print performance stats (roughly)
+		// Print performance stats, the rate of the last interval and its averages
 		cout << "Performance: ";
-		uint32_t totalSols = 0;
+		double total[rateAverage::windows] = {0, 0, 0, 0};
 		for (int i=0; i<devices.size(); i++) {
-			uint32_t sol = solutionCnt[i];
-			solutionCnt[i] = 0;
-			totalSols += sol;
-			cout << fixed << setprecision(2) << (double) sol / 15.0 << " sol/s ";
-			
+			rates[i]->update(counters[i]->solutions.load(memory_order_relaxed));
+			for (uint32_t w=0; w<rateAverage::windows; w++) total[w] += rates[i]->rate(w);
+
+			cout << fixed << setprecision(2) << rates[i]->rate(0) << " sol/s ";
 		}
 
-		if (devices.size() > 1) cout << "| Total: " << setprecision(2) << (double) totalSols / 15.0 << " sol/s ";
+		if (devices.size() > 1) cout << "| Total: " << setprecision(2) << total[0] << " sol/s ";
+		cout << endl;
+
+		cout << "Average sol/s (1 / 5 / 15 min):";
+		for (int i=0; i<devices.size(); i++) {
+			uint64_t intervals = counters[i]->intervals.load(memory_order_relaxed);
+			uint64_t ns = counters[i]->intervalNs.load(memory_order_relaxed);
+			double ms = (intervals > lastIntervals[i]) ? 1e-6 * (ns - lastIntervalNs[i]) / (intervals - lastIntervals[i]) : 0;
+			lastIntervals[i] = intervals;
+			lastIntervalNs[i] = ns;
+
+			cout << " " << i << ": " << setprecision(2) << rates[i]->rate(1) << " / " << rates[i]->rate(2) << " / " << rates[i]->rate(3)
+			     << " (" << setprecision(1) << ms << " ms/iteration)";
+		}
+		if (devices.size() > 1) cout << " | Total: " << setprecision(2) << total[1] << " / " << total[2] << " / " << total[3];
 		cout << endl;
 
+		reportJobSwitches();
+
+		if (profile) {
+			for (int i=0; i<devices.size(); i++) profiler.report(i);
+		}
+
+		if (lossStats) {
+			for (int i=0; i<devices.size(); i++) reportLosses(i);
+		}
+
 		// Check if there are paused devices and restart them
 		for (int i=0; i<devices.size(); i++) {
-			if (paused[i] && stratum->hasWork()) {
-				paused[i] = false;
-				
-				// Same as above
-				queueKernels(i, &currentWork[i]);
+			lock_guard<mutex> lock(*deviceMutex[i]);
+
+			for (uint32_t slot=0; slot<pipelineDepth; slot++) {
+				uint32_t id = i*pipelineDepth + slot;
 
-				results[i] = (unsigned *) queues[i].enqueueMapBuffer(buffers[i][6], CL_FALSE, CL_MAP_READ, 0, sizeof(cl_uint4) * 81, NULL, &events[i], NULL);
-				events[i].setCallback(CL_COMPLETE, &CCallbackFunc, (void*) &currentWork[i]);
-				queues[i].flush();
+				if (paused[id] && stratum->hasWork()) {
+					paused[id] = false;
+					lastDoneValid[i] = false;
+					launchSlot(i, slot);
+				}
 			}
+		}
+	}
+}
+
+
 
+// Per device metrics, called from the stratum thread while the devices mine
+void clHost::writeMetrics(stringstream &ss) {
+	vector<string> labels;
+	for (uint32_t i=0; i<devices.size(); i++) {
+		labels.push_back("{device=\"" + to_string(i) + "\",name=\"" + metricLabel(devices[i].getInfo<CL_DEVICE_NAME>()) + "\"");
+	}
+
+	static const char* windowNames[rateAverage::windows] = {"15s", "1m", "5m", "15m"};
+
+	stringstream solutions, rate, iterations, intervalSum, intervalCount, latencySum, latencyCount, pausedState;
+	for (uint32_t i=0; i<devices.size(); i++) {
+		uint64_t iterationCount = counters[i]->iterations.load(memory_order_relaxed);
+		solutions << "zelminer_device_solutions_total" << labels[i] << "} " << counters[i]->solutions.load(memory_order_relaxed) << "\n";
+		for (uint32_t w=0; w<rateAverage::windows; w++) {
+			rate << "zelminer_device_solutions_per_second" << labels[i] << ",window=\"" << windowNames[w] << "\"} " << rates[i]->rate(w) << "\n";
 		}
+		iterations << "zelminer_device_iterations_total" << labels[i] << "} " << iterationCount << "\n";
+		intervalSum << "zelminer_device_iteration_interval_seconds_sum" << labels[i] << "} " << 1e-9 * counters[i]->intervalNs.load(memory_order_relaxed) << "\n";
+		intervalCount << "zelminer_device_iteration_interval_seconds_count" << labels[i] << "} " << counters[i]->intervals.load(memory_order_relaxed) << "\n";
+		latencySum << "zelminer_device_iteration_seconds_sum" << labels[i] << "} " << 1e-9 * counters[i]->iterationNs.load(memory_order_relaxed) << "\n";
+		latencyCount << "zelminer_device_iteration_seconds_count" << labels[i] << "} " << iterationCount << "\n";
+
+		lock_guard<mutex> lock(*deviceMutex[i]);
+		bool allPaused = true;
+		for (uint32_t slot=0; slot<pipelineDepth; slot++) allPaused = allPaused && paused[i*pipelineDepth + slot];
+		pausedState << "zelminer_device_paused" << labels[i] << "} " << (allPaused ? 1 : 0) << "\n";
 	}
+
+	metricHeader(ss, "zelminer_device_solutions_total", "counter", "Solutions found by the device");
+	ss << solutions.str();
+	metricHeader(ss, "zelminer_device_solutions_per_second", "gauge", "Solution rate of the device in the last statistics interval (15s) and its 1, 5 and 15 minute averages");
+	ss << rate.str();
+	metricHeader(ss, "zelminer_device_iterations_total", "counter", "Finished iterations of the device");
+	ss << iterations.str();
+	metricHeader(ss, "zelminer_device_iteration_interval_seconds", "summary", "Time between two finished iterations, the iteration time of the device");
+	ss << intervalSum.str() << intervalCount.str();
+	metricHeader(ss, "zelminer_device_iteration_seconds", "summary", "Time from queueing an iteration to its results, includes the wait behind the other pipeline slot");
+	ss << latencySum.str() << latencyCount.str();
+	metricHeader(ss, "zelminer_device_paused", "gauge", "1 while the device waits for work");
+	ss << pausedState.str();
 }
 
 
+// Runs the benchmark iterations of one device, the pipeline is kept full as in mining.
+// Each device gets its own nonce range, so its results do not depend on the other devices.
+void clHost::benchmarkDevice(uint32_t gpu, cl_ulong8 work, cl_uint epoch, const benchmarkSettings &settings, benchmarkResult &result) {
+	cl_uint nonce = settings.startNonce + (gpu << 24);
+	cl_uint slotSolutions[pipelineDepth];
+	vector<uint32_t> slotResults[pipelineDepth];		// Whole result buffer of checked iterations
+	cl::Event done[pipelineDepth];
+	std::chrono::steady_clock::time_point queued[pipelineDepth];
+
+	// The warm up repeats the first nonce, so the measured iterations start at the reported start nonce
+	enqueueIteration(gpu, 0, work, nonce, epoch);
+	queues[gpu].finish();
+
+	auto start = std::chrono::steady_clock::now();
+	auto last = start;
+	uint32_t launched = 0;
+
+	while (true) {
+		double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		bool more = (settings.iterations > 0) ? (launched < settings.iterations) : (elapsed < settings.seconds);
+
+		if (more && (launched - result.iterations < pipelineDepth)) {
+			uint32_t slot = launched % pipelineDepth;
+			queued[slot] = std::chrono::steady_clock::now();
+			enqueueIteration(gpu, slot, work, nonce + launched, epoch);
+			if (launched < settings.verify) {
+				slotResults[slot].resize(324);
+				queues[gpu].enqueueReadBuffer(buffers[gpu][6+slot], CL_FALSE, 0, sizeof(cl_uint) * 324, slotResults[slot].data(), NULL, &done[slot]);
+			} else {
+				queues[gpu].enqueueReadBuffer(buffers[gpu][6+slot], CL_FALSE, 0, sizeof(cl_uint), &slotSolutions[slot], NULL, &done[slot]);
+			}
+			queues[gpu].flush();
+			launched++;
+			continue;
+		}
+
+		if (result.iterations == launched) break;
+
+		// Wait for the oldest iteration in flight
+		uint32_t slot = result.iterations % pipelineDepth;
+		done[slot].wait();
+
+		auto now = std::chrono::steady_clock::now();
+		result.intervalMs.push_back(std::chrono::duration<double, std::milli>(now - last).count());
+		result.latencyMs.push_back(std::chrono::duration<double, std::milli>(now - queued[slot]).count());
+		last = now;
+
+		if (result.iterations < settings.verify) {
+			slotSolutions[slot] = slotResults[slot][0];
+			result.checkNonces.push_back(nonce + result.iterations);
+			result.checkResults.push_back(slotResults[slot]);
+		}
+
+		result.solutions += min<uint32_t>(slotSolutions[slot], 20);		// The result buffer holds 20
+		result.iterations++;
+
+		if (profile) profiler.record(gpu, kernelEvents[gpu*pipelineDepth + slot]);
+	}
+
+	result.seconds = std::chrono::duration<double>(last - start).count();
+}
+
+
+// Writes mean and percentiles of a list of times as a JSON object
+static void jsonTimes(stringstream &ss, vector<double> times) {
+	if (times.size() == 0) {
+		ss << "null";
+		return;
+	}
+
+	sort(times.begin(), times.end());
+	double sum = 0;
+	for (uint32_t i=0; i<times.size(); i++) sum += times[i];
+
+	ss << "{\"mean\": " << sum / times.size() << ", \"p50\": " << percentile(times, 0.5) << ", \"p90\": " << percentile(times, 0.9)
+	   << ", \"p99\": " << percentile(times, 0.99) << ", \"max\": " << times.back() << "}";
+}
+
+
+static string jsonEscape(const string &text) {
+	string result;
+	for (uint32_t i=0; i<text.size(); i++) {
+		if ((text[i] == '"') || (text[i] == '\\')) result.push_back('\\');
+		if ((uint8_t) text[i] >= 0x20) result.push_back(text[i]);
+	}
+	return result;
+}
+
+
+// Solves the nonces of the checked benchmark iterations again with the native CPU solver. The CPU
+// solver keeps the original element formats, so it does not share the packed formats of the later
+// kernel rounds. Every GPU solution is checked from the hashes alone, losses may make either side
+// miss a few solutions. Returns false if the GPU reported an invalid solution.
+bool clHost::verifyBenchmark(cl_ulong8 work, vector<benchmarkResult> &measured) {
+	cpuSolver solver;
+	solver.setup(0);
+
+	const uint64_t* state = (const uint64_t*) &work;
+	bool valid = true;
+
+	for (uint32_t i=0; i<measured.size(); i++) {
+		benchmarkResult &r = measured[i];
+		cout << "Checking " << r.checkNonces.size() << " iterations of device " << i << " with the native CPU solver" << endl;
+
+		for (uint32_t it=0; it<r.checkNonces.size(); it++) {
+			vector< vector<uint32_t> > cpuFound;
+			solver.solve(state, r.checkNonces[it], cpuFound);
+			r.cpuSolutions += cpuFound.size();
+
+			uint32_t count = min<uint32_t>(r.checkResults[it][0], 20);
+			for (uint32_t s=0; s<count; s++) {
+				vector<uint32_t> indexes(&r.checkResults[it][4 + 16*s], &r.checkResults[it][4 + 16*s] + 16);
+				r.gpuSolutions++;
+
+				if (!solver.verify(state, r.checkNonces[it], indexes.data())) {
+					r.gpuInvalid++;
+					valid = false;
+				} else if (find(cpuFound.begin(), cpuFound.end(), indexes) != cpuFound.end()) {
+					r.matched++;
+				}
+			}
+		}
+	}
+
+	return valid;
+}
+
+
+// Mines the offline job of the stratum on all devices at once and prints the results as JSON.
+// Solutions are only counted, without a pool there is nothing to submit them to. With
+// settings.verify the solutions of the first iterations are checked on the CPU afterwards.
+bool clHost::benchmark(const benchmarkSettings &settings) {
+	zelStratum::WorkDescription wd;
+	cl_ulong8 work;
+	stratum->getWork(wd, (uint8_t *) &work);
+
+	vector<benchmarkResult> measured(devices.size());
+	vector<thread> runs;
+	for (uint32_t i=0; i<devices.size(); i++) {
+		runs.push_back(thread(&clHost::benchmarkDevice, this, i, work, wd.epoch, std::cref(settings), std::ref(measured[i])));
+	}
+	for (uint32_t i=0; i<runs.size(); i++) runs[i].join();
+
+	if (profile) {
+		for (uint32_t i=0; i<devices.size(); i++) profiler.report(i);
+	}
+
+	bool valid = true;
+	if (settings.verify > 0) valid = verifyBenchmark(work, measured);
+
+	stringstream ss;
+	ss << fixed << setprecision(4);
+	ss << "{" << endl;
+	ss << "  \"seed\": " << settings.seed << "," << endl;
+	ss << "  \"header\": " << (settings.header.empty() ? "null" : "\"" + jsonEscape(settings.header) + "\"") << "," << endl;
+	ss << "  \"startNonce\": " << settings.startNonce << "," << endl;
+	ss << "  \"devices\": [" << endl;
+
+	uint64_t totalSolutions = 0;
+	uint64_t totalIterations = 0;
+	double totalRate = 0;
+
+	for (uint32_t i=0; i<devices.size(); i++) {
+		benchmarkResult &r = measured[i];
+		double solPerSec = (r.seconds > 0) ? r.solutions / r.seconds : 0;
+		double solPerNonce = (r.iterations > 0) ? (double) r.solutions / r.iterations : 0;
+
+		totalSolutions += r.solutions;
+		totalIterations += r.iterations;
+		totalRate += solPerSec;
+
+		ss << "    {\"index\": " << i << ", \"name\": \"" << jsonEscape(devices[i].getInfo<CL_DEVICE_NAME>()) << "\""
+		   << ", \"kernel\": \"" << configs[i].describe() << "\", \"mem3G\": " << (is3G[i] ? "true" : "false") << "," << endl;
+		ss << "     \"iterations\": " << r.iterations << ", \"seconds\": " << r.seconds << ", \"solutions\": " << r.solutions
+		   << ", \"solPerSec\": " << solPerSec << ", \"solPerNonce\": " << solPerNonce << "," << endl;
+		ss << "     \"iterationMs\": ";
+		jsonTimes(ss, r.intervalMs);
+		ss << "," << endl << "     \"latencyMs\": ";
+		jsonTimes(ss, r.latencyMs);
+		if (settings.verify > 0) {
+			ss << "," << endl << "     \"verify\": {\"iterations\": " << r.checkNonces.size() << ", \"gpuSolutions\": " << r.gpuSolutions
+			   << ", \"invalid\": " << r.gpuInvalid << ", \"cpuSolutions\": " << r.cpuSolutions << ", \"matched\": " << r.matched << "}";
+		}
+		ss << "}" << ((i+1 < devices.size()) ? "," : "") << endl;
+	}
+
+	ss << "  ]," << endl;
+	ss << "  \"total\": {\"iterations\": " << totalIterations << ", \"solutions\": " << totalSolutions
+	   << ", \"solPerSec\": " << totalRate << ", \"solPerNonce\": " << ((totalIterations > 0) ? (double) totalSolutions / totalIterations : 0) << "}" << endl;
+	ss << "}" << endl;
+
+	cout << ss.str();
+
+	if (!settings.jsonFile.empty()) {
+		ofstream file(settings.jsonFile);
+		file << ss.str();
+		if (!file.good()) cout << "Could not write benchmark result to " << settings.jsonFile << endl;
+	}
+
+	if (!valid) cout << "Error: The GPU reported solutions that are not valid" << endl;
+	return valid;
+}
+
 } 	// end namespace
 
 
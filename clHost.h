@@ -10,57 +10,201 @@
 #include <vector>
 #include <map>
 #include <cstdlib>
+#include <cstring>
 #include <climits>
+#include <chrono>
+#include <mutex>
+#include <memory>
+#include <atomic>
+#include <deque>
 
 #include "zelStratum.h"
+#include "collisionMode.h"
+#include "clTuning.h"
+#include "clMemoryPlan.h"
+#include "clBinaryCache.h"
+#include "solutionQueue.h"
+#include "clProfiler.h"
+#include "deviceStats.h"
+#include "cpuSolver.h"
 
 namespace zelMiner {
 
+// Measurement of one kernel configuration
+struct tuningResult {
+	double msPerIteration = 0;
+	double solPerIteration = 0;
+	double solPerSec = 0;
+};
+
+// Host side of the iterationParams struct in the kernel, the per iteration
+// arguments. Padded to 128 bytes, the largest fill pattern.
+struct iterationParams {
+	cl_ulong8 blake_state;
+	cl_uint nonce;
+	cl_uint epoch;
+	cl_uint pad[14];
+};
+
+// Offline benchmark run, a fixed number of iterations or, if that is 0, a time span
+struct benchmarkSettings {
+	uint32_t iterations = 0;
+	double seconds = 0;
+	uint32_t startNonce = 0;
+	uint64_t seed = 0;
+	string header;					// Hex, a seeded header is used if empty
+	string jsonFile;				// Optional copy of the result
+	uint32_t verify = 0;				// Iterations per device checked with the native CPU solver
+};
+
+// Measurement of one device in a benchmark
+struct benchmarkResult {
+	uint32_t iterations = 0;
+	uint64_t solutions = 0;
+	double seconds = 0;
+	vector<double> intervalMs;			// Time between two finished iterations
+	vector<double> latencyMs;			// Time from queueing an iteration to its results
+
+	// Result buffers of the first settings.verify iterations and their comparison with the CPU solver
+	vector<uint32_t> checkNonces;
+	vector< vector<uint32_t> > checkResults;
+	uint32_t gpuSolutions = 0;			// In the checked iterations
+	uint32_t gpuInvalid = 0;
+	uint32_t cpuSolutions = 0;
+	uint32_t matched = 0;				// Found by both
+};
+
 struct clCallbackData {
 	void* host;
 	uint32_t gpuIndex;
+	uint32_t slot;
 	zelStratum::WorkDescription wd;
 };
 
+// Callback data of the first kernel of the first iteration of a clean job
+struct clSwitchProbe {
+	void* host;
+	uint32_t gpuIndex;
+	uint32_t epoch;
+};
+
 class clHost {
 	private:
 	// OpenCL 
 	vector<cl::Platform> platforms;  
 	vector<cl::Context> contexts;
 	vector<cl::CommandQueue> queues;
+	vector<cl::CommandQueue> abortQueues;		// Raise jobEpoch while the main queue is busy
 	vector<cl::Device> devices;
+
+	// Each device has pipelineDepth iterations in flight, every slot has its own
+	// event, mapped result buffer and work. Slot s of device d is entry d*pipelineDepth+s.
+	static const uint32_t pipelineDepth = 2;
 	vector<cl::Event> events;
 	vector<unsigned*> results;
+	vector< unique_ptr<mutex> > deviceMutex;
 
+	// Buffers are per device, kernels per pipeline slot. All kernel arguments are
+	// bound once in bindKernelArgs, every slot has its own result and parameter buffer.
 	vector< vector<cl::Buffer> > buffers;
 	vector< vector<cl::Kernel> > kernels;
 
 	vector<bool> is3G;
 
-	// Statistics
-	vector<int> solutionCnt;
+	// Round 0 indexes in pinned host memory instead of device memory
+	bool hostIndexes;
+
+	// Collision search strategy, in auto mode picked per device
+	collisionMode collision;
+
+	// Kernel configuration of each device, tuned ones are kept in the database
+	vector<kernelConfig> configs;
+	tuningDB tuning;
+	bool autotune;
+
+	clBinaryCache binaryCache;
+
+	// Clean job epoch of each device and the time from the notify until the first kernel
+	// of the job finished on it. The sums are written from the OpenCL callbacks.
+	vector<cl::Buffer> epochBuffers;
+	vector<uint32_t> startedEpoch;
+	vector<cl::Event> switchEvents;			// Per pipeline slot
+	vector<clSwitchProbe> switchProbes;
+	mutex switchMutex;
+	vector<double> switchLatencySum;
+	vector<double> switchLatencyMax;
+	vector<uint32_t> switchCount;
+
+	// Optional kernel timing, every slot keeps the events of its last iteration
+	bool profile;
+	kernelProfiler profiler;
+	vector< vector<cl::Event> > kernelEvents;
+
+	// Optional instrumented kernel build that counts the dropped elements
+	bool lossStats;
+	vector<uint32_t> lossRead;			// Read back of each slot
+	vector< vector<uint64_t> > lossTotals;		// Sums per device since the last report
+	vector<uint32_t> lossIterations;
+
+	// Statistics, the counters are atomic and the rates are only updated by the statistics loop
+	vector< unique_ptr<deviceCounters> > counters;
+	vector< unique_ptr<rateAverage> > rates;
+	vector<std::chrono::steady_clock::time_point> launchTime;	// Per pipeline slot
+
+	// Last finished iteration of each device. With several slots in flight the time from
+	// queueing to the results includes the wait behind the other slots, the time between
+	// two finished iterations is the real iteration time. Not valid after a pause.
+	vector<std::chrono::steady_clock::time_point> lastDone;
+	vector<uint8_t> lastDoneValid;
 
 	// To check if a mining thread stoped and we must resume it
-	vector<bool> paused;
+	vector<uint8_t> paused;				// No vector<bool>, slots are written from different callbacks
 
 	// Callback data
 	vector<clCallbackData> currentWork;
+	solutionQueue validators;
 	bool restart = true;
 
 
 	// Functions
 	void detectPlatFormDevices(vector<int32_t>, bool, bool);
-	void loadAndCompileKernel(cl::Device &, uint32_t, bool);
+	void loadAndCompileKernel(cl::Device &, uint32_t, bool, kernelConfig, bool);
+	bool buildProgram(cl::Device &, uint32_t, string, cl::Program &);
+	vector<cl::Kernel> createKernels(cl::Program &);
+	memoryPlan planMemory(cl::Device &, bool, const kernelConfig &);
+	bool createBuffers(uint32_t, cl::Device &, bool, const kernelConfig &, vector<cl::Buffer> &);
+	void bindKernelArgs(uint32_t);
+
+	// Tuning
+	string deviceKey(cl::Device &, bool);
+	kernelConfig startConfig(cl::Device &, bool, uint64_t, bool &);
+	bool installConfig(uint32_t, uint32_t, bool, const kernelConfig &);
+	bool measureConfig(uint32_t, uint32_t, bool, const kernelConfig &, uint32_t, tuningResult &);
+	kernelConfig selectConfig(uint32_t, uint32_t, bool, vector<kernelConfig>, uint32_t, tuningResult &);
+	void autotuneDevice(uint32_t, uint32_t, bool, string);
+
+	string kernelOptions(const kernelConfig &, bool);
+	void reportLosses(uint32_t);
+	void abortStaleWork(uint32_t);
+	void reportJobSwitches();
+
 	void queueKernels(uint32_t, clCallbackData*);
+	void enqueueIteration(uint32_t, uint32_t, cl_ulong8 &, cl_uint, cl_uint, cl::Event* = NULL);
+	void launchSlot(uint32_t, uint32_t);
+	void benchmarkDevice(uint32_t, cl_ulong8, cl_uint, const benchmarkSettings &, benchmarkResult &);
+	bool verifyBenchmark(cl_ulong8, vector<benchmarkResult> &);
 	
 	// The connector
 	zelStratum* stratum;
 
 	public:
 	
-	void setup(zelStratum*, vector<int32_t>, bool, bool);
+	bool setup(zelStratum*, vector<int32_t>, bool, bool, bool, collisionMode, bool, bool, bool);
 	void startMining();	
+	bool benchmark(const benchmarkSettings &);
+	void writeMetrics(stringstream &);
 	void callbackFunc(cl_int, void*);
+	void switchCallbackFunc(void*);
 };
 
 }
@@ -0,0 +1,108 @@
+// ZelHash OpenCL Miner
+// Device Memory Planner
+
+#include "clMemoryPlan.h"
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+
+namespace zelMiner {
+
+static string sizeText(uint64_t bytes) {
+	stringstream ss;
+	ss << fixed << setprecision(1);
+	if (bytes < 1024*1024) {
+		ss << (double) bytes / 1024 << " KByte";
+	} else {
+		ss << (double) bytes / (1024*1024) << " MByte";
+	}
+	return ss.str();
+}
+
+
+// Sub buffers have to start at a multiple of align bytes (CL_DEVICE_MEM_BASE_ADDR_ALIGN)
+memoryPlan::memoryPlan(const kernelConfig &config, bool use3G, bool hostIndexes, uint64_t slotBytes, uint64_t align, uint64_t maxAlloc) {
+	uint64_t elements = config.bufferElements();
+	slotMemory = slotBytes;
+
+	regions.resize(6);
+	regions[0].name = "round 0 / 2 output";
+	regions[0].size = 16 * elements;
+	regions[1].name = "round 1 output";
+	regions[1].size = 16 * elements;
+	regions[2].name = "round 3 output";
+	regions[2].size = 8 * elements;
+	regions[3].name = "round 0 indexes";
+	regions[3].size = 4 * elements;
+	regions[4].name = "round 4 candidates";
+	regions[4].size = 16 * 256;
+	regions[5].name = "counters";
+	regions[5].size = 4 * 263168;
+
+	// The 3G kernel writes round 3 into the payload half of the round 1 output
+	if (use3G) regions[2].aliasOf = 1;
+
+	// Only round 0 writes the indexes and only combine reads a few of them
+	if (hostIndexes) {
+		regions[3].host = true;
+		hostMemory = regions[3].size;
+	}
+
+	if (align == 0) align = 1;
+
+	for (uint32_t i=0; i<regions.size(); i++) {
+		if ((regions[i].aliasOf >= 0) || regions[i].host) continue;
+
+		uint64_t offset = 0;
+		if (allocations.size() > 0) offset = (allocations.back() + align - 1) / align * align;
+
+		// Buffers larger than the limit still get an allocation of their own, most drivers accept them
+		if ((allocations.size() == 0) || ((offset + regions[i].size > maxAlloc) && (allocations.back() > 0))) {
+			allocations.push_back(0);
+			offset = 0;
+		}
+
+		regions[i].allocation = allocations.size()-1;
+		regions[i].offset = offset;
+		allocations.back() = offset + regions[i].size;
+	}
+
+	for (uint32_t i=0; i<regions.size(); i++) {
+		if (regions[i].aliasOf < 0) continue;
+		regions[i].allocation = regions[regions[i].aliasOf].allocation;
+		regions[i].offset = regions[regions[i].aliasOf].offset;
+	}
+}
+
+
+uint64_t memoryPlan::total() const {
+	uint64_t sum = slotMemory;
+	for (uint32_t i=0; i<allocations.size(); i++) sum += allocations[i];
+	return sum;
+}
+
+
+void memoryPlan::print() const {
+	stringstream ss;
+	ss << "   Memory plan: " << sizeText(total()) << " in " << allocations.size() << " allocation(s)";
+	if (hostMemory > 0) ss << ", " << sizeText(hostMemory) << " pinned host memory";
+	ss << endl;
+
+	for (uint32_t i=0; i<regions.size(); i++) {
+		ss << "      " << left << setw(20) << regions[i].name << right;
+		if (regions[i].aliasOf >= 0) {
+			ss << " shares " << regions[regions[i].aliasOf].name << endl;
+		} else if (regions[i].host) {
+			ss << setw(14) << sizeText(regions[i].size) << ", pinned host memory" << endl;
+		} else {
+			ss << setw(14) << sizeText(regions[i].size) << ", allocation " << regions[i].allocation
+			   << " at " << sizeText(regions[i].offset) << endl;
+		}
+	}
+
+	ss << "      " << left << setw(20) << "results, parameters" << right << setw(14) << sizeText(slotMemory) << endl;
+	cout << ss.str();
+}
+
+}
@@ -0,0 +1,50 @@
+// ZelHash OpenCL Miner
+// Device Memory Planner
+// Copyright 2019 Wilke Trei
+
+#ifndef zelMinerMemoryPlan_H
+#define zelMinerMemoryPlan_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "clTuning.h"
+
+using namespace std;
+
+namespace zelMiner {
+
+// One working buffer of the kernels. A buffer with aliasOf >= 0 has no memory
+// of its own, it shares the buffer with that index. Host buffers are allocated
+// on their own in pinned host memory and do not count to the device memory.
+struct memoryRegion {
+	string name;
+	uint64_t size = 0;
+	int32_t aliasOf = -1;
+	bool host = false;
+	uint32_t allocation = 0;
+	uint64_t offset = 0;
+};
+
+
+// Exact device memory footprint of a kernel variant. The working buffers of the
+// rounds are carved as sub-buffers out of as few allocations as the maximal
+// allocation size of the device allows. Only the small result and parameter
+// buffers of the pipeline slots, which the host maps and fills, are separate.
+class memoryPlan {
+	public:
+	vector<memoryRegion> regions;		// In the order of the buffer indexes 0 - 5
+	vector<uint64_t> allocations;
+	uint64_t slotMemory = 0;
+	uint64_t hostMemory = 0;
+
+	memoryPlan(const kernelConfig &, bool, bool, uint64_t, uint64_t, uint64_t);
+
+	uint64_t total() const;				// Device memory only
+	void print() const;
+};
+
+}
+
+#endif
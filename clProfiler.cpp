@@ -0,0 +1,75 @@
+// ZelHash OpenCL Miner
+// Per Kernel Timing from OpenCL Event Profiling
+
+#include "clProfiler.h"
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+namespace zelMiner {
+
+static const char* kernelNames[7] = {"clearCounter", "round0", "round1", "round2", "round3", "round4", "combine"};
+
+// Nominal global memory traffic of each kernel. Every round handles about 2^26
+// elements: round 0 writes 16 + 4 bytes per element, rounds 1 and 2 read 16 bytes,
+// round 1 writes 16 and round 2 12 bytes. Round 3 reads and writes 8 bytes and round 4
+// only reads them. Combine only touches the few candidates.
+static const double elements = 67108864.0;
+static const double kernelBytes[7] = {263168.0 * 4, elements * 20, elements * 32, elements * 28, elements * 16, elements * 8, 0};
+
+
+void kernelProfiler::setup(uint32_t devices) {
+	lock_guard<mutex> lock(sampleMutex);
+	samples.assign(devices, vector< vector<double> >(kernelCount));
+}
+
+
+void kernelProfiler::record(uint32_t device, vector<cl::Event> &events) {
+	double times[kernelCount];
+
+	for (uint32_t k=0; k<kernelCount; k++) {
+		cl_ulong start = 0, end = 0;
+		if (events[k].getProfilingInfo(CL_PROFILING_COMMAND_START, &start) != CL_SUCCESS) return;
+		if (events[k].getProfilingInfo(CL_PROFILING_COMMAND_END, &end) != CL_SUCCESS) return;
+		times[k] = (double) (end - start) / 1e6;
+	}
+
+	lock_guard<mutex> lock(sampleMutex);
+	for (uint32_t k=0; k<kernelCount; k++) samples[device][k].push_back(times[k]);
+}
+
+
+void kernelProfiler::report(uint32_t device) {
+	vector< vector<double> > current(kernelCount);
+	{
+		lock_guard<mutex> lock(sampleMutex);
+		swap(current, samples[device]);
+		samples[device].assign(kernelCount, vector<double>());
+	}
+
+	if (current[0].size() == 0) return;
+
+	cout << "Kernel profile of device " << device << " (" << current[0].size() << " iterations):" << endl;
+
+	double iteration = 0;
+	for (uint32_t k=0; k<kernelCount; k++) {
+		sort(current[k].begin(), current[k].end());
+		double median = percentile(current[k], 0.5);
+		iteration += median;
+
+		cout << "   " << left << setw(14) << kernelNames[k] << right << fixed << setprecision(3)
+		     << " p50 " << setw(8) << median << " ms"
+		     << "  p90 " << setw(8) << percentile(current[k], 0.9) << " ms"
+		     << "  p99 " << setw(8) << percentile(current[k], 0.99) << " ms";
+
+		if ((kernelBytes[k] > 0) && (median > 0)) {
+			cout << "  " << setprecision(1) << setw(7) << kernelBytes[k] / (median * 1e6) << " GB/s";
+		}
+		cout << endl;
+	}
+
+	cout << "   Sum of medians " << setprecision(3) << iteration << " ms per iteration" << endl;
+}
+
+}
@@ -0,0 +1,46 @@
+// ZelHash OpenCL Miner
+// Per Kernel Timing from OpenCL Event Profiling
+// Copyright 2019 Wilke Trei
+
+#ifndef zelMinerProfiler_H
+#define zelMinerProfiler_H
+
+#include <CL/cl.hpp>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+
+using namespace std;
+
+namespace zelMiner {
+
+// Collects the run time of every kernel of every iteration on the devices
+// and reports percentiles and the achieved memory bandwidth of each kernel
+class kernelProfiler {
+	private:
+	static const uint32_t kernelCount = 7;
+
+	mutex sampleMutex;
+	vector< vector< vector<double> > > samples;	// Milliseconds per device and kernel
+
+	public:
+	void setup(uint32_t);
+
+	// Reads start and end times of the kernel events of one finished iteration
+	void record(uint32_t, vector<cl::Event> &);
+
+	// Prints the statistics since the last report and clears them
+	void report(uint32_t);
+};
+
+
+// Nearest rank percentile of sorted samples
+inline double percentile(const vector<double> &sorted, double p) {
+	uint32_t rank = (uint32_t) (p * (sorted.size() - 1) + 0.5);
+	return sorted[rank];
+}
+
+}
+
+#endif
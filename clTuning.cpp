@@ -0,0 +1,96 @@
+// ZelHash OpenCL Miner
+// Kernel Tuning Parameters and Tuning Database
+
+#include "clTuning.h"
+
+#include <iostream>
+#include <sstream>
+#include <fstream>
+
+#include <boost/property_tree/json_parser.hpp>
+
+namespace zelMiner {
+
+namespace pt = boost::property_tree;
+
+string kernelConfig::buildOptions(bool use3G) const {
+	stringstream ss;
+	if (use3G) ss << "-DMEM3G ";
+	if (collision == collisionSort) ss << "-DCOLLISION_SORT ";
+	ss << "-DsubBucketSize=" << subBucketSize << " -DchainCap=" << chainCap;
+	return ss.str();
+}
+
+
+string kernelConfig::describe() const {
+	stringstream ss;
+	ss << ((collision == collisionSort) ? "sort" : "list") << ", sub bucket size " << subBucketSize;
+	if (collision != collisionSort) ss << ", chain cap " << chainCap;
+	return ss.str();
+}
+
+
+uint64_t kernelConfig::bufferElements() const {
+	return 65536 * (uint64_t) subBucketSize;		// 2^13 buckets * 8 sub buckets
+}
+
+
+// Reads the database, a missing or broken file gives an empty one
+void tuningDB::load(string fileNameIn) {
+	fileName = fileNameIn;
+	tree.clear();
+
+	ifstream file(fileName);
+	if (!file.good()) return;
+
+	try {
+		pt::read_json(file, tree);
+	} catch(const pt::ptree_error &e) {
+		cout << "   Could not read tuning database " << fileName << ", it will be recreated" << endl;
+		tree.clear();
+	}
+}
+
+
+void tuningDB::save() {
+	try {
+		pt::write_json(fileName, tree);
+	} catch(const pt::ptree_error &e) {
+		cout << "   Could not write tuning database " << fileName << endl;
+	}
+}
+
+
+// Device keys may contain dots, so the entries are addressed with a different separator
+bool tuningDB::lookup(string device, kernelConfig &config) {
+	boost::optional<pt::ptree&> entry = tree.get_child_optional(pt::ptree::path_type(device, '|'));
+	if (!entry) return false;
+
+	try {
+		kernelConfig tuned;
+		tuned.collision = (entry->get<string>("collision").compare("sort") == 0) ? collisionSort : collisionList;
+		tuned.subBucketSize = entry->get<uint32_t>("subBucketSize");
+		tuned.chainCap = entry->get<uint32_t>("chainCap");
+
+		if ((tuned.subBucketSize == 0) || (tuned.subBucketSize > 1216)) return false;
+
+		config = tuned;
+		return true;
+	} catch(const pt::ptree_error &e) {
+		return false;
+	}
+}
+
+
+void tuningDB::store(string device, const kernelConfig &config, double solPerSec, double solPerIter) {
+	pt::ptree entry;
+	entry.put("collision", (config.collision == collisionSort) ? "sort" : "list");
+	entry.put("subBucketSize", config.subBucketSize);
+	entry.put("chainCap", config.chainCap);
+	entry.put("solPerSec", solPerSec);
+	entry.put("solPerIteration", solPerIter);
+
+	tree.put_child(pt::ptree::path_type(device, '|'), entry);
+}
+
+}
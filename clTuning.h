@@ -0,0 +1,50 @@
+// ZelHash OpenCL Miner
+// Kernel Tuning Parameters and Tuning Database
+// Copyright 2019 Wilke Trei
+
+#ifndef zelMinerTuning_H
+#define zelMinerTuning_H
+
+#include <string>
+#include <cstdint>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include "collisionMode.h"
+
+using namespace std;
+
+namespace zelMiner {
+
+// Build time parameters of the OpenCL kernel
+struct kernelConfig {
+	collisionMode collision = collisionList;	// Never auto, list or sort
+	uint32_t subBucketSize = 1120;			// Elements per mask sub bucket, at most 1216
+	uint32_t chainCap = 40;				// Iteration cap of the linked list walk
+
+	string buildOptions(bool) const;
+	string describe() const;
+
+	// Number of elements each of the element buffers has to hold
+	uint64_t bufferElements() const;
+};
+
+
+// Stores the best kernel configuration of each device in a json file.
+// Devices are identified by their name and driver version.
+class tuningDB {
+	private:
+	string fileName;
+	boost::property_tree::ptree tree;
+
+	public:
+	void load(string);
+	void save();
+
+	bool lookup(string, kernelConfig&);
+	void store(string, const kernelConfig&, double, double);
+};
+
+}
+
+#endif
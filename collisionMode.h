@@ -0,0 +1,17 @@
+// ZelHash OpenCL Miner
+// Collision Search Strategies of Round 1 - 4
+// Copyright 2019 Wilke Trei
+
+#ifndef zelMinerCollision_H
+#define zelMinerCollision_H
+
+namespace zelMiner {
+
+// list: chain the elements of a bucket with equal collision bits in linked lists
+// sort: sort the elements of a bucket by their collision bits and pair up equal runs
+// auto: time both strategies on each device and use the faster one
+enum collisionMode { collisionList, collisionSort, collisionAuto };
+
+}
+
+#endif
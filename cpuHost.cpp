@@ -0,0 +1,84 @@
+// ZelHash OpenCL Miner
+// Native CPU Host Interface
+
+#include "cpuHost.h"
+#include "crypto/blake2bLanes.h"
+
+namespace zelMiner {
+
+// Setup function called from outside
+void cpuHost::setup(zelStratum* stratumIn, uint32_t threads, collisionMode collisionIn) {
+	stratum = stratumIn;
+	solutionCnt = 0;
+	collision = collisionIn;
+
+	solver.setup(threads);
+	solver.setCollisionSort(collision == collisionSort);
+	cout << "Native CPU solver will use " << solver.numThreads() << " threads" << endl;
+
+	uint32_t lanes = blake2bZelLanes();
+	cout << "   BLAKE2b round 0 hashing: " << ((lanes == 8) ? "AVX-512" : (lanes == 4) ? "AVX2" : "scalar")
+	     << " (" << lanes << " lanes)" << endl;
+}
+
+
+// Fetches work from the stratum interface, solves it on all threads and submits the solutions
+void cpuHost::mine() {
+	zelStratum::WorkDescription wd;
+	uint64_t work[8];
+
+	vector< vector<uint32_t> > solutions;
+	uint32_t iteration = 0;
+
+	while (restart) {
+		// Same as the GPUs, pause while there is no work
+		if (!stratum->hasWork()) {
+			this_thread::sleep_for(std::chrono::milliseconds(200));
+			continue;
+		}
+
+		stratum->getWork(wd, (uint8_t *) work);
+
+		solutions.clear();
+
+		if ((collision == collisionAuto) && (iteration < 2)) {
+			// Iteration 0 uses the linked lists, iteration 1 the sorting
+			solver.setCollisionSort(iteration == 1);
+
+			auto start = std::chrono::steady_clock::now();
+			solver.solve(work, wd.nonce, solutions);
+			strategyTime[iteration] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+			if (iteration == 1) {
+				bool sort = (strategyTime[1] < strategyTime[0]);
+				solver.setCollisionSort(sort);
+				cout << "CPU collision search: list " << fixed << setprecision(2) << strategyTime[0] << "s, sort "
+				     << strategyTime[1] << "s per iteration, using " << (sort ? "sort" : "list") << endl;
+			}
+		} else {
+			solver.solve(work, wd.nonce, solutions);
+		}
+		if (iteration < 2) iteration++;
+
+		for (uint32_t i=0; i<solutions.size(); i++) {
+			stratum->handleSolution(wd, solutions[i].data());
+		}
+
+		solutionCnt += solutions.size();
+	}
+}
+
+
+void cpuHost::startMining() {
+	thread(&cpuHost::mine, this).detach();
+
+	// While the mining is running print some statistics
+	while (restart) {
+		this_thread::sleep_for(std::chrono::seconds(15));
+
+		uint32_t sol = solutionCnt.exchange(0);
+		cout << "Performance CPU: " << fixed << setprecision(2) << (double) sol / 15.0 << " sol/s " << endl;
+	}
+}
+
+}
@@ -0,0 +1,43 @@
+// ZelHash OpenCL Miner
+// Native CPU Host Interface
+// Copyright 2019 Wilke Trei
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+
+#include "zelStratum.h"
+#include "cpuSolver.h"
+#include "collisionMode.h"
+
+namespace zelMiner {
+
+class cpuHost {
+	private:
+	cpuSolver solver;
+
+	// Statistics
+	atomic<uint32_t> solutionCnt;
+
+	// In auto mode the first two iterations time both collision strategies
+	collisionMode collision;
+	double strategyTime[2];
+
+	bool restart = true;
+
+	// Functions
+	void mine();
+
+	// The connector
+	zelStratum* stratum;
+
+	public:
+
+	void setup(zelStratum*, uint32_t, collisionMode);
+	void startMining();
+};
+
+}
@@ -0,0 +1,300 @@
+// ZelHash OpenCL Miner
+// Native CPU Solver for Equihash 125/4
+
+#include "cpuSolver.h"
+#include "crypto/blake2bLanes.h"
+#include "equihashVerify.h"
+#include <cstring>
+
+namespace zelMiner {
+
+// Same dimensions as the OpenCL kernel: 2^13 buckets holding the 2^26 indices
+static const uint32_t numBuckets = 8192;
+static const uint32_t bucketSize = 8672;
+
+// round0 computes 2^24 BLAKE2b outputs, we hand them out in chunks of this size
+static const uint32_t round0Chunk = 16384;
+
+static const uint32_t chainEnd = 0xFFFFFFFF;
+
+
+// Swaps the order of bits in each byte from low to high endian, see kernel
+static inline uint32_t swapBitOrder(uint32_t input) {
+	uint32_t tmp = ((input & 0x0F0F0F0F) << 4) | ((input & 0xF0F0F0F0) >> 4);
+	tmp = ((tmp & 0x33333333) << 2) | ((tmp & 0xCCCCCCCC) >> 2);
+	return ((tmp & 0x55555555) << 1) | ((tmp & 0xAAAAAAAA) >> 1);
+}
+
+
+// Shifts the 128 bit element right by sh bits (0 < sh < 32)
+static inline void shr_4(cpuElement &el, uint32_t sh) {
+	el.s0 = (el.s0 >> sh) | (el.s1 << (32-sh));
+	el.s1 = (el.s1 >> sh) | (el.s2 << (32-sh));
+	el.s2 = (el.s2 >> sh) | (el.s3 << (32-sh));
+	el.s3 = (el.s3 >> sh);
+}
+
+
+// Runs func(item, thread) for all items on all threads
+void cpuSolver::parallelFor(uint32_t items, function<void(uint32_t, uint32_t)> func) {
+	atomic<uint32_t> next(0);
+	vector<thread> workers;
+
+	for (uint32_t t=0; t<threads; t++) {
+		workers.push_back(thread([&, t] () {
+			uint32_t item;
+			while ((item = next.fetch_add(1)) < items) {
+				func(item, t);
+			}
+		}));
+	}
+
+	for (uint32_t t=0; t<threads; t++) workers[t].join();
+}
+
+
+// Hashes a chunk of round0Chunk work items and sorts the elements into buckets
+void cpuSolver::round0(uint32_t chunk) {
+	uint64_t hashes[16*8];
+
+	for (uint32_t tId = chunk*round0Chunk; tId < (chunk+1)*round0Chunk; tId += 16) {
+		blake2bZelHashes(blakeState, nonce, tId, 16, hashes);
+
+		// The hash output of 16 neighbouring work items is summed up, see kernel
+		uint32_t prefix[16];
+		memset(prefix, 0, sizeof(prefix));
+
+		for (uint32_t j=0; j<16; j++) {
+			const uint32_t* hash = (const uint32_t*) &hashes[8*j];
+			for (uint32_t i=0; i<16; i++) prefix[i] += hash[i];
+
+			for (uint32_t i=0; i<4; i++) {
+				cpuElement el;
+				el.s0 = swapBitOrder(prefix[4*i+0]);
+				el.s1 = swapBitOrder(prefix[4*i+1]);
+				el.s2 = swapBitOrder(prefix[4*i+2]);
+				el.s3 = swapBitOrder(prefix[4*i+3]) & 0x1FFFFFFF;	// Only lower 29 bits
+
+				uint32_t bucket = el.s0 & 0x1FFF;
+				uint32_t pos = counters[bucket].fetch_add(1, memory_order_relaxed);
+				shr_4(el, 13);
+
+				if (pos < bucketSize) {
+					buffers[0][bucket*bucketSize+pos] = el;
+					indexes[bucket*bucketSize+pos] = ((tId+j) << 2) + i;
+				}
+			}
+		}
+	}
+}
+
+
+// Writes the xor of two colliding elements to the next round,
+// output formats are the same as in the kernel
+void cpuSolver::collidePair(uint32_t round, uint32_t bucket, const cpuElement* input, uint32_t own, uint32_t oth) {
+	static const uint32_t outBuf[5] = {0, 1, 0, 2, 0};
+
+	const cpuElement &a = input[own];
+	const cpuElement &b = input[oth];
+
+	cpuElement outputEl;
+	outputEl.s0 = a.s0 ^ b.s0;
+	outputEl.s1 = a.s1 ^ b.s1;
+
+	if (round == 4) {
+		// Last round we want all bits to vanish
+		if ((outputEl.s0 != 0) || (outputEl.s1 != 0)) return;
+
+		cpuElement index = {a.s2, a.s3, b.s2, b.s3};
+
+		bool ok = true;
+		ok = ok && (index.s0 != index.s1) && (index.s0 != index.s2) && (index.s0 != index.s3);
+		ok = ok && (index.s1 != index.s2) && (index.s1 != index.s3) && (index.s2 != index.s3);
+
+		if (ok) {
+			lock_guard<mutex> lock(candidateMutex);
+			candidates.push_back(index);
+		}
+		return;
+	}
+
+	if (outputEl.s1 == 0) return;
+
+	uint32_t buck = (outputEl.s0 >> 12) & 0x1FFF;
+
+	if (round == 1) {
+		outputEl.s2 = a.s2 ^ b.s2;
+		outputEl.s3 = a.s3 ^ b.s3;
+		shr_4(outputEl, 25);
+
+		// 87 bit payload plus 2*14 bit index and 13 bit bucket
+		outputEl.s3 = own | (oth << 14) | (bucket << 28);
+		outputEl.s2 |= (bucket >> 4) << 23;
+	} else {
+		uint32_t ofs = bucket*bucketSize;
+
+		outputEl.s2 = (round == 2) ? ((a.s2 ^ b.s2) & 0x7FFFFF) : 0;
+		outputEl.s3 = 0;
+		shr_4(outputEl, 25);
+
+		outputEl.s2 = ofs + own;
+		outputEl.s3 = ofs + oth;
+	}
+
+	uint32_t pos = counters[round*numBuckets + buck].fetch_add(1, memory_order_relaxed);
+	if (pos < bucketSize) {
+		buffers[outBuf[round]][buck*bucketSize+pos] = outputEl;
+	}
+}
+
+
+// Finds all pairs in a bucket that collide on the lower 12 bit, either by
+// chaining them in linked lists or by a counting sort on the collision bits
+void cpuSolver::collideBucket(uint32_t round, uint32_t bucket, vector<uint32_t> &heads, vector<uint32_t> &links) {
+	static const uint32_t inBuf[5]  = {0, 0, 1, 0, 2};
+
+	const cpuElement* input = &buffers[inBuf[round]][bucket*bucketSize];
+	uint32_t elements = min(counters[(round-1)*numBuckets + bucket].load(memory_order_relaxed), bucketSize);
+
+	if (!sortCollisions) {
+		heads.assign(4096, chainEnd);
+
+		for (uint32_t own=0; own<elements; own++) {
+			uint32_t key = input[own].s0 & 0xFFF;
+			links[own] = heads[key];
+			heads[key] = own;
+
+			for (uint32_t oth = links[own]; oth != chainEnd; oth = links[oth]) {
+				collidePair(round, bucket, input, own, oth);
+			}
+		}
+		return;
+	}
+
+	// Count the elements per key and turn the counts into run offsets
+	heads.assign(4096, 0);
+	for (uint32_t own=0; own<elements; own++) heads[input[own].s0 & 0xFFF]++;
+
+	uint32_t sum = 0;
+	for (uint32_t key=0; key<4096; key++) {
+		uint32_t cnt = heads[key];
+		heads[key] = sum;
+		sum += cnt;
+	}
+
+	// Stable scatter, afterwards heads holds the end of each run
+	for (uint32_t own=0; own<elements; own++) links[heads[input[own].s0 & 0xFFF]++] = own;
+
+	for (uint32_t start=0; start<elements; ) {
+		uint32_t end = heads[input[links[start]].s0 & 0xFFF];
+
+		for (uint32_t i=start+1; i<end; i++) {
+			for (uint32_t j=start; j<i; j++) {
+				collidePair(round, bucket, input, links[i], links[j]);
+			}
+		}
+		start = end;
+	}
+}
+
+
+// Resolves the index tree of a round 4 candidate and stores it if it is a valid solution
+void cpuSolver::combine(const cpuElement &candidate, vector< vector<uint32_t> > &solutions) {
+	uint32_t r2[4] = {candidate.s0, candidate.s1, candidate.s2, candidate.s3};
+	uint32_t r1[8];
+	uint32_t leafs[16];
+
+	for (uint32_t i=0; i<4; i++) {
+		const cpuElement &el = buffers[0][r2[i]];		// Output of round 2
+		r1[2*i]   = el.s2;
+		r1[2*i+1] = el.s3;
+	}
+
+	for (uint32_t i=0; i<8; i++) {
+		const cpuElement &el = buffers[1][r1[i]];		// Output of round 1
+		uint32_t bucket = ((el.s2 >> 23) << 4) | (el.s3 >> 28);
+
+		leafs[2*i]   = indexes[bucket*bucketSize + (el.s3 & 0x3FFF)];
+		leafs[2*i+1] = indexes[bucket*bucketSize + ((el.s3 >> 14) & 0x3FFF)];
+	}
+
+	// Only entry to itself may be equal
+	for (uint32_t i=0; i<16; i++) {
+		for (uint32_t j=i+1; j<16; j++) {
+			if (leafs[i] == leafs[j]) return;
+		}
+	}
+
+	// Do the Equihash element sorting
+	for (uint32_t width=1; width<16; width *= 2) {
+		for (uint32_t i=0; i<16; i += 2*width) {
+			if (leafs[i] > leafs[i+width]) {
+				for (uint32_t j=0; j<width; j++) swap(leafs[i+j], leafs[i+width+j]);
+			}
+		}
+	}
+
+	solutions.push_back(vector<uint32_t>(leafs, leafs+16));
+}
+
+
+void cpuSolver::setup(uint32_t threadsIn) {
+	threads = threadsIn;
+	if (threads == 0) threads = max<uint32_t>(1, thread::hardware_concurrency());
+
+	for (uint32_t i=0; i<3; i++) buffers[i].resize(numBuckets*bucketSize);
+	indexes.resize(numBuckets*bucketSize);
+
+	counters = vector< atomic<uint32_t> >(4*numBuckets);
+
+	// Chain heads and links for each thread
+	heads.assign(threads, vector<uint32_t>(4096));
+	links.assign(threads, vector<uint32_t>(bucketSize));
+}
+
+
+uint32_t cpuSolver::numThreads() {
+	return threads;
+}
+
+
+void cpuSolver::setCollisionSort(bool sort) {
+	sortCollisions = sort;
+}
+
+
+// Runs one full iteration of the solver for the given BLAKE2b state and nonce
+void cpuSolver::solve(const uint64_t* blakeStateIn, uint32_t nonceIn, vector< vector<uint32_t> > &solutions) {
+	memcpy(blakeState, blakeStateIn, sizeof(blakeState));
+	nonce = nonceIn;
+
+	for (uint32_t i=0; i<counters.size(); i++) counters[i].store(0, memory_order_relaxed);
+	candidates.clear();
+
+	parallelFor((1 << 24) / round0Chunk, [this] (uint32_t chunk, uint32_t) {
+		round0(chunk);
+	});
+
+	for (uint32_t round=1; round<=4; round++) {
+		parallelFor(numBuckets, [&] (uint32_t bucket, uint32_t t) {
+			collideBucket(round, bucket, heads[t], links[t]);
+		});
+	}
+
+	for (uint32_t i=0; i<candidates.size(); i++) {
+		combine(candidates[i], solutions);
+	}
+}
+
+
+// Checks a solution with the shared verifier. The kernels put the nonce into the last four bytes of
+// the 12 byte header tail, the eight bytes in front of it are zero.
+bool cpuSolver::verify(const uint64_t* blakeStateIn, uint32_t nonceIn, const uint32_t* indexes) {
+	uint8_t tail[12];
+	memset(tail, 0, sizeof(tail));
+	memcpy(&tail[8], &nonceIn, sizeof(nonceIn));
+
+	return verifyEquihash(blakeStateIn, tail, indexes);
+}
+
+}
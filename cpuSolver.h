@@ -0,0 +1,66 @@
+// ZelHash OpenCL Miner
+// Native CPU Solver for Equihash 125/4
+// Copyright 2019 Wilke Trei
+
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <cstdint>
+
+using namespace std;
+
+namespace zelMiner {
+
+#ifndef zelMinerCPU_H
+#define zelMinerCPU_H
+
+// Same layout as one uint4 element of the OpenCL kernel
+struct cpuElement {
+	uint32_t s0, s1, s2, s3;
+};
+
+class cpuSolver {
+	private:
+	uint32_t threads = 1;
+
+	// Element storage, used the same way as buffers 0-3 of the OpenCL kernel
+	vector<cpuElement> buffers[3];
+	vector<uint32_t> indexes;
+
+	// One bucket counter per bucket and round 0 - 3, round 4 candidates are collected in a list
+	vector< atomic<uint32_t> > counters;
+	vector<cpuElement> candidates;
+	mutex candidateMutex;
+
+	// Per thread scratch memory for the collision search, the sort
+	// strategy uses them as run offsets and sorted element order
+	bool sortCollisions = false;
+	vector< vector<uint32_t> > heads;
+	vector< vector<uint32_t> > links;
+
+	// Work of the current iteration
+	uint64_t blakeState[8];
+	uint32_t nonce;
+
+	void parallelFor(uint32_t, function<void(uint32_t, uint32_t)>);
+
+	void round0(uint32_t);
+	void collideBucket(uint32_t, uint32_t, vector<uint32_t>&, vector<uint32_t>&);
+	void collidePair(uint32_t, uint32_t, const cpuElement*, uint32_t, uint32_t);
+	void combine(const cpuElement&, vector< vector<uint32_t> >&);
+
+	public:
+	void setup(uint32_t);
+	uint32_t numThreads();
+	void setCollisionSort(bool);
+	void solve(const uint64_t*, uint32_t, vector< vector<uint32_t> >&);
+
+	// Checks 16 indexes from the hashes alone, without the element formats of the rounds
+	bool verify(const uint64_t*, uint32_t, const uint32_t*);
+};
+
+#endif
+
+}
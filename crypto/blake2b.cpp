@@ -72,6 +72,13 @@ void blake2bInstance::ret_state(uint64_t *out){
 	}
 }
 
+void blake2bInstance::set_state(const uint64_t *in, uint64_t bytesIn){
+	for (uint32_t i = 0; i < 8; i++) {
+		h[i] = in[i];
+	}
+	bytes = bytesIn;
+}
+
 blake2bInstance::blake2bInstance(const blake2bInstance &inp) {
 	bytes = inp.bytes;
 	for (int i=0; i<8; i++) h[i] = inp.h[i];
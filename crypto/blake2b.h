@@ -11,6 +11,7 @@ class blake2bInstance {
 		void update(const uint8_t*, uint32_t, uint32_t);//msg,msg_len,is_final
 		void ret_final(uint8_t*, uint32_t);		//out,out_len
 		void ret_state(uint64_t*);			//out
+		void set_state(const uint64_t*, uint64_t);	//state,bytes
 
 		blake2bInstance ();
 		blake2bInstance (const blake2bInstance &inp);
@@ -0,0 +1,212 @@
+// ZelHash OpenCL Miner
+// Multi lane BLAKE2b for the round 0 hash generation on CPU
+
+#include "blake2bLanes.h"
+#include "blake2b.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define BLAKE2B_LANES_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__)
+#define TARGET_AVX2   __attribute__((target("avx2")))
+#define TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define TARGET_AVX2
+#define TARGET_AVX512
+#endif
+
+// The message block only contains word1 at position 1, all other words are zero.
+// So the mixing only adds a message word when sigma selects position 1.
+#define blakeRounds(G) \
+	for (uint32_t round = 0; round < blake2b_rounds; round++) { \
+		const uint8_t *s = blake2b_sigma[round]; \
+		G(v[0], v[4], v[8],  v[12], s[0],  s[1]); \
+		G(v[1], v[5], v[9],  v[13], s[2],  s[3]); \
+		G(v[2], v[6], v[10], v[14], s[4],  s[5]); \
+		G(v[3], v[7], v[11], v[15], s[6],  s[7]); \
+		G(v[0], v[5], v[10], v[15], s[8],  s[9]); \
+		G(v[1], v[6], v[11], v[12], s[10], s[11]); \
+		G(v[2], v[7], v[8],  v[13], s[12], s[13]); \
+		G(v[3], v[4], v[9],  v[14], s[14], s[15]); \
+	}
+
+// length of data - 128 byte header + 16 byte second block
+static const uint64_t zelHashBytes = 144;
+
+
+static inline uint64_t rotr64(uint64_t a, uint32_t bits) {
+	return (a >> bits) | (a << (64 - bits));
+}
+
+#define gScalar(va, vb, vc, vd, x, y) \
+	va = va + vb + ((x == 1) ? word1 : 0); \
+	vd = rotr64(vd ^ va, 32); \
+	vc = vc + vd; \
+	vb = rotr64(vb ^ vc, 24); \
+	va = va + vb + ((y == 1) ? word1 : 0); \
+	vd = rotr64(vd ^ va, 16); \
+	vc = vc + vd; \
+	vb = rotr64(vb ^ vc, 63);
+
+static void zelHashScalar(const uint64_t* state, uint32_t nonce, uint32_t tId, uint64_t* out) {
+	uint64_t word1 = ((uint64_t) tId << 32) | nonce;
+	uint64_t v[16];
+
+	for (uint32_t i = 0; i < 8; i++) {
+		v[i] = state[i];
+		v[i+8] = blake2b_iv[i];
+	}
+	v[12] ^= zelHashBytes;
+	v[14] ^= (uint64_t) -1;
+
+	blakeRounds(gScalar)
+
+	for (uint32_t i = 0; i < 8; i++) {
+		out[i] = state[i] ^ v[i] ^ v[i+8];
+	}
+}
+
+
+#ifdef BLAKE2B_LANES_X86
+
+// 4 lanes with AVX2, rotations by 32, 24 and 16 bit are byte shuffles
+#define gAVX2(va, vb, vc, vd, x, y) \
+	va = _mm256_add_epi64(va, vb); \
+	if (x == 1) va = _mm256_add_epi64(va, word1); \
+	vd = _mm256_shuffle_epi32(_mm256_xor_si256(vd, va), 0xB1); \
+	vc = _mm256_add_epi64(vc, vd); \
+	vb = _mm256_shuffle_epi8(_mm256_xor_si256(vb, vc), rot24); \
+	va = _mm256_add_epi64(va, vb); \
+	if (y == 1) va = _mm256_add_epi64(va, word1); \
+	vd = _mm256_shuffle_epi8(_mm256_xor_si256(vd, va), rot16); \
+	vc = _mm256_add_epi64(vc, vd); \
+	vb = _mm256_xor_si256(vb, vc); \
+	vb = _mm256_or_si256(_mm256_srli_epi64(vb, 63), _mm256_add_epi64(vb, vb));
+
+TARGET_AVX2 static void zelHashAVX2(const uint64_t* state, uint32_t nonce, uint32_t tId, uint64_t* out) {
+	const __m256i rot24 = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+					       3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+	const __m256i rot16 = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+					       2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+
+	__m256i word1 = _mm256_set_epi64x(((uint64_t) (tId+3) << 32) | nonce, ((uint64_t) (tId+2) << 32) | nonce,
+					  ((uint64_t) (tId+1) << 32) | nonce, ((uint64_t) tId << 32) | nonce);
+	__m256i v[16];
+
+	for (uint32_t i = 0; i < 8; i++) {
+		v[i] = _mm256_set1_epi64x(state[i]);
+		v[i+8] = _mm256_set1_epi64x(blake2b_iv[i]);
+	}
+	v[12] = _mm256_xor_si256(v[12], _mm256_set1_epi64x(zelHashBytes));
+	v[14] = _mm256_xor_si256(v[14], _mm256_set1_epi64x(-1));
+
+	blakeRounds(gAVX2)
+
+	uint64_t tmp[4];
+	for (uint32_t i = 0; i < 8; i++) {
+		__m256i h = _mm256_xor_si256(_mm256_set1_epi64x(state[i]), _mm256_xor_si256(v[i], v[i+8]));
+		_mm256_storeu_si256((__m256i*) tmp, h);
+
+		for (uint32_t l = 0; l < 4; l++) out[8*l+i] = tmp[l];
+	}
+}
+
+
+// 8 lanes with AVX-512, which has a native 64 bit rotation
+#define gAVX512(va, vb, vc, vd, x, y) \
+	va = _mm512_add_epi64(va, vb); \
+	if (x == 1) va = _mm512_add_epi64(va, word1); \
+	vd = _mm512_ror_epi64(_mm512_xor_si512(vd, va), 32); \
+	vc = _mm512_add_epi64(vc, vd); \
+	vb = _mm512_ror_epi64(_mm512_xor_si512(vb, vc), 24); \
+	va = _mm512_add_epi64(va, vb); \
+	if (y == 1) va = _mm512_add_epi64(va, word1); \
+	vd = _mm512_ror_epi64(_mm512_xor_si512(vd, va), 16); \
+	vc = _mm512_add_epi64(vc, vd); \
+	vb = _mm512_ror_epi64(_mm512_xor_si512(vb, vc), 63);
+
+TARGET_AVX512 static void zelHashAVX512(const uint64_t* state, uint32_t nonce, uint32_t tId, uint64_t* out) {
+	__m512i lane = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+	__m512i word1 = _mm512_add_epi64(_mm512_set1_epi64(tId), lane);
+	word1 = _mm512_or_si512(_mm512_slli_epi64(word1, 32), _mm512_set1_epi64(nonce));
+
+	__m512i v[16];
+
+	for (uint32_t i = 0; i < 8; i++) {
+		v[i] = _mm512_set1_epi64(state[i]);
+		v[i+8] = _mm512_set1_epi64(blake2b_iv[i]);
+	}
+	v[12] = _mm512_xor_si512(v[12], _mm512_set1_epi64(zelHashBytes));
+	v[14] = _mm512_xor_si512(v[14], _mm512_set1_epi64(-1));
+
+	blakeRounds(gAVX512)
+
+	// Transpose by scattering each state word into the 8 outputs
+	__m512i stride = _mm512_set_epi64(56, 48, 40, 32, 24, 16, 8, 0);
+	for (uint32_t i = 0; i < 8; i++) {
+		__m512i h = _mm512_xor_si512(_mm512_set1_epi64(state[i]), _mm512_xor_si512(v[i], v[i+8]));
+		_mm512_i64scatter_epi64(out + i, stride, h, 8);
+	}
+}
+
+
+// Checks which vector extensions the CPU and OS support
+static uint32_t detectLanes() {
+#ifdef _MSC_VER
+	int info[4];
+	__cpuidex(info, 0, 0);
+	if (info[0] < 7) return 1;
+
+	__cpuidex(info, 1, 0);
+	if ((info[2] & (1 << 27)) == 0) return 1;			// OSXSAVE
+	uint64_t xcr0 = _xgetbv(0);
+
+	__cpuidex(info, 7, 0);
+	if ((info[1] & (1 << 16)) && ((xcr0 & 0xE6) == 0xE6)) return 8;	// AVX-512F and ZMM state
+	if ((info[1] & (1 << 5))  && ((xcr0 & 0x6) == 0x6))   return 4;	// AVX2 and YMM state
+	return 1;
+#else
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f")) return 8;
+	if (__builtin_cpu_supports("avx2")) return 4;
+	return 1;
+#endif
+}
+
+#else
+
+static uint32_t detectLanes() {
+	return 1;
+}
+
+#endif
+
+
+uint32_t blake2bZelLanes() {
+	static const uint32_t lanes = detectLanes();
+	return lanes;
+}
+
+
+void blake2bZelHashes(const uint64_t* state, uint32_t nonce, uint32_t tId, uint32_t count, uint64_t* out) {
+	uint32_t lanes = blake2bZelLanes();
+
+	for (uint32_t i = 0; i < count; i += lanes) {
+#ifdef BLAKE2B_LANES_X86
+		if (lanes == 8) {
+			zelHashAVX512(state, nonce, tId+i, out + 8*i);
+			continue;
+		}
+		if (lanes == 4) {
+			zelHashAVX2(state, nonce, tId+i, out + 8*i);
+			continue;
+		}
+#endif
+		zelHashScalar(state, nonce, tId+i, out + 8*i);
+	}
+}
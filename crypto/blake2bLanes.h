@@ -0,0 +1,18 @@
+// ZelHash OpenCL Miner
+// Multi lane BLAKE2b for the round 0 hash generation on CPU
+
+#ifndef __CRYPTO_BLAKE2B_LANES_H
+#define __CRYPTO_BLAKE2B_LANES_H
+
+#include <stdint.h>
+
+// Computes the 64 byte BLAKE2b outputs of work items tId ... tId+count-1 for the
+// ZelProof state of the first 128 header bytes. The second block only holds
+// word1 = tId<<32 | nonce, exactly like round0 of the OpenCL kernel does.
+// count must be a multiple of 8, out receives count*8 words (item major).
+void blake2bZelHashes(const uint64_t* state, uint32_t nonce, uint32_t tId, uint32_t count, uint64_t* out);
+
+// Number of lanes the function above will use on this CPU (8: AVX-512, 4: AVX2, 1: scalar)
+uint32_t blake2bZelLanes();
+
+#endif
@@ -0,0 +1,51 @@
+// ZelHash OpenCL Miner
+// Per Device Counters and Averaged Solution Rates
+
+#include "deviceStats.h"
+
+#include <cmath>
+
+namespace zelMiner {
+
+static const double windowSeconds[rateAverage::windows] = {0, 60, 300, 900};
+
+
+rateAverage::rateAverage() {
+	for (uint32_t i=0; i<windows; i++) rates[i] = 0;
+	lastTime = std::chrono::steady_clock::now();
+}
+
+
+void rateAverage::start(uint64_t count) {
+	lastCount = count;
+	lastTime = std::chrono::steady_clock::now();
+	averaged = false;
+	for (uint32_t i=0; i<windows; i++) rates[i] = 0;
+}
+
+
+void rateAverage::update(uint64_t count) {
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	double seconds = std::chrono::duration<double>(now - lastTime).count();
+	if (seconds <= 0) return;
+
+	double current = (double) (count - lastCount) / seconds;
+	lastCount = count;
+	lastTime = now;
+
+	rates[0] = current;
+
+	// The first interval is taken as it is, otherwise the averages need minutes to rise from 0
+	for (uint32_t i=1; i<windows; i++) {
+		double decay = exp(-seconds / windowSeconds[i]);
+		rates[i] = averaged ? (rates[i] * decay + current * (1.0 - decay)) : current;
+	}
+	averaged = true;
+}
+
+
+double rateAverage::rate(uint32_t window) const {
+	return rates[window];
+}
+
+}
@@ -0,0 +1,64 @@
+// ZelHash OpenCL Miner
+// Per Device Counters and Averaged Solution Rates
+// Copyright 2019 Wilke Trei
+
+#ifndef zelMinerDeviceStats_H
+#define zelMinerDeviceStats_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+using namespace std;
+
+namespace zelMiner {
+
+// Totals of one device, written by its result callbacks and read by the statistics
+// and metrics. Each device has its own cache line, so the callbacks of different
+// devices do not keep taking the line from each other.
+struct alignas(64) deviceCounters {
+	atomic<uint64_t> solutions;
+	atomic<uint64_t> iterations;
+	atomic<uint64_t> iterationNs;			// Sum of the time from queueing to the results
+	atomic<uint64_t> intervals;
+	atomic<uint64_t> intervalNs;			// Sum of the time between two finished iterations
+
+	deviceCounters() : solutions(0), iterations(0), iterationNs(0), intervals(0), intervalNs(0) { }
+
+	void addIteration(uint32_t sols, uint64_t ns) {
+		solutions.fetch_add(sols, memory_order_relaxed);
+		iterations.fetch_add(1, memory_order_relaxed);
+		iterationNs.fetch_add(ns, memory_order_relaxed);
+	}
+
+	void addInterval(uint64_t ns) {
+		intervals.fetch_add(1, memory_order_relaxed);
+		intervalNs.fetch_add(ns, memory_order_relaxed);
+	}
+};
+
+
+// Solution rate of the last interval and its exponentially weighted averages over
+// 1, 5 and 15 minutes, computed like the Unix load average. Updated by the statistics
+// loop only, the rates may be read from any thread.
+class rateAverage {
+	public:
+	static const uint32_t windows = 4;		// Last interval, 1, 5 and 15 minutes
+
+	private:
+	atomic<double> rates[windows];
+	uint64_t lastCount = 0;
+	std::chrono::steady_clock::time_point lastTime;
+	bool averaged = false;
+
+	public:
+	rateAverage();
+
+	void start(uint64_t);				// Counter total when mining starts
+	void update(uint64_t);				// Current counter total
+	double rate(uint32_t) const;
+};
+
+}
+
+#endif
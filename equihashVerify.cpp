@@ -0,0 +1,100 @@
+// ZelHash OpenCL Miner
+// Equihash 125/4 Solution Check
+
+#include "equihashVerify.h"
+#include "crypto/blake2b.h"
+
+#include <cstring>
+
+namespace zelMiner {
+
+// Swaps the order of bits in each byte from low to high endian, see kernel
+static inline uint32_t swapBitOrder(uint32_t input) {
+	uint32_t tmp = ((input & 0x0F0F0F0F) << 4) | ((input & 0xF0F0F0F0) >> 4);
+	tmp = ((tmp & 0x33333333) << 2) | ((tmp & 0xCCCCCCCC) >> 2);
+	return ((tmp & 0x55555555) << 1) | ((tmp & 0xAAAAAAAA) >> 1);
+}
+
+
+// The 125 bit string of an index. Work item tId hashes the header with tId appended, the
+// element is the running sum of the outputs within its group of 16 work items (see round0).
+static void indexElement(const blake2bInstance &midstate, const uint8_t* tail, uint32_t index, uint32_t* el) {
+	uint32_t tId = index >> 2;
+	uint32_t sum[16];
+	memset(sum, 0, sizeof(sum));
+
+	for (uint32_t t = (tId & ~15U); t <= tId; t++) {
+		uint8_t block[128];
+		memset(block, 0, 128);
+		memcpy(block, tail, 12);
+		memcpy(&block[12], &t, 4);
+
+		blake2bInstance inst(midstate);
+		inst.update(block, 16, 1);
+
+		uint32_t hash[16];
+		inst.ret_final((uint8_t*) hash, 64);
+		for (uint32_t i=0; i<16; i++) sum[i] += hash[i];
+	}
+
+	uint32_t i = index & 3;
+	for (uint32_t w=0; w<4; w++) el[w] = swapBitOrder(sum[4*i+w]);
+	el[3] &= 0x1FFFFFFF;
+}
+
+
+// True if the lowest bits of the 128 bit element are all zero
+static bool lowBitsZero(const uint32_t* el, uint32_t bits) {
+	for (uint32_t w=0; w<4; w++) {
+		if (bits >= 32*(w+1)) {
+			if (el[w] != 0) return false;
+		} else if (bits > 32*w) {
+			if ((el[w] & ((1U << (bits - 32*w)) - 1)) != 0) return false;
+		}
+	}
+	return true;
+}
+
+
+bool verifyEquihash(const uint64_t* state, const uint8_t* tail, const uint32_t* indexes) {
+	for (uint32_t i=0; i<16; i++) {
+		for (uint32_t j=i+1; j<16; j++) {
+			if (indexes[i] == indexes[j]) return false;
+		}
+	}
+
+	blake2bInstance midstate;
+	midstate.set_state(state, 128);
+
+	uint32_t el[16][4];
+	for (uint32_t i=0; i<16; i++) indexElement(midstate, tail, indexes[i], el[i]);
+
+	for (uint32_t round=1; round<=4; round++) {
+		uint32_t width = 1 << (round-1);
+
+		// Rounds 1 - 3 collide on 25 bits each, the last round on the remaining 50
+		uint32_t bits = (round == 4) ? 125 : 25*round;
+
+		for (uint32_t i=0; i<16; i += 2*width) {
+			if (indexes[i] >= indexes[i+width]) return false;
+
+			for (uint32_t w=0; w<4; w++) el[i][w] ^= el[i+width][w];
+			if (!lowBitsZero(el[i], bits)) return false;
+		}
+	}
+
+	return true;
+}
+
+
+bool verifyEquihash(const uint8_t* header, const uint32_t* indexes) {
+	blake2bInstance midstate;
+	midstate.init(64, 125, 4, "ZelProof");
+	midstate.update(header, 128, 0);
+
+	uint64_t state[8];
+	midstate.ret_state(state);
+	return verifyEquihash(state, &header[128], indexes);
+}
+
+}
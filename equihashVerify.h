@@ -0,0 +1,22 @@
+// ZelHash OpenCL Miner
+// Equihash 125/4 Solution Check
+// Copyright 2019 Wilke Trei
+
+#ifndef zelMinerEquihashVerify_H
+#define zelMinerEquihashVerify_H
+
+#include <cstdint>
+
+namespace zelMiner {
+
+// Checks 16 indexes from the BLAKE2b hashes alone: distinct, in Equihash order, colliding
+// on 25 more bits in every round and all 125 bits vanish after round 4. The hashes are
+// given by the BLAKE2b state after the first 128 header bytes and the last 12 header bytes.
+bool verifyEquihash(const uint64_t*, const uint8_t*, const uint32_t*);
+
+// Same for a whole 140 byte header
+bool verifyEquihash(const uint8_t*, const uint32_t*);
+
+}
+
+#endif
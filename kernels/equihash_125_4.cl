@@ -3,7 +3,61 @@
 // Copyright 2018 Wilke Trei
 
 
-#define bucketSize 8672
+// Each of the 2^13 buckets is split into 8 sub buckets by the 3 mask bits of the next round,
+// so every work group of round 1 - 4 only reads its own slice of the bucket.
+// The host may tune the sub bucket size, it must fit the 1216 entries of the scratch memory
+#ifndef subBucketSize
+#define subBucketSize 1120
+#endif
+#define bucketSize (8*subBucketSize)
+
+// The later rounds use trimmed element formats. Round 2 writes a 64 bit plane to the front
+// of buffer 0, the 59 bit payload without the 3 mask bits its sub bucket implies, and a
+// 32 bit plane behind it (treeOffset). The index pair takes 36 bits of both planes: the sub
+// bucket of round 1 and a 20 bit code of the two positions in it. Round 3 only stores the
+// 37 bit payload and the pointer to its first parent in 64 bits, combine finds the second
+// parent again by searching the round 2 payload.
+#define treeOffset (2*(bucketSize << 13))
+
+// Low memory build (MEM3G) for cards with 3 GB: round 1 stores its elements as two uint2
+// halves of buffer 1, the payload at [pos] and the index tree at [halfOffset+pos]. Round 3
+// then overwrites the payload half instead of using a third element buffer.
+#ifdef MEM3G
+#define splitElement uint2
+#define halfOffset (bucketSize << 13)
+#else
+#define splitElement uint4
+#endif
+
+// Maximal number of steps of the linked list walk per thread, can be tuned as well
+#ifndef chainCap
+#define chainCap 40
+#endif
+
+// Empty value of the collision table. The linked list matcher chains elements through
+// it, the sort based matcher (COLLISION_SORT) counts the elements per collision value.
+#ifdef COLLISION_SORT
+#define tabEmpty 0
+#else
+#define tabEmpty 0xFFF
+#endif
+
+// Instrumented build (LOSS_STATS): every dropped element, pair walk or solution is counted
+// behind the round 4 counter. clearCounter resets them with the other counters. The pairs
+// round 2 prunes for overlapping index trees are counted as well, they are no real loss.
+#define lossBase 262160
+#define lossBucket0 0		// Round 0 - 3 outputs beyond subBucketSize, one counter per round
+#define lossCandidates 4	// Round 4 candidates beyond 256
+#define lossChain1 5		// Round 1 - 4 list walks stopped by chainCap, one counter per round
+#define lossResults 9		// Solutions beyond the 20 of the result buffer
+#define lossPruned 10		// Round 2 pairs that share a round 0 element
+#define lossCount 11
+
+#ifdef LOSS_STATS
+#define countLoss(loss, type) atomic_inc(&(loss)[type])
+#else
+#define countLoss(loss, type)
+#endif
 
 
 __kernel void clearCounter (
@@ -89,14 +143,39 @@ vc = (vc + vd); \
 
 
 
+// Per iteration arguments. The host uploads them into a small constant buffer,
+// so all kernel arguments stay bound between iterations. Padded to 128 bytes.
+typedef struct {
+	ulong8 blake_state;
+	uint nonce;
+	uint epoch;			// Clean job epoch of the work, see jobEpoch
+	uint pad[14];
+} iterationParams;
+
+/*
+	jobEpoch is raised by the host through a second command queue while the kernels run,
+	once the pool sends a clean job. Rounds 0 - 4 compare it to the epoch of their iteration
+	and skip all work once it is newer, so the rest of a stale iteration drains quickly.
+	A jobEpoch lagging behind the iteration only means the host write is still pending.
+	The value is read once per work group, every thread of a group takes the same path.
+*/
+#define isStale(params, jobEpoch) (*(jobEpoch) > (params)->epoch)
+
 __kernel void round0(
 		__global uint4 * outputLo,
 		__global uint * outputHi,
 		__global uint * counters,
-		ulong8 blake_state,
-		uint nonce ) {
+		__constant iterationParams * params,
+		__global volatile uint * jobEpoch ) {
+
+	__local uint stale[1];
+	if (get_local_id(0) == 0) stale[0] = isStale(params, jobEpoch);
+	barrier(CLK_LOCAL_MEM_FENCE);
+	if (stale[0]) return;
 
 	uint tId = get_global_id(0);
+	ulong8 blake_state = params->blake_state;
+	uint nonce = params->nonce;
 
 	ulong word1 = ((ulong)tId << 32) | nonce;
        	ulong v[16];
@@ -272,13 +351,15 @@ __kernel void round0(
 	 					
 	output.s4 = (tId << 2); 
 	bucket = output.s0 & 0x1FFF;						// We will sort the element into 2^13 
-										// buckets of maximal size "bucketSize"	
+	output.lo = shr_4(output.lo,13);					// buckets, each split into 8 sub buckets
+	bucket = (bucket << 3) | (output.s0 & 0x7);				// of maximal size "subBucketSize"
 	pos = atomic_inc(&counters[bucket]);
-	output.lo = shr_4(output.lo,13);
 		
-	if (pos < bucketSize) {
-		outputLo[bucket*bucketSize+pos] = output.lo;
-		outputHi[bucket*bucketSize+pos] = output.s4;
+	if (pos < subBucketSize) {
+		outputLo[bucket*subBucketSize+pos] = output.lo;
+		outputHi[bucket*subBucketSize+pos] = output.s4;
+	} else {
+		countLoss(&counters[lossBase], lossBucket0);
 	}
 
 
@@ -289,13 +370,15 @@ __kernel void round0(
 	 					
 	output.s4 = (tId << 2)+1; 
 	bucket = output.s0 & 0x1FFF;						// We will sort the element into 2^13 
-										// buckets of maximal size "bucketSize"	
+	output.lo = shr_4(output.lo,13);					// buckets, each split into 8 sub buckets
+	bucket = (bucket << 3) | (output.s0 & 0x7);				// of maximal size "subBucketSize"
 	pos = atomic_inc(&counters[bucket]);
-	output.lo = shr_4(output.lo,13);
 		
-	if (pos < bucketSize) {
-		outputLo[bucket*bucketSize+pos] = output.lo;
-		outputHi[bucket*bucketSize+pos] = output.s4;
+	if (pos < subBucketSize) {
+		outputLo[bucket*subBucketSize+pos] = output.lo;
+		outputHi[bucket*subBucketSize+pos] = output.s4;
+	} else {
+		countLoss(&counters[lossBase], lossBucket0);
 	}
 
 
@@ -306,13 +389,15 @@ __kernel void round0(
 	 					
 	output.s4 = (tId << 2)+2; 
 	bucket = output.s0 & 0x1FFF;						// We will sort the element into 2^13 
-										// buckets of maximal size "bucketSize"	
+	output.lo = shr_4(output.lo,13);					// buckets, each split into 8 sub buckets
+	bucket = (bucket << 3) | (output.s0 & 0x7);				// of maximal size "subBucketSize"
 	pos = atomic_inc(&counters[bucket]);
-	output.lo = shr_4(output.lo,13);
 		
-	if (pos < bucketSize) {
-		outputLo[bucket*bucketSize+pos] = output.lo;
-		outputHi[bucket*bucketSize+pos] = output.s4;
+	if (pos < subBucketSize) {
+		outputLo[bucket*subBucketSize+pos] = output.lo;
+		outputHi[bucket*subBucketSize+pos] = output.s4;
+	} else {
+		countLoss(&counters[lossBase], lossBucket0);
 	}
 
 
@@ -323,28 +408,250 @@ __kernel void round0(
 	 					
 	output.s4 = (tId << 2)+3; 
 	bucket = output.s0 & 0x1FFF;						// We will sort the element into 2^13 
-										// buckets of maximal size "bucketSize"	
+	output.lo = shr_4(output.lo,13);					// buckets, each split into 8 sub buckets
+	bucket = (bucket << 3) | (output.s0 & 0x7);				// of maximal size "subBucketSize"
 	pos = atomic_inc(&counters[bucket]);
-	output.lo = shr_4(output.lo,13);
 		
-	if (pos < bucketSize) {
-		outputLo[bucket*bucketSize+pos] = output.lo;
-		outputHi[bucket*bucketSize+pos] = output.s4;
+	if (pos < subBucketSize) {
+		outputLo[bucket*subBucketSize+pos] = output.lo;
+		outputHi[bucket*subBucketSize+pos] = output.s4;
+	} else {
+		countLoss(&counters[lossBase], lossBucket0);
+	}
+}
+
+
+void masking4(uint4 input0, uint pos, uint id, __local uint* scratch, __local uint* tab) {
+#ifdef COLLISION_SORT
+	uint value  = atomic_inc(&tab[(input0.s0 >> 3) & 0x1FF]);		// Rank among the equal collision bits
+#else
+	uint value  = atomic_xchg(&tab[(input0.s0 >> 3) & 0x1FF], pos); 
+#endif
+	scratch[pos]      = input0.s0;	
+	scratch[1216+pos] = input0.s1;
+	scratch[2432+pos] = input0.s2;
+	scratch[3648+pos] = input0.s3;
+	scratch[4864+pos] = value; 					
+	scratch[6080+pos] = id;
+}
+
+
+#ifdef MEM3G
+uint4 loadRound2(__global uint2 * input, uint pos) {
+	return (uint4) (input[pos], input[halfOffset+pos]);
+}
+#else
+#define loadRound2(input, pos) (input)[pos]
+#endif
+
+// Restores the 62 bit payload, the mask bits are equal in a sub bucket and can stay 0
+uint4 loadRound3(__global uint2 * input, uint pos) {
+	uint2 elem = input[pos];
+	return (uint4) (elem.s0 << 3, ((elem.s1 & 0x7FFFFFF) << 3) | (elem.s0 >> 29), 0, 0);
+}
+
+// Upper 27 bits of s1 are the parent pointer, s3 is the own position for the candidates
+uint4 loadRound4(__global uint2 * input, uint pos) {
+	uint2 elem = input[pos];
+	return (uint4) (elem.s0, elem.s1 & 0x1F, elem.s1 >> 5, pos);
+}
+
+
+// Two different positions of a sub bucket as 20 bit code, the order does not matter
+uint pairCode(uint a, uint b) {
+	uint hi = max(a, b);
+	return ((hi * (hi-1)) >> 1) + min(a, b);
+}
+
+uint2 pairPositions(uint code) {
+	uint hi = (uint) ((1.0f + sqrt(1.0f + 8.0f * code)) * 0.5f);
+	while (((hi * (hi-1)) >> 1) > code) hi--;
+	while (((hi * (hi+1)) >> 1) <= code) hi++;
+	return (uint2) (hi, code - ((hi * (hi-1)) >> 1));
+}
+
+
+/*
+	Sorts the elements of the scratch memory by their 9 collision bits. masking4 already
+	counted the elements per collision value in tab and stored the rank of each element
+	among the equal values in the lower 16 bits of scratch4. An exclusive prefix sum over
+	tab gives the start of each run, the sorted order is stored in the upper 16 bits.
+*/
+void sortCollisions(__local uint* scratch, __local uint* tab, uint inLim) {
+	uint lId = get_local_id(0);
+	uint ofs = 1;
+
+	for (uint d = 256; d > 0; d >>= 1) {					// Up sweep
+		barrier(CLK_LOCAL_MEM_FENCE);
+		if (lId < d) tab[ofs*(2*lId+2)-1] += tab[ofs*(2*lId+1)-1];
+		ofs <<= 1;
+	}
+
+	barrier(CLK_LOCAL_MEM_FENCE);
+	if (lId == 0) tab[511] = 0;
+
+	for (uint d = 1; d < 512; d <<= 1) {					// Down sweep
+		ofs >>= 1;
+		barrier(CLK_LOCAL_MEM_FENCE);
+		if (lId < d) {
+			uint tmp = tab[ofs*(2*lId+1)-1];
+			tab[ofs*(2*lId+1)-1] = tab[ofs*(2*lId+2)-1];
+			tab[ofs*(2*lId+2)-1] += tmp;
+		}
+	}
+
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	for (uint p = lId; p < inLim; p += 256) {
+		uint sortPos = tab[(scratch[p] >> 3) & 0x1FF] + (scratch[4864+p] & 0xFFFF);
+		atomic_or(&scratch[4864+sortPos], p << 16);
+	}
+
+	barrier(CLK_LOCAL_MEM_FENCE);
+}
+
+
+void collide1(uint ownPos, uint othPos, __local uint* scratch, __global splitElement* output0, __global uint* outCounter, __global uint* loss, uint bucket) {
+	uint buck, pos;
+	uint8 outputEl;
+
+	outputEl.s0 = scratch[ownPos] ^ scratch[othPos];	
+	outputEl.s1 = scratch[1216+ownPos] ^ scratch[1216+othPos];
+	if (outputEl.s1 != 0) {
+		buck = (((outputEl.s0 >> 12) & 0x1FFF) << 3) | ((outputEl.s0 >> 25) & 0x7);	// Bucket and mask of next round
+		pos = atomic_inc(&outCounter[buck]);
+
+		outputEl.s2 = scratch[2432+ownPos] ^ scratch[2432+othPos];	
+		outputEl.s3 = scratch[3648+ownPos] ^ scratch[3648+othPos];
+
+		outputEl.lo = shr_4(outputEl.lo,25); 			// Shift away 25 bits
+
+		// Elements have 2*14 bit index plus 13 bit bucket
+		// So 125 - 25 - 13 = 87 bit payload plus 41 bit index tree
+		// 128 bit total - fit exactly one uint4 :D 
+
+		outputEl.s3 = scratch[6080+ownPos];
+		outputEl.s3 |= (scratch[6080+othPos] << 14);
+		outputEl.s3 |= (bucket << 28);
+
+		outputEl.s2 |= (bucket >> 4) << 23; 
+
+		if (pos < subBucketSize) {
+			pos += buck*subBucketSize;
+#ifdef MEM3G
+			output0[pos] = outputEl.s01;
+			output0[halfOffset+pos] = outputEl.s23;
+#else
+			output0[pos] = outputEl.lo;
+#endif
+		} else {
+			countLoss(loss, lossBucket0+1);
+		}
+	}
+}
+
+
+// Two round 1 elements with the same round 0 parent can never be part of a valid
+// solution. Their index trees are already in the scratch memory, so the test is free.
+bool sharesParent(uint ownPos, uint othPos, __local uint* scratch) {
+	uint own = scratch[3648+ownPos];
+	uint oth = scratch[3648+othPos];
+
+	// Bucket of round 0, upper 9 bits of s2 and upper 4 bits of s3
+	if ((((scratch[2432+ownPos] ^ scratch[2432+othPos]) >> 23) != 0) || (((own ^ oth) >> 28) != 0)) return false;
+
+	uint own0 = own & 0x3FFF, own1 = (own >> 14) & 0x3FFF;
+	uint oth0 = oth & 0x3FFF, oth1 = (oth >> 14) & 0x3FFF;
+	return (own0 == oth0) || (own0 == oth1) || (own1 == oth0) || (own1 == oth1);
+}
+
+
+void collide2(uint ownPos, uint othPos, __local uint* scratch, __global uint* output0, __global uint* outCounter, __global uint* loss, uint grp) {
+	uint buck, pos;
+	uint8 outputEl;
+
+	outputEl.s0 = scratch[ownPos] ^ scratch[othPos];	
+	outputEl.s1 = scratch[1216+ownPos] ^ scratch[1216+othPos];
+	if (outputEl.s1 != 0) {
+		if (sharesParent(ownPos, othPos, scratch)) {
+			countLoss(loss, lossPruned);
+			return;
+		}
+
+		buck = (((outputEl.s0 >> 12) & 0x1FFF) << 3) | ((outputEl.s0 >> 25) & 0x7);	// Bucket and mask of next round
+		pos = atomic_inc(&outCounter[buck]);
+
+		outputEl.s2 = (scratch[2432+ownPos] ^ scratch[2432+othPos]) & 0x7FFFFF;	
+		outputEl.s3 = 0;
+
+		outputEl.lo = shr_4(outputEl.lo,25); 			// Shift away 25 bits
+
+		// 62 - 3 = 59 bit payload plus 36 bit index pair, 96 bit total
+		uint tree = (grp << 20) | pairCode(ownPos, othPos);
+
+		outputEl.s2 = (outputEl.s0 >> 3) | (outputEl.s1 << 29);
+		outputEl.s3 = (outputEl.s1 >> 3) | ((grp >> 12) << 27);
+
+		if (pos < subBucketSize) {
+			pos += buck*subBucketSize;
+			((__global uint2 *) output0)[pos] = outputEl.s23;
+			output0[treeOffset+pos] = tree;
+		} else {
+			countLoss(loss, lossBucket0+2);
+		}
+	}
+}
+
+
+void collide3(uint ownPos, uint othPos, __local uint* scratch, __global uint2* output0, __global uint* outCounter, __global uint* loss) {
+	uint buck, pos;
+	uint8 outputEl;
+
+	outputEl.s0 = scratch[ownPos] ^ scratch[othPos];	
+	outputEl.s1 = scratch[1216+ownPos] ^ scratch[1216+othPos];
+	if (outputEl.s1 != 0) {
+		buck = (((outputEl.s0 >> 12) & 0x1FFF) << 3) | ((outputEl.s0 >> 25) & 0x7);	// Bucket and mask of next round
+		pos = atomic_inc(&outCounter[buck]);
+
+		outputEl.s2 = 0; 	
+		outputEl.s3 = 0;
+
+		outputEl.lo = shr_4(outputEl.lo,25); 			// Shift away 25 bits
+
+		outputEl.s2 = scratch[6080+ownPos]; 				// Only the first parent is stored
+
+		if (pos < subBucketSize) {
+			pos += buck*subBucketSize;
+			output0[pos] = (uint2) (outputEl.s0, outputEl.s1 | (outputEl.s2 << 5));	// 37 bit payload
+		} else {
+			countLoss(loss, lossBucket0+3);
+		}
 	}
 }
 
 
-void masking4(uint4 input0, uint id, __local uint* scratch, __local uint* tab , __local uint* cnt, uint mask) {
-	if ((input0.s0 & 0x7) == mask) {
-		uint pos = atomic_inc(&cnt[0]);
-		if (pos < 1216) {
-			uint value  = atomic_xchg(&tab[(input0.s0 >> 3) & 0x1FF], pos); 
-			scratch[pos]      = input0.s0;	
-			scratch[1216+pos] = input0.s1;
-			scratch[2432+pos] = input0.s2;
-			scratch[3648+pos] = input0.s3;
-			scratch[4864+pos] = value; 					
-			scratch[6080+pos] = id;
+void collide4(uint ownPos, uint othPos, __local uint* scratch, __global uint4* output0, __global uint* outCounter, __global uint* loss) {
+	uint pos;
+	uint2 outputEl;
+
+	outputEl.s0 = scratch[ownPos] ^ scratch[othPos];	
+	outputEl.s1 = scratch[1216+ownPos] ^ scratch[1216+othPos];
+	if ((outputEl.s0 == 0) && (outputEl.s1 == 0)) {			// Last round we want all bits to vanish
+		uint4 index;
+		index.s0 = scratch[2432+ownPos];
+		index.s1 = scratch[3648+ownPos];
+		index.s2 = scratch[2432+othPos];
+		index.s3 = scratch[3648+othPos];
+
+		bool ok = (index.s0 != index.s2);				// Parent pointer and own position of both elements
+
+		if (ok) {
+			pos = atomic_inc(&outCounter[0]);
+			if (pos < 256) {
+				output0[pos] = index;
+			} else {
+				countLoss(loss, lossCandidates);
+			}
 		}
 	}
 }
@@ -352,8 +659,10 @@ void masking4(uint4 input0, uint id, __local uint* scratch, __local uint* tab ,
 
 __kernel __attribute__((reqd_work_group_size(256, 1, 1))) void round1 (				// Round 1
 		__global uint4 * input0,
-		__global uint4 * output0,
-		__global uint * counters) {
+		__global splitElement * output0,
+		__global uint * counters,
+		__constant iterationParams * params,
+		__global volatile uint * jobEpoch) {
 	uint lId = get_local_id(0);
 	uint grp = get_group_id(0); 
 
@@ -370,133 +679,78 @@ __kernel __attribute__((reqd_work_group_size(256, 1, 1))) void round1 (				// Ro
 	__local uint * scratch5 = &scratch[6080];
 
 	__local uint tab[512];
-	__local uint iCNT[2];
+	__local uint iCNT[1];
 
 	__global uint * inCounter = &counters[0];
-	__global uint * outCounter = &counters[8192];
+	__global uint * outCounter = &counters[65536];
+	__global uint * loss = &counters[lossBase];
 
 	if (lId == 0) {
-		iCNT[1] = 0;
-		iCNT[0] = min(inCounter[bucket],(uint) bucketSize);
+		iCNT[0] = isStale(params, jobEpoch) ? 0 : min(inCounter[grp],(uint) subBucketSize);
 	} 
 
-	tab[lId] = 0xFFF;
-	tab[lId+256] = 0xFFF;
+	tab[lId] = tabEmpty;
+	tab[lId+256] = tabEmpty;
 
 	barrier(CLK_LOCAL_MEM_FENCE);
 
-	uint ofs = bucket*bucketSize;	
-
-	masking4(input0[ofs+lId], lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+256+lId], 256+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+512+lId], 512+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+768+lId], 768+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+1024+lId], 1024+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+1280+lId], 1280+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+1536+lId], 1536+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+1792+lId], 1792+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+2048+lId], 2048+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+2304+lId], 2304+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+2560+lId], 2560+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+2816+lId], 2816+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+3072+lId], 3072+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+3328+lId], 3328+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+3584+lId], 3584+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+3840+lId], 3840+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+4096+lId], 4096+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+4352+lId], 4352+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+4608+lId], 4608+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+4864+lId], 4864+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+5120+lId], 5120+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+5376+lId], 5376+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+5632+lId], 5632+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+5888+lId], 5888+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+6144+lId], 6144+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+6400+lId], 6400+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+6656+lId], 6656+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+6912+lId], 6912+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+7168+lId], 7168+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+7424+lId], 7424+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	if ((lId + 7680) < iCNT[0]) masking4(input0[ofs+7680+lId], 7680+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	if ((lId + 7936) < iCNT[0]) masking4(input0[ofs+7936+lId], 7936+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	if ((lId + 8192) < iCNT[0]) masking4(input0[ofs+8192+lId], 8192+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	if ((lId + 8448) < iCNT[0]) masking4(input0[ofs+8448+lId], 8448+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-		
-	barrier(CLK_LOCAL_MEM_FENCE);	
+	uint ofs = grp*subBucketSize;						// Only the slice of this mask is read
+	uint inLim = iCNT[0];
 
-	uint inLim = min(iCNT[1], (uint) 1216);
+	if (lId < inLim) masking4(input0[ofs+lId], lId, mask*subBucketSize+lId, &scratch[0], &tab[0]);
+	if ((lId + 256) < inLim) masking4(input0[ofs+256+lId], 256+lId, mask*subBucketSize+256+lId, &scratch[0], &tab[0]);
+	if ((lId + 512) < inLim) masking4(input0[ofs+512+lId], 512+lId, mask*subBucketSize+512+lId, &scratch[0], &tab[0]);
+	if ((lId + 768) < inLim) masking4(input0[ofs+768+lId], 768+lId, mask*subBucketSize+768+lId, &scratch[0], &tab[0]);
+	if ((lId + 1024) < inLim) masking4(input0[ofs+1024+lId], 1024+lId, mask*subBucketSize+1024+lId, &scratch[0], &tab[0]);
 
 	barrier(CLK_LOCAL_MEM_FENCE);
 
+#ifdef COLLISION_SORT
+	sortCollisions(&scratch[0], &tab[0], inLim);
+
+	for (uint sortPos = lId; sortPos < inLim; sortPos += 256) {
+		uint ownPos = scratch4[sortPos] >> 16;
+		uint runPos = sortPos - (scratch4[ownPos] & 0xFFFF);		// First element with equal collision bits
+
+		for (; runPos < sortPos; runPos++) {
+			collide1(ownPos, scratch4[runPos] >> 16, &scratch[0], output0, outCounter, loss, bucket);
+		}
+	}
+#else
 	uint ownPos = lId;
 	uint own = scratch4[ownPos];
 	uint othPos = own;
-	uint buck, pos;
 	uint cnt=0;
-
-	uint8 outputEl;
 	
 	while (ownPos < inLim) {
 		uint addr = (othPos < inLim) ? othPos : ownPos+256;
 		uint elem = scratch4[addr];
 		
 		if (othPos < inLim) {
-			outputEl.s0 = scratch0[ownPos] ^ scratch0[othPos];	
-			outputEl.s1 = scratch1[ownPos] ^ scratch1[othPos];
-			if (outputEl.s1 != 0) {
-				buck = (outputEl.s0 >> 12) & 0x1FFF;
-				pos = atomic_inc(&outCounter[buck]);
-
-				outputEl.s2 = scratch2[ownPos] ^ scratch2[othPos];	
-				outputEl.s3 = scratch3[ownPos] ^ scratch3[othPos];
-
-				outputEl.lo = shr_4(outputEl.lo,25); 			// Shift away 25 bits
-
-				// Elements have 2*14 bit index plus 13 bit bucket
-				// So 125 - 25 - 13 = 87 bit payload plus 41 bit index tree
-				// 128 bit total - fit exactly one uint4 :D 
-
-				outputEl.s3 = scratch5[ownPos];
-				outputEl.s3 |= (scratch5[othPos] << 14);
-				outputEl.s3 |= (bucket << 28);
-
-				outputEl.s2 |= (bucket >> 4) << 23; 
-
-				if (pos < bucketSize) {
-					pos += buck*bucketSize;
-					output0[pos] = outputEl.lo;
-				}
-			}
+			collide1(ownPos, othPos, &scratch[0], output0, outCounter, loss, bucket);
 		} else { 
 			own = elem;
 			ownPos += 256;
 		}
 
 		othPos = elem;
-		ownPos = (cnt<40) ? ownPos : inLim;
+		if ((cnt >= chainCap) && (ownPos < inLim)) countLoss(loss, lossChain1+0);
+		ownPos = (cnt<chainCap) ? ownPos : inLim;
 		cnt++;
 	} 
+#endif
 }
 
 
 __kernel __attribute__((reqd_work_group_size(256, 1, 1))) void round2 (				// Round 2
-		__global uint4 * input0,
-		__global uint4 * output0,
-		__global uint * counters) {
+		__global splitElement * input0,
+		__global uint * output0,
+		__global uint * counters,
+		__constant iterationParams * params,
+		__global volatile uint * jobEpoch) {
 	uint lId = get_local_id(0);
 	uint grp = get_group_id(0); 
 
-	uint bucket = grp >> 3;
-	uint mask = (grp & 7);
-
 	__local uint scratch[7296];
 	
 	__local uint * scratch0 = &scratch[0];
@@ -507,126 +761,78 @@ __kernel __attribute__((reqd_work_group_size(256, 1, 1))) void round2 (				// Ro
 	__local uint * scratch5 = &scratch[6080];
 
 	__local uint tab[512];
-	__local uint iCNT[2];
+	__local uint iCNT[1];
 
-	__global uint * inCounter = &counters[8192];
-	__global uint * outCounter = &counters[16384];
+	__global uint * inCounter = &counters[65536];
+	__global uint * outCounter = &counters[131072];
+	__global uint * loss = &counters[lossBase];
 
 	if (lId == 0) {
-		iCNT[1] = 0;
-		iCNT[0] = min(inCounter[bucket],(uint) bucketSize);
+		iCNT[0] = isStale(params, jobEpoch) ? 0 : min(inCounter[grp],(uint) subBucketSize);
 	} 
 
-	tab[lId] = 0xFFF;
-	tab[lId+256] = 0xFFF;
+	tab[lId] = tabEmpty;
+	tab[lId+256] = tabEmpty;
 
 	barrier(CLK_LOCAL_MEM_FENCE);
 
-	uint ofs = bucket*bucketSize;	
-
-	masking4(input0[ofs+lId], ofs+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+256+lId], ofs+256+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+512+lId], ofs+512+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+768+lId], ofs+768+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+1024+lId], ofs+1024+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+1280+lId], ofs+1280+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+1536+lId], ofs+1536+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+1792+lId], ofs+1792+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+2048+lId], ofs+2048+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+2304+lId], ofs+2304+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+2560+lId], ofs+2560+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+2816+lId], ofs+2816+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+3072+lId], ofs+3072+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+3328+lId], ofs+3328+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+3584+lId], ofs+3584+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+3840+lId], ofs+3840+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+4096+lId], ofs+4096+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+4352+lId], ofs+4352+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+4608+lId], ofs+4608+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+4864+lId], ofs+4864+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+5120+lId], ofs+5120+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+5376+lId], ofs+5376+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+5632+lId], ofs+5632+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+5888+lId], ofs+5888+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+6144+lId], ofs+6144+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+6400+lId], ofs+6400+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+6656+lId], ofs+6656+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+6912+lId], ofs+6912+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+7168+lId], ofs+7168+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+7424+lId], ofs+7424+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	if ((lId + 7680) < iCNT[0]) masking4(input0[ofs+7680+lId], ofs+7680+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	if ((lId + 7936) < iCNT[0]) masking4(input0[ofs+7936+lId], ofs+7936+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	if ((lId + 8192) < iCNT[0]) masking4(input0[ofs+8192+lId], ofs+8192+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	if ((lId + 8448) < iCNT[0]) masking4(input0[ofs+8448+lId], ofs+8448+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-		
-	barrier(CLK_LOCAL_MEM_FENCE);	
+	uint ofs = grp*subBucketSize;						// Only the slice of this mask is read
+	uint inLim = iCNT[0];
 
-	uint inLim = min(iCNT[1], (uint) 1216);
+	if (lId < inLim) masking4(loadRound2(input0, ofs+lId), lId, ofs+lId, &scratch[0], &tab[0]);
+	if ((lId + 256) < inLim) masking4(loadRound2(input0, ofs+256+lId), 256+lId, ofs+256+lId, &scratch[0], &tab[0]);
+	if ((lId + 512) < inLim) masking4(loadRound2(input0, ofs+512+lId), 512+lId, ofs+512+lId, &scratch[0], &tab[0]);
+	if ((lId + 768) < inLim) masking4(loadRound2(input0, ofs+768+lId), 768+lId, ofs+768+lId, &scratch[0], &tab[0]);
+	if ((lId + 1024) < inLim) masking4(loadRound2(input0, ofs+1024+lId), 1024+lId, ofs+1024+lId, &scratch[0], &tab[0]);
 
 	barrier(CLK_LOCAL_MEM_FENCE);
 
+#ifdef COLLISION_SORT
+	sortCollisions(&scratch[0], &tab[0], inLim);
+
+	for (uint sortPos = lId; sortPos < inLim; sortPos += 256) {
+		uint ownPos = scratch4[sortPos] >> 16;
+		uint runPos = sortPos - (scratch4[ownPos] & 0xFFFF);		// First element with equal collision bits
+
+		for (; runPos < sortPos; runPos++) {
+			collide2(ownPos, scratch4[runPos] >> 16, &scratch[0], output0, outCounter, loss, grp);
+		}
+	}
+#else
 	uint ownPos = lId;
 	uint own = scratch4[ownPos];
 	uint othPos = own;
-	uint buck, pos;
 	uint cnt=0;
-
-	uint8 outputEl;
 	
 	while (ownPos < inLim) {
 		uint addr = (othPos < inLim) ? othPos : ownPos+256;
 		uint elem = scratch4[addr];
 		
 		if (othPos < inLim) {
-			outputEl.s0 = scratch0[ownPos] ^ scratch0[othPos];	
-			outputEl.s1 = scratch1[ownPos] ^ scratch1[othPos];
-			if (outputEl.s1 != 0) {
-				buck = (outputEl.s0 >> 12) & 0x1FFF;
-				pos = atomic_inc(&outCounter[buck]);
-
-				outputEl.s2 = (scratch2[ownPos] ^ scratch2[othPos]) & 0x7FFFFF;	
-				outputEl.s3 = 0;
-
-				outputEl.lo = shr_4(outputEl.lo,25); 			// Shift away 25 bits
-
-				outputEl.s2 = scratch5[ownPos];
-				outputEl.s3 = scratch5[othPos];
-
-				if (pos < bucketSize) {
-					pos += buck*bucketSize;
-					output0[pos] = outputEl.lo;
-				}
-			}
+			collide2(ownPos, othPos, &scratch[0], output0, outCounter, loss, grp);
 		} else { 
 			own = elem;
 			ownPos += 256;
 		}
 
 		othPos = elem;
-		ownPos = (cnt<40) ? ownPos : inLim;
+		if ((cnt >= chainCap) && (ownPos < inLim)) countLoss(loss, lossChain1+1);
+		ownPos = (cnt<chainCap) ? ownPos : inLim;
 		cnt++;
 	} 
+#endif
 }
 
 
 __kernel __attribute__((reqd_work_group_size(256, 1, 1))) void round3 (				// Round 3
-		__global uint4 * input0,
-		__global uint4 * output0,
-		__global uint * counters) {
+		__global uint2 * input0,
+		__global uint2 * output0,
+		__global uint * counters,
+		__constant iterationParams * params,
+		__global volatile uint * jobEpoch) {
 	uint lId = get_local_id(0);
 	uint grp = get_group_id(0); 
 
-	uint bucket = grp >> 3;
-	uint mask = (grp & 7);
-
 	__local uint scratch[7296];
 	
 	__local uint * scratch0 = &scratch[0];
@@ -637,126 +843,78 @@ __kernel __attribute__((reqd_work_group_size(256, 1, 1))) void round3 (				// Ro
 	__local uint * scratch5 = &scratch[6080];
 
 	__local uint tab[512];
-	__local uint iCNT[2];
+	__local uint iCNT[1];
 
-	__global uint * inCounter = &counters[16384];
-	__global uint * outCounter = &counters[24576];
+	__global uint * inCounter = &counters[131072];
+	__global uint * outCounter = &counters[196608];
+	__global uint * loss = &counters[lossBase];
 
 	if (lId == 0) {
-		iCNT[1] = 0;
-		iCNT[0] = min(inCounter[bucket],(uint) bucketSize);
+		iCNT[0] = isStale(params, jobEpoch) ? 0 : min(inCounter[grp],(uint) subBucketSize);
 	} 
 
-	tab[lId] = 0xFFF;
-	tab[lId+256] = 0xFFF;
+	tab[lId] = tabEmpty;
+	tab[lId+256] = tabEmpty;
 
 	barrier(CLK_LOCAL_MEM_FENCE);
 
-	uint ofs = bucket*bucketSize;	
-
-	masking4(input0[ofs+lId], ofs+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+256+lId], ofs+256+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+512+lId], ofs+512+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+768+lId], ofs+768+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+1024+lId], ofs+1024+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+1280+lId], ofs+1280+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+1536+lId], ofs+1536+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+1792+lId], ofs+1792+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+2048+lId], ofs+2048+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+2304+lId], ofs+2304+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+2560+lId], ofs+2560+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+2816+lId], ofs+2816+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+3072+lId], ofs+3072+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+3328+lId], ofs+3328+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+3584+lId], ofs+3584+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+3840+lId], ofs+3840+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+4096+lId], ofs+4096+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+4352+lId], ofs+4352+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+4608+lId], ofs+4608+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+4864+lId], ofs+4864+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+5120+lId], ofs+5120+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+5376+lId], ofs+5376+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+5632+lId], ofs+5632+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+5888+lId], ofs+5888+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+6144+lId], ofs+6144+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+6400+lId], ofs+6400+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+6656+lId], ofs+6656+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+6912+lId], ofs+6912+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+7168+lId], ofs+7168+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	if ((lId + 7424) < iCNT[0]) masking4(input0[ofs+7424+lId], ofs+7424+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	if ((lId + 7680) < iCNT[0]) masking4(input0[ofs+7680+lId], ofs+7680+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	if ((lId + 7936) < iCNT[0]) masking4(input0[ofs+7936+lId], ofs+7936+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	if ((lId + 8192) < iCNT[0]) masking4(input0[ofs+8192+lId], ofs+8192+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	if ((lId + 8448) < iCNT[0]) masking4(input0[ofs+8448+lId], ofs+8448+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-		
-	barrier(CLK_LOCAL_MEM_FENCE);	
+	uint ofs = grp*subBucketSize;						// Only the slice of this mask is read
+	uint inLim = iCNT[0];
 
-	uint inLim = min(iCNT[1], (uint) 1216);
+	if (lId < inLim) masking4(loadRound3(input0, ofs+lId), lId, ofs+lId, &scratch[0], &tab[0]);
+	if ((lId + 256) < inLim) masking4(loadRound3(input0, ofs+256+lId), 256+lId, ofs+256+lId, &scratch[0], &tab[0]);
+	if ((lId + 512) < inLim) masking4(loadRound3(input0, ofs+512+lId), 512+lId, ofs+512+lId, &scratch[0], &tab[0]);
+	if ((lId + 768) < inLim) masking4(loadRound3(input0, ofs+768+lId), 768+lId, ofs+768+lId, &scratch[0], &tab[0]);
+	if ((lId + 1024) < inLim) masking4(loadRound3(input0, ofs+1024+lId), 1024+lId, ofs+1024+lId, &scratch[0], &tab[0]);
 
 	barrier(CLK_LOCAL_MEM_FENCE);
 
+#ifdef COLLISION_SORT
+	sortCollisions(&scratch[0], &tab[0], inLim);
+
+	for (uint sortPos = lId; sortPos < inLim; sortPos += 256) {
+		uint ownPos = scratch4[sortPos] >> 16;
+		uint runPos = sortPos - (scratch4[ownPos] & 0xFFFF);		// First element with equal collision bits
+
+		for (; runPos < sortPos; runPos++) {
+			collide3(ownPos, scratch4[runPos] >> 16, &scratch[0], output0, outCounter, loss);
+		}
+	}
+#else
 	uint ownPos = lId;
 	uint own = scratch4[ownPos];
 	uint othPos = own;
-	uint buck, pos;
 	uint cnt=0;
-
-	uint8 outputEl;
 	
 	while (ownPos < inLim) {
 		uint addr = (othPos < inLim) ? othPos : ownPos+256;
 		uint elem = scratch4[addr];
 		
 		if (othPos < inLim) {
-			outputEl.s0 = scratch0[ownPos] ^ scratch0[othPos];	
-			outputEl.s1 = scratch1[ownPos] ^ scratch1[othPos];
-			if (outputEl.s1 != 0) {
-				buck = (outputEl.s0 >> 12) & 0x1FFF;
-				pos = atomic_inc(&outCounter[buck]);
-
-				outputEl.s2 = 0; 	
-				outputEl.s3 = 0;
-
-				outputEl.lo = shr_4(outputEl.lo,25); 			// Shift away 25 bits
-
-				outputEl.s2 = scratch5[ownPos]; 
-				outputEl.s3 = scratch5[othPos]; 
-
-				if (pos < bucketSize) {
-					pos += buck*bucketSize;
-					output0[pos] = outputEl.lo;
-				}
-			}
+			collide3(ownPos, othPos, &scratch[0], output0, outCounter, loss);
 		} else { 
 			own = elem;
 			ownPos += 256;
 		}
 
 		othPos = elem;
-		ownPos = (cnt<40) ? ownPos : inLim;
+		if ((cnt >= chainCap) && (ownPos < inLim)) countLoss(loss, lossChain1+2);
+		ownPos = (cnt<chainCap) ? ownPos : inLim;
 		cnt++;
 	} 
+#endif
 }
 
 
 __kernel __attribute__((reqd_work_group_size(256, 1, 1))) void round4 (				// Round 4
-		__global uint4 * input0,
+		__global uint2 * input0,
 		__global uint4 * output0,
-		__global uint * counters) {
+		__global uint * counters,
+		__constant iterationParams * params,
+		__global volatile uint * jobEpoch) {
 	uint lId = get_local_id(0);
 	uint grp = get_group_id(0); 
 
-	uint bucket = grp >> 3;
-	uint mask = (grp & 7);
-
 	__local uint scratch[7296];
 	
 	__local uint * scratch0 = &scratch[0];
@@ -767,121 +925,73 @@ __kernel __attribute__((reqd_work_group_size(256, 1, 1))) void round4 (				// Ro
 	__local uint * scratch5 = &scratch[6080];
 
 	__local uint tab[512];
-	__local uint iCNT[2];
+	__local uint iCNT[1];
 
-	__global uint * inCounter = &counters[24576];
-	__global uint * outCounter = &counters[32768];
+	__global uint * inCounter = &counters[196608];
+	__global uint * outCounter = &counters[262144];
+	__global uint * loss = &counters[lossBase];
 
 	if (lId == 0) {
-		iCNT[1] = 0;
-		iCNT[0] = min(inCounter[bucket],(uint) bucketSize);
+		iCNT[0] = isStale(params, jobEpoch) ? 0 : min(inCounter[grp],(uint) subBucketSize);
 	} 
 
-	tab[lId] = 0xFFF;
-	tab[lId+256] = 0xFFF;
+	tab[lId] = tabEmpty;
+	tab[lId+256] = tabEmpty;
 
 	barrier(CLK_LOCAL_MEM_FENCE);
 
-	uint ofs = bucket*bucketSize;	
-
-	masking4(input0[ofs+lId], ofs+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+256+lId], ofs+256+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+512+lId], ofs+512+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+768+lId], ofs+768+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+1024+lId], ofs+1024+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+1280+lId], ofs+1280+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+1536+lId], ofs+1536+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+1792+lId], ofs+1792+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+2048+lId], ofs+2048+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+2304+lId], ofs+2304+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+2560+lId], ofs+2560+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+2816+lId], ofs+2816+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+3072+lId], ofs+3072+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+3328+lId], ofs+3328+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+3584+lId], ofs+3584+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+3840+lId], ofs+3840+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+4096+lId], ofs+4096+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+4352+lId], ofs+4352+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+4608+lId], ofs+4608+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+4864+lId], ofs+4864+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+5120+lId], ofs+5120+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+5376+lId], ofs+5376+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+5632+lId], ofs+5632+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+5888+lId], ofs+5888+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+6144+lId], ofs+6144+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+6400+lId], ofs+6400+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+6656+lId], ofs+6656+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+6912+lId], ofs+6912+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	masking4(input0[ofs+7168+lId], ofs+7168+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	masking4(input0[ofs+7424+lId], ofs+7424+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	if ((lId + 7680) < iCNT[0]) masking4(input0[ofs+7680+lId], ofs+7680+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	if ((lId + 7936) < iCNT[0]) masking4(input0[ofs+7936+lId], ofs+7936+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-
-	if ((lId + 8192) < iCNT[0]) masking4(input0[ofs+8192+lId], ofs+8192+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-	if ((lId + 8448) < iCNT[0]) masking4(input0[ofs+8448+lId], ofs+8448+lId, &scratch[0], &tab[0], &iCNT[1], mask);
-		
-	barrier(CLK_LOCAL_MEM_FENCE);	
+	uint ofs = grp*subBucketSize;						// Only the slice of this mask is read
+	uint inLim = iCNT[0];
 
-	uint inLim = min(iCNT[1], (uint) 1216);
+	if (lId < inLim) masking4(loadRound4(input0, ofs+lId), lId, ofs+lId, &scratch[0], &tab[0]);
+	if ((lId + 256) < inLim) masking4(loadRound4(input0, ofs+256+lId), 256+lId, ofs+256+lId, &scratch[0], &tab[0]);
+	if ((lId + 512) < inLim) masking4(loadRound4(input0, ofs+512+lId), 512+lId, ofs+512+lId, &scratch[0], &tab[0]);
+	if ((lId + 768) < inLim) masking4(loadRound4(input0, ofs+768+lId), 768+lId, ofs+768+lId, &scratch[0], &tab[0]);
+	if ((lId + 1024) < inLim) masking4(loadRound4(input0, ofs+1024+lId), 1024+lId, ofs+1024+lId, &scratch[0], &tab[0]);
 
 	barrier(CLK_LOCAL_MEM_FENCE);
 
+#ifdef COLLISION_SORT
+	sortCollisions(&scratch[0], &tab[0], inLim);
+
+	for (uint sortPos = lId; sortPos < inLim; sortPos += 256) {
+		uint ownPos = scratch4[sortPos] >> 16;
+		uint runPos = sortPos - (scratch4[ownPos] & 0xFFFF);		// First element with equal collision bits
+
+		for (; runPos < sortPos; runPos++) {
+			collide4(ownPos, scratch4[runPos] >> 16, &scratch[0], output0, outCounter, loss);
+		}
+	}
+#else
 	uint ownPos = lId;
 	uint own = scratch4[ownPos];
 	uint othPos = own;
-	uint buck, pos;
 	uint cnt=0;
-
-	uint2 outputEl;
 	
 	while (ownPos < inLim) {
 		uint addr = (othPos < inLim) ? othPos : ownPos+256;
 		uint elem = scratch4[addr];
 		
 		if (othPos < inLim) {
-			outputEl.s0 = scratch0[ownPos] ^ scratch0[othPos];	
-			outputEl.s1 = scratch1[ownPos] ^ scratch1[othPos];
-			if ((outputEl.s0 == 0) && (outputEl.s1 == 0)) {			// Last round we want all bits to vanish
-				uint4 index;
-				index.s0 = scratch2[ownPos];
-				index.s1 = scratch3[ownPos];
-				index.s2 = scratch2[othPos];
-				index.s3 = scratch3[othPos];
-
-				bool ok = true;
-				ok = ok && (index.s0 != index.s1) && (index.s0 != index.s2) && (index.s0 != index.s3);
-				ok = ok && (index.s1 != index.s2) && (index.s1 != index.s3) && (index.s2 != index.s3);	
-
-				if (ok) {
-					pos = atomic_inc(&outCounter[0]);
-					if (pos < 256) {
-						output0[pos] = index;
-					}
-				}
-			}
+			collide4(ownPos, othPos, &scratch[0], output0, outCounter, loss);
 		} else { 
 			own = elem;
 			ownPos += 256;
 		}
 
 		othPos = elem;
-		ownPos = (cnt<40) ? ownPos : inLim;
+		if ((cnt >= chainCap) && (ownPos < inLim)) countLoss(loss, lossChain1+3);
+		ownPos = (cnt<chainCap) ? ownPos : inLim;
 		cnt++;
 	} 
+#endif
 }
 
 
 __kernel __attribute__((reqd_work_group_size(16, 1, 1))) void combine (				// Combination round
-		__global uint4 * inputR2,
-		__global uint4 * inputR1,
-		__global uint4 * inputR3,
+		__global uint2 * inputR2,
+		__global splitElement * inputR1,
+		__global uint2 * inputR3,
 		__global uint  * inputR0,		
 		__global uint4 * inputR4,
 		__global uint * counters,
@@ -890,12 +1000,13 @@ __kernel __attribute__((reqd_work_group_size(16, 1, 1))) void combine (				// Co
 	 uint gId = get_group_id(0);
 	uint lId = get_local_id(0);
 
-	__global uint * inCounter = &counters[32768];
+	__global uint * inCounter = &counters[262144];
 	__global uint * outCounters = (__global uint*) &results[0];
 
 	__local uint scratch0[16];
 	__local uint scratch1[16];
 	__local uint ok[1];
+	__local uint parent[2];
 
 	if (gId < inCounter[0]) {
 		if (lId == 0) {
@@ -912,13 +1023,54 @@ __kernel __attribute__((reqd_work_group_size(16, 1, 1))) void combine (				// Co
 
 		barrier(CLK_LOCAL_MEM_FENCE); 
 
-		if (lId < 4) {								// Read the output of Round 2
+		if (lId < 2) parent[lId] = 0xFFFFFFFF;
+
+		barrier(CLK_LOCAL_MEM_FENCE);
+
+		{									// Find the second parent of both round 3 elements
+			uint e = lId >> 3;						// 8 work items search for each element
+			uint addr = scratch1[2*e];
+			uint pos = scratch1[2*e+1];
+
+			if ((addr < (bucketSize << 13)) && (pos < (bucketSize << 13))) {
+				uint2 elem = inputR3[pos];
+				uint2 own = inputR2[addr];
+
+				// The parents differ in the 37 bit payload and the bucket of round 3
+				uint2 diff;
+				diff.s0 = (elem.s0 << 25) | ((pos / bucketSize) << 12);
+				diff.s1 = (elem.s0 >> 7) | ((elem.s1 & 0x1F) << 25);
+
+				uint2 target;							// Without the mask bits
+				target.s0 = own.s0 ^ ((diff.s0 >> 3) | (diff.s1 << 29));
+				target.s1 = (own.s1 ^ (diff.s1 >> 3)) & 0x7FFFFFF;
+
+				uint grp = addr / subBucketSize;
+				uint cnt = min(counters[131072+grp], (uint) subBucketSize);
+
+				for (uint i = (lId & 7); i < cnt; i += 8) {
+					uint oth = grp*subBucketSize + i;
+					uint2 cand = inputR2[oth];
+					if ((oth != addr) && (cand.s0 == target.s0) && ((cand.s1 & 0x7FFFFFF) == target.s1)) atomic_min(&parent[e], oth);
+				}
+			}
+		}
+
+		barrier(CLK_LOCAL_MEM_FENCE);
+
+		if (lId < 2) scratch1[2*lId+1] = parent[lId];
+
+		barrier(CLK_LOCAL_MEM_FENCE);
+
+		if (lId < 4) {								// Read the index pairs of Round 2
 			uint addr = scratch1[lId];
 			if (addr < (bucketSize << 13)) {
-				uint4 tmp = inputR2[addr];
+				uint tree = ((__global uint *) inputR2)[treeOffset+addr];
+				uint grp = ((inputR2[addr].s1 >> 27) << 12) | (tree >> 20);
+				uint2 pair = pairPositions(tree & 0xFFFFF);
 				
-				scratch0[2*lId] = tmp.s2;	
-				scratch0[2*lId+1] = tmp.s3;	
+				scratch0[2*lId] = grp*subBucketSize + pair.s0;	
+				scratch0[2*lId+1] = grp*subBucketSize + pair.s1;	
 			}
 		}
 
@@ -927,7 +1079,11 @@ __kernel __attribute__((reqd_work_group_size(16, 1, 1))) void combine (				// Co
 		if (lId < 8) {								// Read the output of Round 1
 			uint addr = scratch0[lId];
 			if (addr < (bucketSize << 13)) {
+#ifdef MEM3G
+				uint4 tmp = (uint4) (0, 0, inputR1[halfOffset+addr]);
+#else
 				uint4 tmp = inputR1[addr];
+#endif
 
 				tmp.s0 = tmp.s3 & 0x3FFF;				// Unpack the representation
 				tmp.s1 = (tmp.s3 >> 14) & 0x3FFF;
@@ -1015,6 +1171,8 @@ __kernel __attribute__((reqd_work_group_size(16, 1, 1))) void combine (				// Co
 
 			addr = scratch1[0];
 
+			if ((addr >= 20) && (lId == 0)) countLoss(&counters[lossBase], lossResults);
+
 			if ((addr < 20) && (lId < 4)) {
 				uint4 tmp;
 				tmp.s0 = scratch0[4*lId];
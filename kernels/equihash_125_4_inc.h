@@ -7,255 +7,774 @@ unsigned char __equihash_125_4_cl[] = {
   0x68, 0x20, 0x31, 0x32, 0x35, 0x2f, 0x34, 0x0a, 0x2f, 0x2f, 0x20, 0x43,
   0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x32, 0x30, 0x31,
   0x38, 0x20, 0x57, 0x69, 0x6c, 0x6b, 0x65, 0x20, 0x54, 0x72, 0x65, 0x69,
-  0x0a, 0x0a, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x62,
-  0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x38, 0x36,
-  0x37, 0x32, 0x0a, 0x0a, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65,
-  0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72,
-  0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x28, 0x0a, 0x09, 0x09,
-  0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
-  0x74, 0x34, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
-  0x73, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61,
-  0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x2a, 0x20, 0x72, 0x65,
-  0x73, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x67, 0x49, 0x64, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c,
-  0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x67, 0x49,
-  0x64, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x29,
-  0x20, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x67, 0x49,
-  0x64, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09,
-  0x72, 0x65, 0x73, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x69,
-  0x6e, 0x74, 0x34, 0x29, 0x20, 0x30, 0x3b, 0x20, 0x0a, 0x09, 0x7d, 0x0a,
-  0x7d, 0x0a, 0x0a, 0x2f, 0x2a, 0x0a, 0x09, 0x54, 0x68, 0x69, 0x73, 0x20,
-  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x77, 0x61,
-  0x70, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72,
-  0x20, 0x6f, 0x66, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20,
-  0x65, 0x61, 0x63, 0x68, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x66, 0x72,
-  0x6f, 0x6d, 0x20, 0x6c, 0x6f, 0x77, 0x20, 0x74, 0x6f, 0x20, 0x68, 0x69,
-  0x67, 0x68, 0x20, 0x65, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2e, 0x0a, 0x09,
-  0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x71, 0x75,
-  0x69, 0x72, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x68, 0x61, 0x76,
-  0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x78, 0x6f, 0x72, 0x20,
-  0x62, 0x69, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x72, 0x69, 0x67, 0x68,
-  0x74, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20, 0x0a, 0x2a, 0x2f, 0x0a,
-  0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x73, 0x77, 0x61, 0x70, 0x42, 0x69, 0x74, 0x4f, 0x72, 0x64, 0x65, 0x72,
-  0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29,
-  0x20, 0x7b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x6d, 0x70,
-  0x30, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x26, 0x20,
-  0x30, 0x78, 0x30, 0x46, 0x30, 0x46, 0x30, 0x46, 0x30, 0x46, 0x3b, 0x0a,
-  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x6d, 0x70, 0x31, 0x20, 0x3d,
-  0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46,
-  0x30, 0x46, 0x30, 0x46, 0x30, 0x46, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x74,
-  0x6d, 0x70, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x30, 0x20, 0x3c,
-  0x3c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x31, 0x20, 0x3d,
-  0x20, 0x74, 0x6d, 0x70, 0x31, 0x20, 0x3e, 0x3e, 0x20, 0x34, 0x3b, 0x0a,
-  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x6d, 0x70, 0x49, 0x6e,
-  0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x30, 0x20, 0x7c, 0x20, 0x74, 0x6d,
-  0x70, 0x31, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x30, 0x20,
-  0x3d, 0x20, 0x74, 0x6d, 0x70, 0x49, 0x6e, 0x20, 0x26, 0x20, 0x30, 0x78,
-  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3b, 0x0a, 0x09, 0x74,
-  0x6d, 0x70, 0x31, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x49, 0x6e, 0x20,
-  0x26, 0x20, 0x30, 0x78, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-  0x3b, 0x0a, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x30, 0x20, 0x3d, 0x20, 0x74,
-  0x6d, 0x70, 0x30, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x3b, 0x0a, 0x09, 0x74,
-  0x6d, 0x70, 0x31, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x31, 0x20, 0x3e,
-  0x3e, 0x20, 0x32, 0x3b, 0x0a, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x49, 0x6e,
-  0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x30, 0x20, 0x7c, 0x20, 0x74, 0x6d,
-  0x70, 0x31, 0x3b, 0x0a, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x30, 0x20, 0x3d,
-  0x20, 0x74, 0x6d, 0x70, 0x49, 0x6e, 0x20, 0x26, 0x20, 0x30, 0x78, 0x35,
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3b, 0x0a, 0x09, 0x74, 0x6d,
+  0x0a, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x32, 0x5e, 0x31, 0x33, 0x20, 0x62,
+  0x75, 0x63, 0x6b, 0x65, 0x74, 0x73, 0x20, 0x69, 0x73, 0x20, 0x73, 0x70,
+  0x6c, 0x69, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x38, 0x20, 0x73,
+  0x75, 0x62, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x73, 0x20, 0x62,
+  0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x33, 0x20, 0x6d, 0x61, 0x73, 0x6b,
+  0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2c,
+  0x0a, 0x2f, 0x2f, 0x20, 0x73, 0x6f, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79,
+  0x20, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20,
+  0x6f, 0x66, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x31, 0x20, 0x2d,
+  0x20, 0x34, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x61, 0x64,
+  0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x73, 0x6c,
+  0x69, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+  0x75, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x0a, 0x2f, 0x2f, 0x20, 0x54, 0x68,
+  0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x74,
+  0x75, 0x6e, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x20,
+  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x2c,
+  0x20, 0x69, 0x74, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x66, 0x69, 0x74,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x32, 0x31, 0x36, 0x20, 0x65, 0x6e,
+  0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x20, 0x6d, 0x65, 0x6d,
+  0x6f, 0x72, 0x79, 0x0a, 0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x20,
+  0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a,
+  0x65, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x73, 0x75,
+  0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x20,
+  0x31, 0x31, 0x32, 0x30, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a,
+  0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x62, 0x75, 0x63, 0x6b,
+  0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x28, 0x38, 0x2a, 0x73, 0x75,
+  0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x29,
+  0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x74,
+  0x65, 0x72, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x20, 0x75, 0x73,
+  0x65, 0x20, 0x74, 0x72, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x20, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
+  0x73, 0x2e, 0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x32, 0x20, 0x77,
+  0x72, 0x69, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x36, 0x34, 0x20, 0x62,
+  0x69, 0x74, 0x20, 0x70, 0x6c, 0x61, 0x6e, 0x65, 0x20, 0x74, 0x6f, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6e, 0x74, 0x0a, 0x2f, 0x2f,
+  0x20, 0x6f, 0x66, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x30,
+  0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x35, 0x39, 0x20, 0x62, 0x69, 0x74,
+  0x20, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x6f, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x33, 0x20, 0x6d,
+  0x61, 0x73, 0x6b, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x69, 0x74, 0x73,
+  0x20, 0x73, 0x75, 0x62, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20,
+  0x69, 0x6d, 0x70, 0x6c, 0x69, 0x65, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x61, 0x0a, 0x2f, 0x2f, 0x20, 0x33, 0x32, 0x20, 0x62, 0x69, 0x74,
+  0x20, 0x70, 0x6c, 0x61, 0x6e, 0x65, 0x20, 0x62, 0x65, 0x68, 0x69, 0x6e,
+  0x64, 0x20, 0x69, 0x74, 0x20, 0x28, 0x74, 0x72, 0x65, 0x65, 0x4f, 0x66,
+  0x66, 0x73, 0x65, 0x74, 0x29, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x69,
+  0x6e, 0x64, 0x65, 0x78, 0x20, 0x70, 0x61, 0x69, 0x72, 0x20, 0x74, 0x61,
+  0x6b, 0x65, 0x73, 0x20, 0x33, 0x36, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x70, 0x6c, 0x61, 0x6e,
+  0x65, 0x73, 0x3a, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x0a,
+  0x2f, 0x2f, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x31, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x61, 0x20, 0x32, 0x30, 0x20, 0x62, 0x69, 0x74, 0x20, 0x63, 0x6f,
+  0x64, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x77,
+  0x6f, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20,
+  0x69, 0x6e, 0x20, 0x69, 0x74, 0x2e, 0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64,
+  0x20, 0x33, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x73, 0x74, 0x6f, 0x72,
+  0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x2f, 0x2f, 0x20, 0x33, 0x37,
+  0x20, 0x62, 0x69, 0x74, 0x20, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x69,
+  0x6e, 0x74, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x74, 0x73, 0x20,
+  0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74,
+  0x20, 0x69, 0x6e, 0x20, 0x36, 0x34, 0x20, 0x62, 0x69, 0x74, 0x73, 0x2c,
+  0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x20, 0x66, 0x69, 0x6e,
+  0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e,
+  0x64, 0x0a, 0x2f, 0x2f, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x20,
+  0x61, 0x67, 0x61, 0x69, 0x6e, 0x20, 0x62, 0x79, 0x20, 0x73, 0x65, 0x61,
+  0x72, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+  0x6f, 0x75, 0x6e, 0x64, 0x20, 0x32, 0x20, 0x70, 0x61, 0x79, 0x6c, 0x6f,
+  0x61, 0x64, 0x2e, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20,
+  0x74, 0x72, 0x65, 0x65, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x28,
+  0x32, 0x2a, 0x28, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a,
+  0x65, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x33, 0x29, 0x29, 0x0a, 0x0a, 0x2f,
+  0x2f, 0x20, 0x4c, 0x6f, 0x77, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79,
+  0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x28, 0x4d, 0x45, 0x4d, 0x33,
+  0x47, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x61, 0x72, 0x64, 0x73,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x33, 0x20, 0x47, 0x42, 0x3a, 0x20,
+  0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x31, 0x20, 0x73, 0x74, 0x6f, 0x72,
+  0x65, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x73, 0x20, 0x61, 0x73, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x32, 0x0a, 0x2f, 0x2f, 0x20, 0x68, 0x61, 0x6c, 0x76,
+  0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+  0x20, 0x31, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x79, 0x6c,
+  0x6f, 0x61, 0x64, 0x20, 0x61, 0x74, 0x20, 0x5b, 0x70, 0x6f, 0x73, 0x5d,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64,
+  0x65, 0x78, 0x20, 0x74, 0x72, 0x65, 0x65, 0x20, 0x61, 0x74, 0x20, 0x5b,
+  0x68, 0x61, 0x6c, 0x66, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2b, 0x70,
+  0x6f, 0x73, 0x5d, 0x2e, 0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x33,
+  0x0a, 0x2f, 0x2f, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x6f, 0x76, 0x65,
+  0x72, 0x77, 0x72, 0x69, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x68, 0x61, 0x6c, 0x66,
+  0x20, 0x69, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6f, 0x66, 0x20,
+  0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 0x74, 0x68, 0x69, 0x72,
+  0x64, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x62, 0x75,
+  0x66, 0x66, 0x65, 0x72, 0x2e, 0x0a, 0x23, 0x69, 0x66, 0x64, 0x65, 0x66,
+  0x20, 0x4d, 0x45, 0x4d, 0x33, 0x47, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x45, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x0a, 0x23, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x68, 0x61, 0x6c, 0x66, 0x4f, 0x66,
+  0x66, 0x73, 0x65, 0x74, 0x20, 0x28, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
+  0x53, 0x69, 0x7a, 0x65, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x33, 0x29, 0x0a,
+  0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x65, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x0a, 0x23, 0x65, 0x6e,
+  0x64, 0x69, 0x66, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x4d, 0x61, 0x78, 0x69,
+  0x6d, 0x61, 0x6c, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f,
+  0x66, 0x20, 0x73, 0x74, 0x65, 0x70, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x65, 0x64, 0x20, 0x6c, 0x69,
+  0x73, 0x74, 0x20, 0x77, 0x61, 0x6c, 0x6b, 0x20, 0x70, 0x65, 0x72, 0x20,
+  0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x2c, 0x20, 0x63, 0x61, 0x6e, 0x20,
+  0x62, 0x65, 0x20, 0x74, 0x75, 0x6e, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20,
+  0x77, 0x65, 0x6c, 0x6c, 0x0a, 0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66,
+  0x20, 0x63, 0x68, 0x61, 0x69, 0x6e, 0x43, 0x61, 0x70, 0x0a, 0x23, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x63, 0x68, 0x61, 0x69, 0x6e, 0x43,
+  0x61, 0x70, 0x20, 0x34, 0x30, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66,
+  0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x45, 0x6d, 0x70, 0x74, 0x79, 0x20, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x63, 0x6f, 0x6c, 0x6c, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x61,
+  0x62, 0x6c, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x6e,
+  0x6b, 0x65, 0x64, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x65, 0x72, 0x20, 0x63, 0x68, 0x61, 0x69, 0x6e, 0x73, 0x20,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x74, 0x68, 0x72,
+  0x6f, 0x75, 0x67, 0x68, 0x0a, 0x2f, 0x2f, 0x20, 0x69, 0x74, 0x2c, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x20, 0x62, 0x61, 0x73,
+  0x65, 0x64, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x72, 0x20, 0x28,
+  0x43, 0x4f, 0x4c, 0x4c, 0x49, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x53, 0x4f,
+  0x52, 0x54, 0x29, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20,
+  0x70, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x69, 0x73, 0x69, 0x6f,
+  0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x0a, 0x23, 0x69, 0x66,
+  0x64, 0x65, 0x66, 0x20, 0x43, 0x4f, 0x4c, 0x4c, 0x49, 0x53, 0x49, 0x4f,
+  0x4e, 0x5f, 0x53, 0x4f, 0x52, 0x54, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x20, 0x74, 0x61, 0x62, 0x45, 0x6d, 0x70, 0x74, 0x79, 0x20,
+  0x30, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x23, 0x64, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x20, 0x74, 0x61, 0x62, 0x45, 0x6d, 0x70, 0x74, 0x79,
+  0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69,
+  0x66, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x49, 0x6e, 0x73, 0x74, 0x72, 0x75,
+  0x6d, 0x65, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64,
+  0x20, 0x28, 0x4c, 0x4f, 0x53, 0x53, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x53,
+  0x29, 0x3a, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x64, 0x72, 0x6f,
+  0x70, 0x70, 0x65, 0x64, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x2c, 0x20, 0x70, 0x61, 0x69, 0x72, 0x20, 0x77, 0x61, 0x6c, 0x6b, 0x20,
+  0x6f, 0x72, 0x20, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x69, 0x73, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x64, 0x0a, 0x2f,
+  0x2f, 0x20, 0x62, 0x65, 0x68, 0x69, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x34, 0x20, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x65, 0x72, 0x2e, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x43,
+  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74,
+  0x73, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20,
+  0x70, 0x61, 0x69, 0x72, 0x73, 0x0a, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x75,
+  0x6e, 0x64, 0x20, 0x32, 0x20, 0x70, 0x72, 0x75, 0x6e, 0x65, 0x73, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x70, 0x70,
+  0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x74, 0x72,
+  0x65, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x77, 0x65, 0x6c, 0x6c, 0x2c,
+  0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x6f,
+  0x20, 0x72, 0x65, 0x61, 0x6c, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x2e, 0x0a,
+  0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x6c, 0x6f, 0x73, 0x73,
+  0x42, 0x61, 0x73, 0x65, 0x20, 0x32, 0x36, 0x32, 0x31, 0x36, 0x30, 0x0a,
+  0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x6c, 0x6f, 0x73, 0x73,
+  0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x30, 0x20, 0x30, 0x09, 0x09, 0x2f,
+  0x2f, 0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x30, 0x20, 0x2d, 0x20,
+  0x33, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x73, 0x20, 0x62, 0x65,
+  0x79, 0x6f, 0x6e, 0x64, 0x20, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b,
+  0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x70, 0x65, 0x72, 0x20,
+  0x72, 0x6f, 0x75, 0x6e, 0x64, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x65, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x43, 0x61, 0x6e, 0x64, 0x69, 0x64,
+  0x61, 0x74, 0x65, 0x73, 0x20, 0x34, 0x09, 0x2f, 0x2f, 0x20, 0x52, 0x6f,
+  0x75, 0x6e, 0x64, 0x20, 0x34, 0x20, 0x63, 0x61, 0x6e, 0x64, 0x69, 0x64,
+  0x61, 0x74, 0x65, 0x73, 0x20, 0x62, 0x65, 0x79, 0x6f, 0x6e, 0x64, 0x20,
+  0x32, 0x35, 0x36, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20,
+  0x6c, 0x6f, 0x73, 0x73, 0x43, 0x68, 0x61, 0x69, 0x6e, 0x31, 0x20, 0x35,
+  0x09, 0x09, 0x2f, 0x2f, 0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x31,
+  0x20, 0x2d, 0x20, 0x34, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x77, 0x61,
+  0x6c, 0x6b, 0x73, 0x20, 0x73, 0x74, 0x6f, 0x70, 0x70, 0x65, 0x64, 0x20,
+  0x62, 0x79, 0x20, 0x63, 0x68, 0x61, 0x69, 0x6e, 0x43, 0x61, 0x70, 0x2c,
+  0x20, 0x6f, 0x6e, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
+  0x20, 0x70, 0x65, 0x72, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x52,
+  0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x20, 0x39, 0x09, 0x09, 0x2f, 0x2f,
+  0x20, 0x53, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x62,
+  0x65, 0x79, 0x6f, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x32, 0x30,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75,
+  0x6c, 0x74, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x0a, 0x23, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x50, 0x72,
+  0x75, 0x6e, 0x65, 0x64, 0x20, 0x31, 0x30, 0x09, 0x09, 0x2f, 0x2f, 0x20,
+  0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x32, 0x20, 0x70, 0x61, 0x69, 0x72,
+  0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65,
+  0x20, 0x61, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x30, 0x20, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x43, 0x6f, 0x75, 0x6e, 0x74,
+  0x20, 0x31, 0x31, 0x0a, 0x0a, 0x23, 0x69, 0x66, 0x64, 0x65, 0x66, 0x20,
+  0x4c, 0x4f, 0x53, 0x53, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x53, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x4c, 0x6f, 0x73, 0x73, 0x28, 0x6c, 0x6f, 0x73, 0x73, 0x2c, 0x20, 0x74,
+  0x79, 0x70, 0x65, 0x29, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f,
+  0x69, 0x6e, 0x63, 0x28, 0x26, 0x28, 0x6c, 0x6f, 0x73, 0x73, 0x29, 0x5b,
+  0x74, 0x79, 0x70, 0x65, 0x5d, 0x29, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65,
+  0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x4c, 0x6f, 0x73, 0x73, 0x28, 0x6c, 0x6f, 0x73, 0x73, 0x2c,
+  0x20, 0x74, 0x79, 0x70, 0x65, 0x29, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69,
+  0x66, 0x0a, 0x0a, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c,
+  0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x43,
+  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x28, 0x0a, 0x09, 0x09, 0x5f,
+  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x34, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73,
+  0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x2a, 0x20, 0x72, 0x65, 0x73,
+  0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x67,
+  0x49, 0x64, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x67, 0x49, 0x64,
+  0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x29, 0x20,
+  0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x67, 0x49, 0x64,
+  0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x72,
+  0x65, 0x73, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x69, 0x6e,
+  0x74, 0x34, 0x29, 0x20, 0x30, 0x3b, 0x20, 0x0a, 0x09, 0x7d, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x2f, 0x2a, 0x0a, 0x09, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66,
+  0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x77, 0x61, 0x70,
+  0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20,
+  0x6f, 0x66, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x65,
+  0x61, 0x63, 0x68, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x20, 0x6c, 0x6f, 0x77, 0x20, 0x74, 0x6f, 0x20, 0x68, 0x69, 0x67,
+  0x68, 0x20, 0x65, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2e, 0x0a, 0x09, 0x54,
+  0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69,
+  0x72, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x68, 0x61, 0x76, 0x69,
+  0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x78, 0x6f, 0x72, 0x20, 0x62,
+  0x69, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74,
+  0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20, 0x0a, 0x2a, 0x2f, 0x0a, 0x69,
+  0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73,
+  0x77, 0x61, 0x70, 0x42, 0x69, 0x74, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x28,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x20,
+  0x7b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x6d, 0x70, 0x30,
+  0x20, 0x3d, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x26, 0x20, 0x30,
+  0x78, 0x30, 0x46, 0x30, 0x46, 0x30, 0x46, 0x30, 0x46, 0x3b, 0x0a, 0x09,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x6d, 0x70, 0x31, 0x20, 0x3d, 0x20,
+  0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x30,
+  0x46, 0x30, 0x46, 0x30, 0x46, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x74, 0x6d,
+  0x70, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x30, 0x20, 0x3c, 0x3c,
+  0x20, 0x34, 0x3b, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x31, 0x20, 0x3d, 0x20,
+  0x74, 0x6d, 0x70, 0x31, 0x20, 0x3e, 0x3e, 0x20, 0x34, 0x3b, 0x0a, 0x0a,
+  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x6d, 0x70, 0x49, 0x6e, 0x20,
+  0x3d, 0x20, 0x74, 0x6d, 0x70, 0x30, 0x20, 0x7c, 0x20, 0x74, 0x6d, 0x70,
+  0x31, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x30, 0x20, 0x3d,
+  0x20, 0x74, 0x6d, 0x70, 0x49, 0x6e, 0x20, 0x26, 0x20, 0x30, 0x78, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3b, 0x0a, 0x09, 0x74, 0x6d,
   0x70, 0x31, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x49, 0x6e, 0x20, 0x26,
-  0x20, 0x30, 0x78, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b,
+  0x20, 0x30, 0x78, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
   0x0a, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x6d,
-  0x70, 0x30, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x3b, 0x0a, 0x09, 0x74, 0x6d,
+  0x70, 0x30, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x3b, 0x0a, 0x09, 0x74, 0x6d,
   0x70, 0x31, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x31, 0x20, 0x3e, 0x3e,
-  0x20, 0x31, 0x3b, 0x0a, 0x0a, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
-  0x20, 0x74, 0x6d, 0x70, 0x30, 0x20, 0x7c, 0x20, 0x74, 0x6d, 0x70, 0x31,
-  0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x5f, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74,
-  0x61, 0x6e, 0x74, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x62, 0x6c,
-  0x61, 0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b, 0x5d, 0x20, 0x3d, 0x0a, 0x7b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x30, 0x78, 0x36, 0x61, 0x30, 0x39, 0x65,
-  0x36, 0x36, 0x37, 0x66, 0x33, 0x62, 0x63, 0x63, 0x39, 0x30, 0x38, 0x2c,
-  0x20, 0x30, 0x78, 0x62, 0x62, 0x36, 0x37, 0x61, 0x65, 0x38, 0x35, 0x38,
-  0x34, 0x63, 0x61, 0x61, 0x37, 0x33, 0x62, 0x2c, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x30, 0x78, 0x33, 0x63, 0x36, 0x65, 0x66, 0x33, 0x37, 0x32, 0x66,
-  0x65, 0x39, 0x34, 0x66, 0x38, 0x32, 0x62, 0x2c, 0x20, 0x30, 0x78, 0x61,
-  0x35, 0x34, 0x66, 0x66, 0x35, 0x33, 0x61, 0x35, 0x66, 0x31, 0x64, 0x33,
-  0x36, 0x66, 0x31, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x30, 0x78, 0x35,
-  0x31, 0x30, 0x65, 0x35, 0x32, 0x37, 0x66, 0x61, 0x64, 0x65, 0x36, 0x38,
-  0x32, 0x64, 0x31, 0x2c, 0x20, 0x30, 0x78, 0x39, 0x62, 0x30, 0x35, 0x36,
-  0x38, 0x38, 0x63, 0x32, 0x62, 0x33, 0x65, 0x36, 0x63, 0x31, 0x66, 0x2c,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x30, 0x78, 0x31, 0x66, 0x38, 0x33, 0x64,
-  0x39, 0x61, 0x62, 0x66, 0x62, 0x34, 0x31, 0x62, 0x64, 0x36, 0x62, 0x2c,
-  0x20, 0x30, 0x78, 0x35, 0x62, 0x65, 0x30, 0x63, 0x64, 0x31, 0x39, 0x31,
-  0x33, 0x37, 0x65, 0x32, 0x31, 0x37, 0x39, 0x2c, 0x0a, 0x7d, 0x3b, 0x0a,
-  0x0a, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x73, 0x68, 0x72, 0x5f,
-  0x34, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x68, 0x29, 0x20,
-  0x7b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x74, 0x6d, 0x70,
-  0x20, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x3e, 0x3e,
-  0x20, 0x73, 0x68, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x34,
-  0x20, 0x74, 0x6d, 0x70, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x32, 0x2d, 0x73, 0x68, 0x29,
-  0x3b, 0x0a, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x30, 0x31, 0x20,
-  0x7c, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x31, 0x32, 0x3b,
-  0x0a, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x32, 0x20, 0x20, 0x7c, 0x3d,
-  0x20, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x33, 0x3b, 0x0a, 0x0a, 0x09,
-  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x6d, 0x70, 0x3b, 0x0a,
-  0x7d, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x33, 0x32, 0x20, 0x62, 0x69, 0x74,
-  0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x20, 0x66, 0x75, 0x6e, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x62,
-  0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6f, 0x72,
-  0x6d, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x36, 0x34, 0x20, 0x62, 0x69, 0x74, 0x20, 0x62, 0x75,
-  0x69, 0x6c, 0x64, 0x69, 0x6e, 0x73, 0x20, 0x2a, 0x2f, 0x0a, 0x69, 0x6e,
-  0x6c, 0x69, 0x6e, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20,
-  0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x72, 0x6f, 0x72, 0x36, 0x34, 0x28,
-  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x20,
-  0x78, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x79, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32,
-  0x29, 0x28, 0x28, 0x28, 0x78, 0x29, 0x2e, 0x78, 0x3e, 0x3e, 0x79, 0x29,
-  0x5e, 0x28, 0x28, 0x78, 0x29, 0x2e, 0x79, 0x3c, 0x3c, 0x28, 0x33, 0x32,
-  0x2d, 0x79, 0x29, 0x29, 0x2c, 0x28, 0x28, 0x78, 0x29, 0x2e, 0x79, 0x3e,
-  0x3e, 0x79, 0x29, 0x5e, 0x28, 0x28, 0x78, 0x29, 0x2e, 0x78, 0x3c, 0x3c,
-  0x28, 0x33, 0x32, 0x2d, 0x79, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x7d, 0x0a,
-  0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69,
-  0x63, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x72, 0x6f, 0x72, 0x36,
-  0x34, 0x5f, 0x32, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69,
-  0x6e, 0x74, 0x32, 0x20, 0x78, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
-  0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x79, 0x29, 0x0a, 0x7b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x75,
-  0x69, 0x6e, 0x74, 0x32, 0x29, 0x28, 0x28, 0x28, 0x78, 0x29, 0x2e, 0x79,
-  0x3e, 0x3e, 0x28, 0x79, 0x2d, 0x33, 0x32, 0x29, 0x29, 0x5e, 0x28, 0x28,
-  0x78, 0x29, 0x2e, 0x78, 0x3c, 0x3c, 0x28, 0x36, 0x34, 0x2d, 0x79, 0x29,
-  0x29, 0x2c, 0x28, 0x28, 0x78, 0x29, 0x2e, 0x78, 0x3e, 0x3e, 0x28, 0x79,
-  0x2d, 0x33, 0x32, 0x29, 0x29, 0x5e, 0x28, 0x28, 0x78, 0x29, 0x2e, 0x79,
-  0x3c, 0x3c, 0x28, 0x36, 0x34, 0x2d, 0x79, 0x29, 0x29, 0x29, 0x3b, 0x0a,
-  0x7d, 0x0a, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x67,
-  0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x61, 0x2c, 0x20, 0x76, 0x62, 0x2c,
-  0x20, 0x76, 0x63, 0x2c, 0x20, 0x76, 0x64, 0x2c, 0x20, 0x78, 0x2c, 0x20,
-  0x79, 0x29, 0x20, 0x5c, 0x0a, 0x76, 0x61, 0x20, 0x3d, 0x20, 0x28, 0x76,
-  0x61, 0x20, 0x2b, 0x20, 0x76, 0x62, 0x20, 0x2b, 0x20, 0x78, 0x29, 0x3b,
-  0x20, 0x5c, 0x0a, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29,
-  0x26, 0x76, 0x64, 0x29, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x28,
-  0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x64, 0x29, 0x5b,
-  0x30, 0x5d, 0x2e, 0x79, 0x78, 0x20, 0x5e, 0x20, 0x28, 0x28, 0x75, 0x69,
-  0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x61, 0x29, 0x5b, 0x30, 0x5d,
-  0x2e, 0x79, 0x78, 0x3b, 0x20, 0x5c, 0x0a, 0x76, 0x63, 0x20, 0x3d, 0x20,
-  0x28, 0x76, 0x63, 0x20, 0x2b, 0x20, 0x76, 0x64, 0x29, 0x3b, 0x20, 0x5c,
-  0x0a, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76,
-  0x62, 0x29, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x72, 0x6f, 0x72, 0x36,
-  0x34, 0x28, 0x20, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29,
-  0x26, 0x76, 0x62, 0x29, 0x5b, 0x30, 0x5d, 0x20, 0x5e, 0x20, 0x28, 0x28,
-  0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x63, 0x29, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x32, 0x34, 0x55, 0x29, 0x3b, 0x20, 0x5c, 0x0a,
-  0x76, 0x61, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x61, 0x20, 0x2b, 0x20, 0x76,
-  0x62, 0x20, 0x2b, 0x20, 0x79, 0x29, 0x3b, 0x20, 0x5c, 0x0a, 0x28, 0x28,
-  0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x64, 0x29, 0x5b,
-  0x30, 0x5d, 0x20, 0x3d, 0x20, 0x72, 0x6f, 0x72, 0x36, 0x34, 0x28, 0x20,
-  0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x64,
-  0x29, 0x5b, 0x30, 0x5d, 0x20, 0x5e, 0x20, 0x28, 0x28, 0x75, 0x69, 0x6e,
-  0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x61, 0x29, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x31, 0x36, 0x55, 0x29, 0x3b, 0x20, 0x5c, 0x0a, 0x76, 0x63, 0x20,
-  0x3d, 0x20, 0x28, 0x76, 0x63, 0x20, 0x2b, 0x20, 0x76, 0x64, 0x29, 0x3b,
-  0x20, 0x5c, 0x0a, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29,
-  0x26, 0x76, 0x62, 0x29, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x72, 0x6f,
-  0x72, 0x36, 0x34, 0x5f, 0x32, 0x28, 0x20, 0x28, 0x28, 0x75, 0x69, 0x6e,
-  0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x62, 0x29, 0x5b, 0x30, 0x5d, 0x20,
-  0x5e, 0x20, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26,
-  0x76, 0x63, 0x29, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x36, 0x33, 0x55, 0x29,
-  0x3b, 0x0a, 0x0a, 0x0a, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65,
-  0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64,
-  0x30, 0x28, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61,
-  0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x2a, 0x20, 0x6f, 0x75,
-  0x74, 0x70, 0x75, 0x74, 0x4c, 0x6f, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f,
-  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x2a, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x48, 0x69, 0x2c, 0x0a,
-  0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
-  0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65,
-  0x72, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38,
-  0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x2c, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6e, 0x6f, 0x6e,
-  0x63, 0x65, 0x20, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x74, 0x49, 0x64, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f,
-  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29,
-  0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x6f,
-  0x72, 0x64, 0x31, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x75, 0x6c, 0x6f, 0x6e,
-  0x67, 0x29, 0x74, 0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x32, 0x29,
-  0x20, 0x7c, 0x20, 0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
-  0x76, 0x5b, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x2f, 0x2f, 0x20,
-  0x69, 0x6e, 0x69, 0x74, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20,
-  0x76, 0x0a, 0x09, 0x76, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c,
-  0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x30,
-  0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c,
-  0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x31,
-  0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x32, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c,
-  0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x32,
-  0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x33, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c,
-  0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x33,
-  0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x34, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c,
-  0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x34,
-  0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x35, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c,
-  0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x35,
-  0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x36, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c,
-  0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x36,
-  0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x37, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c,
-  0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x37,
-  0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x38, 0x5d, 0x20, 0x3d, 0x20, 0x20, 0x62,
-  0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b, 0x30, 0x5d, 0x3b, 0x0a,
-  0x09, 0x76, 0x5b, 0x39, 0x5d, 0x20, 0x3d, 0x20, 0x20, 0x62, 0x6c, 0x61,
-  0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x09, 0x76,
-  0x5b, 0x31, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65,
-  0x5f, 0x69, 0x76, 0x5b, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x31,
-  0x31, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x69,
-  0x76, 0x5b, 0x33, 0x5d, 0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x31, 0x32, 0x5d,
-  0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b,
-  0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x20, 0x3d,
-  0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b, 0x35, 0x5d,
-  0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x20, 0x3d, 0x20, 0x62,
-  0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b, 0x36, 0x5d, 0x3b, 0x0a,
-  0x09, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61,
-  0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b, 0x37, 0x5d, 0x3b, 0x0a, 0x09, 0x2f,
-  0x2f, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20,
-  0x64, 0x61, 0x74, 0x61, 0x20, 0x2d, 0x20, 0x33, 0x32, 0x20, 0x62, 0x79,
-  0x74, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x2b, 0x20, 0x38, 0x20,
-  0x62, 0x79, 0x74, 0x65, 0x20, 0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x2b,
-  0x20, 0x34, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65,
-  0x78, 0x0a, 0x09, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x20, 0x5e, 0x3d, 0x20,
-  0x31, 0x34, 0x34, 0x3b, 0x20, 0x0a, 0x09, 0x76, 0x5b, 0x31, 0x34, 0x5d,
-  0x20, 0x5e, 0x3d, 0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x2d,
-  0x31, 0x3b, 0x0a, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x75, 0x6e,
-  0x64, 0x20, 0x31, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c,
-  0x20, 0x30, 0x2c, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x31, 0x29, 0x3b, 0x0a,
-  0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c,
-  0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20,
-  0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76,
-  0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c,
-  0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75,
-  0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
-  0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d,
-  0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20,
-  0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c,
-  0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75,
-  0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b,
-  0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c,
-  0x20, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20,
-  0x30, 0x29, 0x3b, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x75, 0x6e,
-  0x64, 0x20, 0x32, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76,
+  0x20, 0x32, 0x3b, 0x0a, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x49, 0x6e, 0x20,
+  0x3d, 0x20, 0x74, 0x6d, 0x70, 0x30, 0x20, 0x7c, 0x20, 0x74, 0x6d, 0x70,
+  0x31, 0x3b, 0x0a, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x30, 0x20, 0x3d, 0x20,
+  0x74, 0x6d, 0x70, 0x49, 0x6e, 0x20, 0x26, 0x20, 0x30, 0x78, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3b, 0x0a, 0x09, 0x74, 0x6d, 0x70,
+  0x31, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x49, 0x6e, 0x20, 0x26, 0x20,
+  0x30, 0x78, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x0a,
+  0x0a, 0x09, 0x74, 0x6d, 0x70, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70,
+  0x30, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x3b, 0x0a, 0x09, 0x74, 0x6d, 0x70,
+  0x31, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x31, 0x20, 0x3e, 0x3e, 0x20,
+  0x31, 0x3b, 0x0a, 0x0a, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+  0x74, 0x6d, 0x70, 0x30, 0x20, 0x7c, 0x20, 0x74, 0x6d, 0x70, 0x31, 0x3b,
+  0x0a, 0x7d, 0x0a, 0x0a, 0x5f, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
+  0x6e, 0x74, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x62, 0x6c, 0x61,
+  0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b, 0x5d, 0x20, 0x3d, 0x0a, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x78, 0x36, 0x61, 0x30, 0x39, 0x65, 0x36,
+  0x36, 0x37, 0x66, 0x33, 0x62, 0x63, 0x63, 0x39, 0x30, 0x38, 0x2c, 0x20,
+  0x30, 0x78, 0x62, 0x62, 0x36, 0x37, 0x61, 0x65, 0x38, 0x35, 0x38, 0x34,
+  0x63, 0x61, 0x61, 0x37, 0x33, 0x62, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x78, 0x33, 0x63, 0x36, 0x65, 0x66, 0x33, 0x37, 0x32, 0x66, 0x65,
+  0x39, 0x34, 0x66, 0x38, 0x32, 0x62, 0x2c, 0x20, 0x30, 0x78, 0x61, 0x35,
+  0x34, 0x66, 0x66, 0x35, 0x33, 0x61, 0x35, 0x66, 0x31, 0x64, 0x33, 0x36,
+  0x66, 0x31, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x30, 0x78, 0x35, 0x31,
+  0x30, 0x65, 0x35, 0x32, 0x37, 0x66, 0x61, 0x64, 0x65, 0x36, 0x38, 0x32,
+  0x64, 0x31, 0x2c, 0x20, 0x30, 0x78, 0x39, 0x62, 0x30, 0x35, 0x36, 0x38,
+  0x38, 0x63, 0x32, 0x62, 0x33, 0x65, 0x36, 0x63, 0x31, 0x66, 0x2c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x78, 0x31, 0x66, 0x38, 0x33, 0x64, 0x39,
+  0x61, 0x62, 0x66, 0x62, 0x34, 0x31, 0x62, 0x64, 0x36, 0x62, 0x2c, 0x20,
+  0x30, 0x78, 0x35, 0x62, 0x65, 0x30, 0x63, 0x64, 0x31, 0x39, 0x31, 0x33,
+  0x37, 0x65, 0x32, 0x31, 0x37, 0x39, 0x2c, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a,
+  0x0a, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x73, 0x68, 0x72, 0x5f, 0x34,
+  0x28, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74,
+  0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x68, 0x29, 0x20, 0x7b,
+  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x20,
+  0x3d, 0x20, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x3e, 0x3e, 0x20,
+  0x73, 0x68, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20,
+  0x74, 0x6d, 0x70, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x32, 0x2d, 0x73, 0x68, 0x29, 0x3b,
+  0x0a, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x30, 0x31, 0x20, 0x7c,
+  0x3d, 0x20, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x31, 0x32, 0x3b, 0x0a,
+  0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x32, 0x20, 0x20, 0x7c, 0x3d, 0x20,
+  0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x33, 0x3b, 0x0a, 0x0a, 0x09, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x6d, 0x70, 0x3b, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x33, 0x32, 0x20, 0x62, 0x69, 0x74, 0x20,
+  0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x62, 0x65,
+  0x74, 0x74, 0x65, 0x72, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d,
+  0x61, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x36, 0x34, 0x20, 0x62, 0x69, 0x74, 0x20, 0x62, 0x75, 0x69,
+  0x6c, 0x64, 0x69, 0x6e, 0x73, 0x20, 0x2a, 0x2f, 0x0a, 0x69, 0x6e, 0x6c,
+  0x69, 0x6e, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x32, 0x20, 0x72, 0x6f, 0x72, 0x36, 0x34, 0x28, 0x63,
+  0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x78,
+  0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x79, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x29,
+  0x28, 0x28, 0x28, 0x78, 0x29, 0x2e, 0x78, 0x3e, 0x3e, 0x79, 0x29, 0x5e,
+  0x28, 0x28, 0x78, 0x29, 0x2e, 0x79, 0x3c, 0x3c, 0x28, 0x33, 0x32, 0x2d,
+  0x79, 0x29, 0x29, 0x2c, 0x28, 0x28, 0x78, 0x29, 0x2e, 0x79, 0x3e, 0x3e,
+  0x79, 0x29, 0x5e, 0x28, 0x28, 0x78, 0x29, 0x2e, 0x78, 0x3c, 0x3c, 0x28,
+  0x33, 0x32, 0x2d, 0x79, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x69,
+  0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x72, 0x6f, 0x72, 0x36, 0x34,
+  0x5f, 0x32, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e,
+  0x74, 0x32, 0x20, 0x78, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x79, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x75, 0x69,
+  0x6e, 0x74, 0x32, 0x29, 0x28, 0x28, 0x28, 0x78, 0x29, 0x2e, 0x79, 0x3e,
+  0x3e, 0x28, 0x79, 0x2d, 0x33, 0x32, 0x29, 0x29, 0x5e, 0x28, 0x28, 0x78,
+  0x29, 0x2e, 0x78, 0x3c, 0x3c, 0x28, 0x36, 0x34, 0x2d, 0x79, 0x29, 0x29,
+  0x2c, 0x28, 0x28, 0x78, 0x29, 0x2e, 0x78, 0x3e, 0x3e, 0x28, 0x79, 0x2d,
+  0x33, 0x32, 0x29, 0x29, 0x5e, 0x28, 0x28, 0x78, 0x29, 0x2e, 0x79, 0x3c,
+  0x3c, 0x28, 0x36, 0x34, 0x2d, 0x79, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x67, 0x46,
+  0x75, 0x6e, 0x63, 0x28, 0x76, 0x61, 0x2c, 0x20, 0x76, 0x62, 0x2c, 0x20,
+  0x76, 0x63, 0x2c, 0x20, 0x76, 0x64, 0x2c, 0x20, 0x78, 0x2c, 0x20, 0x79,
+  0x29, 0x20, 0x5c, 0x0a, 0x76, 0x61, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x61,
+  0x20, 0x2b, 0x20, 0x76, 0x62, 0x20, 0x2b, 0x20, 0x78, 0x29, 0x3b, 0x20,
+  0x5c, 0x0a, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26,
+  0x76, 0x64, 0x29, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x75,
+  0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x64, 0x29, 0x5b, 0x30,
+  0x5d, 0x2e, 0x79, 0x78, 0x20, 0x5e, 0x20, 0x28, 0x28, 0x75, 0x69, 0x6e,
+  0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x61, 0x29, 0x5b, 0x30, 0x5d, 0x2e,
+  0x79, 0x78, 0x3b, 0x20, 0x5c, 0x0a, 0x76, 0x63, 0x20, 0x3d, 0x20, 0x28,
+  0x76, 0x63, 0x20, 0x2b, 0x20, 0x76, 0x64, 0x29, 0x3b, 0x20, 0x5c, 0x0a,
+  0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x62,
+  0x29, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x72, 0x6f, 0x72, 0x36, 0x34,
+  0x28, 0x20, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26,
+  0x76, 0x62, 0x29, 0x5b, 0x30, 0x5d, 0x20, 0x5e, 0x20, 0x28, 0x28, 0x75,
+  0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x63, 0x29, 0x5b, 0x30,
+  0x5d, 0x2c, 0x20, 0x32, 0x34, 0x55, 0x29, 0x3b, 0x20, 0x5c, 0x0a, 0x76,
+  0x61, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x61, 0x20, 0x2b, 0x20, 0x76, 0x62,
+  0x20, 0x2b, 0x20, 0x79, 0x29, 0x3b, 0x20, 0x5c, 0x0a, 0x28, 0x28, 0x75,
+  0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x64, 0x29, 0x5b, 0x30,
+  0x5d, 0x20, 0x3d, 0x20, 0x72, 0x6f, 0x72, 0x36, 0x34, 0x28, 0x20, 0x28,
+  0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x64, 0x29,
+  0x5b, 0x30, 0x5d, 0x20, 0x5e, 0x20, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74,
+  0x32, 0x2a, 0x29, 0x26, 0x76, 0x61, 0x29, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
+  0x31, 0x36, 0x55, 0x29, 0x3b, 0x20, 0x5c, 0x0a, 0x76, 0x63, 0x20, 0x3d,
+  0x20, 0x28, 0x76, 0x63, 0x20, 0x2b, 0x20, 0x76, 0x64, 0x29, 0x3b, 0x20,
+  0x5c, 0x0a, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26,
+  0x76, 0x62, 0x29, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x72, 0x6f, 0x72,
+  0x36, 0x34, 0x5f, 0x32, 0x28, 0x20, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74,
+  0x32, 0x2a, 0x29, 0x26, 0x76, 0x62, 0x29, 0x5b, 0x30, 0x5d, 0x20, 0x5e,
+  0x20, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76,
+  0x63, 0x29, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x36, 0x33, 0x55, 0x29, 0x3b,
+  0x0a, 0x0a, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x50, 0x65, 0x72, 0x20, 0x69,
+  0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x72, 0x67,
+  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20,
+  0x68, 0x6f, 0x73, 0x74, 0x20, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x61,
+  0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+  0x61, 0x6e, 0x74, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2c, 0x0a,
+  0x2f, 0x2f, 0x20, 0x73, 0x6f, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6b, 0x65,
+  0x72, 0x6e, 0x65, 0x6c, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
+  0x74, 0x73, 0x20, 0x73, 0x74, 0x61, 0x79, 0x20, 0x62, 0x6f, 0x75, 0x6e,
+  0x64, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x69, 0x74,
+  0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x20, 0x50, 0x61,
+  0x64, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x31, 0x32, 0x38, 0x20,
+  0x62, 0x79, 0x74, 0x65, 0x73, 0x2e, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64,
+  0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x7b, 0x0a,
+  0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x62, 0x6c, 0x61, 0x6b,
+  0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x3b, 0x0a, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x3b, 0x0a, 0x09, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x3b, 0x09, 0x09,
+  0x09, 0x2f, 0x2f, 0x20, 0x43, 0x6c, 0x65, 0x61, 0x6e, 0x20, 0x6a, 0x6f,
+  0x62, 0x20, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x2c, 0x20, 0x73, 0x65, 0x65,
+  0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x0a, 0x09, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x70, 0x61, 0x64, 0x5b, 0x31, 0x34, 0x5d, 0x3b,
+  0x0a, 0x7d, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x0a,
+  0x09, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x20, 0x69, 0x73,
+  0x20, 0x72, 0x61, 0x69, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x74, 0x68, 0x72, 0x6f,
+  0x75, 0x67, 0x68, 0x20, 0x61, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64,
+  0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x71, 0x75, 0x65,
+  0x75, 0x65, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x73, 0x20, 0x72, 0x75, 0x6e,
+  0x2c, 0x0a, 0x09, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x70, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x73, 0x20, 0x61,
+  0x20, 0x63, 0x6c, 0x65, 0x61, 0x6e, 0x20, 0x6a, 0x6f, 0x62, 0x2e, 0x20,
+  0x52, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x20, 0x30, 0x20, 0x2d, 0x20, 0x34,
+  0x20, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 0x20, 0x69, 0x74, 0x20,
+  0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x70, 0x6f, 0x63, 0x68,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x69, 0x74,
+  0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x09, 0x61, 0x6e, 0x64,
+  0x20, 0x73, 0x6b, 0x69, 0x70, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x77, 0x6f,
+  0x72, 0x6b, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x74, 0x20, 0x69,
+  0x73, 0x20, 0x6e, 0x65, 0x77, 0x65, 0x72, 0x2c, 0x20, 0x73, 0x6f, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x61, 0x20, 0x73, 0x74, 0x61, 0x6c, 0x65, 0x20, 0x69, 0x74, 0x65, 0x72,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x72, 0x61, 0x69, 0x6e, 0x73,
+  0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x6c, 0x79, 0x2e, 0x0a, 0x09, 0x41,
+  0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x20, 0x6c, 0x61,
+  0x67, 0x67, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x65, 0x68, 0x69, 0x6e, 0x64,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x6d, 0x65, 0x61, 0x6e,
+  0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x77,
+  0x72, 0x69, 0x74, 0x65, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x69, 0x6c,
+  0x6c, 0x20, 0x70, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x2e, 0x0a, 0x09,
+  0x54, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x69, 0x73,
+  0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x70,
+  0x65, 0x72, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x67, 0x72, 0x6f, 0x75,
+  0x70, 0x2c, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x74, 0x68, 0x72,
+  0x65, 0x61, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x67, 0x72, 0x6f,
+  0x75, 0x70, 0x20, 0x74, 0x61, 0x6b, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2e, 0x0a,
+  0x2a, 0x2f, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x69,
+  0x73, 0x53, 0x74, 0x61, 0x6c, 0x65, 0x28, 0x70, 0x61, 0x72, 0x61, 0x6d,
+  0x73, 0x2c, 0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x29,
+  0x20, 0x28, 0x2a, 0x28, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68,
+  0x29, 0x20, 0x3e, 0x20, 0x28, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x29,
+  0x2d, 0x3e, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x29, 0x0a, 0x0a, 0x5f, 0x5f,
+  0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20,
+  0x72, 0x6f, 0x75, 0x6e, 0x64, 0x30, 0x28, 0x0a, 0x09, 0x09, 0x5f, 0x5f,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34,
+  0x20, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x4c, 0x6f, 0x2c,
+  0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x48, 0x69, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x5f,
+  0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x69, 0x74,
+  0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x50, 0x61, 0x72, 0x61, 0x6d,
+  0x73, 0x20, 0x2a, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x2c, 0x0a,
+  0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x76,
+  0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x2a, 0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x20,
+  0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x74, 0x61, 0x6c, 0x65,
+  0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x67, 0x65,
+  0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30,
+  0x29, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x73, 0x74, 0x61, 0x6c,
+  0x65, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x69, 0x73, 0x53, 0x74, 0x61,
+  0x6c, 0x65, 0x28, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x2c, 0x20, 0x6a,
+  0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x29, 0x3b, 0x0a, 0x09, 0x62,
+  0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c,
+  0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e,
+  0x43, 0x45, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74,
+  0x61, 0x6c, 0x65, 0x5b, 0x30, 0x5d, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75,
+  0x72, 0x6e, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x74,
+  0x49, 0x64, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65,
+  0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x3d, 0x20, 0x70, 0x61, 0x72,
+  0x61, 0x6d, 0x73, 0x2d, 0x3e, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73,
+  0x74, 0x61, 0x74, 0x65, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x3d, 0x20, 0x70, 0x61, 0x72, 0x61,
+  0x6d, 0x73, 0x2d, 0x3e, 0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x3b, 0x0a, 0x0a,
+  0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x31,
+  0x20, 0x3d, 0x20, 0x28, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x74,
+  0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x32, 0x29, 0x20, 0x7c, 0x20,
+  0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x76, 0x5b, 0x31,
+  0x36, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x69, 0x6e, 0x69,
+  0x74, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x76, 0x0a, 0x09,
+  0x76, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65,
+  0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x30, 0x3b, 0x0a, 0x09,
+  0x76, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65,
+  0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x31, 0x3b, 0x0a, 0x09,
+  0x76, 0x5b, 0x32, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65,
+  0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x32, 0x3b, 0x0a, 0x09,
+  0x76, 0x5b, 0x33, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65,
+  0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x33, 0x3b, 0x0a, 0x09,
+  0x76, 0x5b, 0x34, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65,
+  0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x34, 0x3b, 0x0a, 0x09,
+  0x76, 0x5b, 0x35, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65,
+  0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x35, 0x3b, 0x0a, 0x09,
+  0x76, 0x5b, 0x36, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65,
+  0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x36, 0x3b, 0x0a, 0x09,
+  0x76, 0x5b, 0x37, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65,
+  0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x37, 0x3b, 0x0a, 0x09,
+  0x76, 0x5b, 0x38, 0x5d, 0x20, 0x3d, 0x20, 0x20, 0x62, 0x6c, 0x61, 0x6b,
+  0x65, 0x5f, 0x69, 0x76, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x76, 0x5b,
+  0x39, 0x5d, 0x20, 0x3d, 0x20, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f,
+  0x69, 0x76, 0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x31, 0x30,
+  0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x69, 0x76,
+  0x5b, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x20,
+  0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b, 0x33,
+  0x5d, 0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x20, 0x3d, 0x20,
+  0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b, 0x34, 0x5d, 0x3b,
+  0x0a, 0x09, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c,
+  0x61, 0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b, 0x35, 0x5d, 0x3b, 0x0a, 0x09,
+  0x76, 0x5b, 0x31, 0x34, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b,
+  0x65, 0x5f, 0x69, 0x76, 0x5b, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x76, 0x5b,
+  0x31, 0x35, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f,
+  0x69, 0x76, 0x5b, 0x37, 0x5d, 0x3b, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x6c,
+  0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x64, 0x61, 0x74,
+  0x61, 0x20, 0x2d, 0x20, 0x33, 0x32, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20,
+  0x77, 0x6f, 0x72, 0x6b, 0x20, 0x2b, 0x20, 0x38, 0x20, 0x62, 0x79, 0x74,
+  0x65, 0x20, 0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x2b, 0x20, 0x34, 0x20,
+  0x62, 0x79, 0x74, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x0a, 0x09,
+  0x76, 0x5b, 0x31, 0x32, 0x5d, 0x20, 0x5e, 0x3d, 0x20, 0x31, 0x34, 0x34,
+  0x3b, 0x20, 0x0a, 0x09, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x20, 0x5e, 0x3d,
+  0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x2d, 0x31, 0x3b, 0x0a,
+  0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x31,
+  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d,
+  0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
+  0x20, 0x77, 0x6f, 0x72, 0x64, 0x31, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
+  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76,
+  0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30,
+  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
+  0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
+  0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d,
+  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
+  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76,
+  0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31,
+  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
+  0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
+  0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d,
+  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
+  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76,
+  0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x32,
+  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d,
+  0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
+  0x20, 0x30, 0x29, 0x3b, 0x09, 0x09, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e,
+  0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31,
+  0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c,
+  0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x09, 0x30, 0x2c, 0x20, 0x30,
+  0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b,
+  0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20,
+  0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e,
+  0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31,
+  0x35, 0x5d, 0x2c, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x31, 0x2c, 0x20, 0x30,
+  0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b,
+  0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20,
+  0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e,
+  0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31,
+  0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20,
+  0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
+  0x29, 0x3b, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+  0x20, 0x33, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b,
+  0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20,
+  0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x09, 0x09, 0x0a, 0x09, 0x67, 0x46,
+  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76,
+  0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30,
+  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
+  0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
+  0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d,
+  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
+  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76,
+  0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31,
+  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
+  0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
+  0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d,
+  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x31, 0x29, 0x3b,
+  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d,
+  0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
+  0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x75,
+  0x6e, 0x64, 0x20, 0x34, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
+  0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d,
+  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
+  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76,
+  0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x77, 0x6f, 0x72,
+  0x64, 0x31, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
+  0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d,
+  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
+  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76,
+  0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30,
+  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
+  0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
+  0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d,
+  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
+  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76,
+  0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d,
+  0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
+  0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x75,
+  0x6e, 0x64, 0x20, 0x35, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
+  0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d,
+  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x09, 0x09, 0x0a, 0x09,
+  0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20,
+  0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
+  0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b,
+  0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20,
+  0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e,
+  0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31,
+  0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c,
+  0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x77,
+  0x6f, 0x72, 0x64, 0x31, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e,
+  0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31,
+  0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20,
+  0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
+  0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b,
+  0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20,
+  0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x72,
+  0x6f, 0x75, 0x6e, 0x64, 0x20, 0x36, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e,
+  0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31,
+  0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x09, 0x09,
+  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d,
+  0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
+  0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
+  0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d,
+  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
+  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76,
+  0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30,
+  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
+  0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
+  0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d,
+  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
+  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76,
+  0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d,
+  0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x77, 0x6f,
+  0x72, 0x64, 0x31, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x2f, 0x2f,
+  0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x37, 0x0a, 0x09, 0x67, 0x46,
+  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76,
+  0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b,
+  0x09, 0x09, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b,
+  0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20,
+  0x77, 0x6f, 0x72, 0x64, 0x31, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c,
+  0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
+  0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b,
+  0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20,
+  0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e,
+  0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31,
+  0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c,
+  0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
+  0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b,
+  0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20,
+  0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e,
+  0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31,
+  0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x38, 0x0a, 0x09,
+  0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20,
+  0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
+  0x29, 0x3b, 0x09, 0x09, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
+  0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d,
+  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
+  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76,
+  0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x77, 0x6f, 0x72,
+  0x64, 0x31, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
+  0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d,
+  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
+  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76,
+  0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31,
+  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
+  0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
+  0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d,
+  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
+  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76,
+  0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x39,
+  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d,
+  0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
+  0x20, 0x30, 0x29, 0x3b, 0x09, 0x09, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e,
+  0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31,
+  0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c,
+  0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
+  0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b,
+  0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20,
+  0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e,
+  0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31,
+  0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c,
+  0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
+  0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b,
+  0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20,
+  0x77, 0x6f, 0x72, 0x64, 0x31, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20,
+  0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
+  0x29, 0x3b, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+  0x20, 0x31, 0x30, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76,
   0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76,
   0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c,
   0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x09, 0x09, 0x0a, 0x09, 0x67,
@@ -264,14 +783,14 @@ unsigned char __equihash_125_4_cl[] = {
   0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29,
   0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32,
   0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31,
-  0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x09, 0x30,
+  0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30,
   0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63,
   0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c,
   0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35,
-  0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67,
-  0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20,
-  0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x31,
+  0x5d, 0x2c, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x31, 0x2c, 0x20, 0x30, 0x29,
+  0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30,
+  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31,
+  0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30,
   0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63,
   0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c,
   0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x32,
@@ -283,63 +802,35 @@ unsigned char __equihash_125_4_cl[] = {
   0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39,
   0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30,
   0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x72, 0x6f,
-  0x75, 0x6e, 0x64, 0x20, 0x33, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63,
-  0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x32,
-  0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x09, 0x09, 0x0a,
-  0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c,
-  0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20,
-  0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76,
-  0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c,
-  0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75,
-  0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
-  0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d,
-  0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20,
-  0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c,
-  0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75,
-  0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b,
-  0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x77, 0x6f, 0x72, 0x64,
-  0x31, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76,
-  0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c,
-  0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x2f, 0x2f, 0x20,
-  0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x34, 0x0a, 0x09, 0x67, 0x46, 0x75,
-  0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b,
-  0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c,
-  0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20,
-  0x77, 0x6f, 0x72, 0x64, 0x31, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75,
-  0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
-  0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d,
-  0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20,
-  0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c,
-  0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75,
-  0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
-  0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c,
-  0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20,
-  0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76,
-  0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c,
-  0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x2f, 0x2f, 0x20,
-  0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x35, 0x0a, 0x09, 0x67, 0x46, 0x75,
+  0x75, 0x6e, 0x64, 0x20, 0x31, 0x31, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e,
+  0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31,
+  0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x31,
+  0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b,
+  0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20,
+  0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e,
+  0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31,
+  0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c,
+  0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
+  0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b,
+  0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20,
+  0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e,
+  0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31,
+  0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20,
+  0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
+  0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b,
+  0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20,
+  0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x72,
+  0x6f, 0x75, 0x6e, 0x64, 0x20, 0x31, 0x32, 0x0a, 0x09, 0x67, 0x46, 0x75,
   0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34,
   0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b,
   0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x09,
@@ -349,183 +840,14 @@ unsigned char __equihash_125_4_cl[] = {
   0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63,
   0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c,
   0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x34,
-  0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67,
+  0x5d, 0x2c, 0x09, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67,
   0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76,
   0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20,
   0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29,
   0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30,
   0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31,
-  0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30,
-  0x2c, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x31, 0x29, 0x3b, 0x0a, 0x09, 0x67,
-  0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20,
-  0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29,
-  0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38,
-  0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30,
-  0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63,
-  0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x34,
-  0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x2f,
-  0x2f, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x36, 0x0a, 0x09, 0x67,
-  0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20,
-  0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29,
-  0x3b, 0x09, 0x09, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c,
-  0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75,
-  0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
-  0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d,
-  0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20,
-  0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c,
-  0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75,
-  0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
-  0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c,
-  0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20,
-  0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76,
-  0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c,
-  0x20, 0x77, 0x6f, 0x72, 0x64, 0x31, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x37, 0x0a,
-  0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c,
-  0x20, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20,
-  0x30, 0x29, 0x3b, 0x09, 0x09, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63,
-  0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33,
-  0x5d, 0x2c, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x31, 0x2c, 0x20, 0x30, 0x29,
-  0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31,
-  0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30,
-  0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63,
-  0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35,
-  0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67,
-  0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20,
-  0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29,
-  0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31,
-  0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30,
-  0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63,
-  0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33,
-  0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67,
-  0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20,
-  0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29,
-  0x3b, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20,
-  0x38, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38,
-  0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30,
-  0x2c, 0x20, 0x30, 0x29, 0x3b, 0x09, 0x09, 0x0a, 0x09, 0x67, 0x46, 0x75,
-  0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b,
-  0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d,
-  0x2c, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20,
-  0x77, 0x6f, 0x72, 0x64, 0x31, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75,
-  0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
-  0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d,
-  0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20,
-  0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c,
-  0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75,
-  0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b,
-  0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c,
-  0x20, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20,
-  0x30, 0x29, 0x3b, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x75, 0x6e,
-  0x64, 0x20, 0x39, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c,
-  0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x09, 0x09, 0x0a, 0x09, 0x67,
-  0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20,
-  0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29,
-  0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31,
-  0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30,
-  0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63,
-  0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35,
-  0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67,
-  0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20,
-  0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29,
-  0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31,
-  0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30,
-  0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63,
-  0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33,
-  0x5d, 0x2c, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x31, 0x2c, 0x20, 0x30, 0x29,
-  0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39,
-  0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30,
-  0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x72, 0x6f,
-  0x75, 0x6e, 0x64, 0x20, 0x31, 0x30, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e,
-  0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d,
-  0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31,
-  0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x09, 0x09,
-  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d,
-  0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d,
-  0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
-  0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
-  0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20,
-  0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d,
-  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
-  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
-  0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x31, 0x2c,
-  0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
-  0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20,
-  0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d,
-  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
-  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
-  0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b,
-  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d,
-  0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d,
-  0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
-  0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
-  0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20,
-  0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d,
-  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x2f, 0x2f,
-  0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x31, 0x31, 0x0a, 0x09, 0x67,
-  0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20,
-  0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x77, 0x6f,
-  0x72, 0x64, 0x31, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63,
-  0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33,
-  0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67,
-  0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20,
-  0x76, 0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29,
-  0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31,
-  0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30,
-  0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63,
-  0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c,
-  0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35,
-  0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67,
+  0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x77,
+  0x6f, 0x72, 0x64, 0x31, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67,
   0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76,
   0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20,
   0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29,
@@ -535,774 +857,959 @@ unsigned char __equihash_125_4_cl[] = {
   0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63,
   0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c,
   0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x34,
-  0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x2f,
-  0x2f, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x31, 0x32, 0x0a, 0x09,
-  0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20,
-  0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
-  0x29, 0x3b, 0x09, 0x09, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
-  0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20,
-  0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d,
-  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
-  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
-  0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76,
-  0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x09, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b,
-  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d,
-  0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
-  0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
-  0x76, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20,
-  0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d,
-  0x2c, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x31, 0x2c, 0x20, 0x30, 0x29, 0x3b,
-  0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x31, 0x5d,
-  0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31,
-  0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x30, 0x2c,
-  0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46, 0x75, 0x6e, 0x63, 0x28,
-  0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20,
-  0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d,
-  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x46,
-  0x75, 0x6e, 0x63, 0x28, 0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
-  0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76,
-  0x5b, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5b,
-  0x30, 0x5d, 0x20, 0x3d, 0x20, 0x76, 0x5b, 0x30, 0x5d, 0x20, 0x5e, 0x20,
-  0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e,
-  0x73, 0x30, 0x20, 0x5e, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x5d, 0x20,
-  0x3d, 0x20, 0x76, 0x5b, 0x31, 0x5d, 0x20, 0x5e, 0x20, 0x62, 0x6c, 0x61,
-  0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x31, 0x20,
-  0x5e, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x76, 0x5b, 0x32, 0x5d, 0x20, 0x3d, 0x20, 0x76,
-  0x5b, 0x32, 0x5d, 0x20, 0x5e, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x32, 0x20, 0x5e, 0x20, 0x76,
-  0x5b, 0x31, 0x30, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x76, 0x5b, 0x33, 0x5d, 0x20, 0x3d, 0x20, 0x76, 0x5b, 0x33,
-  0x5d, 0x20, 0x5e, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74,
-  0x61, 0x74, 0x65, 0x2e, 0x73, 0x33, 0x20, 0x5e, 0x20, 0x76, 0x5b, 0x31,
-  0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x76, 0x5b, 0x34, 0x5d, 0x20, 0x3d, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x20,
-  0x5e, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74,
-  0x65, 0x2e, 0x73, 0x34, 0x20, 0x5e, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5b,
-  0x35, 0x5d, 0x20, 0x3d, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x20, 0x5e, 0x20,
-  0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e,
-  0x73, 0x35, 0x20, 0x5e, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5b, 0x36, 0x5d,
-  0x20, 0x3d, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x20, 0x5e, 0x20, 0x62, 0x6c,
-  0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x36,
-  0x20, 0x5e, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x76,
-  0x5b, 0x37, 0x5d, 0x20, 0x3d, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x20, 0x5e,
+  0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5b, 0x30, 0x5d, 0x20,
+  0x3d, 0x20, 0x76, 0x5b, 0x30, 0x5d, 0x20, 0x5e, 0x20, 0x62, 0x6c, 0x61,
+  0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x30, 0x20,
+  0x5e, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x76,
+  0x5b, 0x31, 0x5d, 0x20, 0x5e, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f,
+  0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x31, 0x20, 0x5e, 0x20, 0x76,
+  0x5b, 0x39, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x76, 0x5b, 0x32, 0x5d, 0x20, 0x3d, 0x20, 0x76, 0x5b, 0x32, 0x5d,
+  0x20, 0x5e, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61,
+  0x74, 0x65, 0x2e, 0x73, 0x32, 0x20, 0x5e, 0x20, 0x76, 0x5b, 0x31, 0x30,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76,
+  0x5b, 0x33, 0x5d, 0x20, 0x3d, 0x20, 0x76, 0x5b, 0x33, 0x5d, 0x20, 0x5e,
   0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x2e, 0x73, 0x37, 0x20, 0x5e, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x3b,
-  0x20, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x20, 0x6f, 0x75,
-  0x74, 0x70, 0x75, 0x74, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x70, 0x6f, 0x73, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62,
-  0x75, 0x63, 0x6b, 0x65, 0x74, 0x3b, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x64, 0x61,
-  0x74, 0x61, 0x53, 0x68, 0x61, 0x72, 0x65, 0x5b, 0x34, 0x30, 0x39, 0x36,
-  0x5d, 0x3b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x70,
-  0x72, 0x65, 0x70, 0x61, 0x72, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70,
-  0x69, 0x70, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6e,
-  0x67, 0x65, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x49,
-  0x64, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x66,
-  0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x30,
-  0x3b, 0x20, 0x69, 0x3c, 0x38, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20,
-  0x7b, 0x0a, 0x09, 0x09, 0x64, 0x61, 0x74, 0x61, 0x53, 0x68, 0x61, 0x72,
-  0x65, 0x5b, 0x31, 0x36, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x32, 0x2a, 0x69,
-  0x2b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x76, 0x5b, 0x69, 0x5d, 0x20, 0x3b,
-  0x20, 0x0a, 0x09, 0x09, 0x64, 0x61, 0x74, 0x61, 0x53, 0x68, 0x61, 0x72,
-  0x65, 0x5b, 0x31, 0x36, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x32, 0x2a, 0x69,
-  0x2b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x76, 0x5b, 0x69, 0x5d, 0x20, 0x3e,
-  0x3e, 0x20, 0x33, 0x32, 0x3b, 0x20, 0x09, 0x09, 0x0a, 0x09, 0x7d, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4e,
-  0x6f, 0x77, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
-  0x20, 0x69, 0x73, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x0a, 0x09,
-  0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c,
-  0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f,
-  0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x2f, 0x2f, 0x20, 0x42, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72,
-  0x20, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x6e, 0x65, 0x65,
-  0x64, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x43, 0x50, 0x55, 0x20,
-  0x6d, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x63, 0x61, 0x6e, 0x20,
-  0x62, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20, 0x6f,
-  0x6e, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x72, 0x6e, 0x20, 0x47, 0x50, 0x55,
-  0x73, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x76,
-  0x32, 0x5b, 0x31, 0x36, 0x5d, 0x3b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x6e, 0x65,
-  0x65, 0x64, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x31, 0x35, 0x20,
-  0x77, 0x6f, 0x72, 0x64, 0x73, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64, 0x20,
-  0x26, 0x20, 0x30, 0x78, 0x46, 0x30, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x2f, 0x2f, 0x20, 0x47, 0x65, 0x74, 0x20, 0x72, 0x69, 0x64,
-  0x20, 0x6f, 0x66, 0x20, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x34, 0x20,
-  0x62, 0x69, 0x74, 0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75,
-  0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69, 0x3c, 0x31,
-  0x36, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09,
-  0x76, 0x32, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x09,
-  0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6a,
-  0x20, 0x3d, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3b, 0x20, 0x6a, 0x3c,
-  0x3d, 0x6c, 0x49, 0x64, 0x3b, 0x20, 0x6a, 0x2b, 0x2b, 0x29, 0x20, 0x76,
-  0x32, 0x5b, 0x69, 0x5d, 0x20, 0x2b, 0x3d, 0x20, 0x64, 0x61, 0x74, 0x61,
-  0x53, 0x68, 0x61, 0x72, 0x65, 0x5b, 0x31, 0x36, 0x2a, 0x6a, 0x20, 0x2b,
-  0x20, 0x69, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x76, 0x32, 0x5b, 0x69, 0x5d,
-  0x20, 0x3d, 0x20, 0x73, 0x77, 0x61, 0x70, 0x42, 0x69, 0x74, 0x4f, 0x72,
-  0x64, 0x65, 0x72, 0x28, 0x76, 0x32, 0x5b, 0x69, 0x5d, 0x29, 0x3b, 0x0a,
-  0x09, 0x7d, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x0a, 0x09, 0x6f, 0x75, 0x74,
-  0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b,
-  0x30, 0x5d, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f,
-  0x2f, 0x20, 0x46, 0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d,
-  0x65, 0x6e, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65,
-  0x73, 0x20, 0x30, 0x20, 0x74, 0x6f, 0x20, 0x31, 0x35, 0x20, 0x0a, 0x09,
-  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20,
-  0x76, 0x32, 0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70,
-  0x75, 0x74, 0x2e, 0x73, 0x32, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x32,
-  0x5d, 0x3b, 0x20, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e,
-  0x73, 0x33, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x33, 0x5d, 0x20, 0x26,
-  0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x3b,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4f, 0x6e, 0x6c,
-  0x79, 0x20, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x32, 0x39, 0x20, 0x62,
-  0x69, 0x74, 0x73, 0x20, 0x20, 0x0a, 0x0a, 0x09, 0x20, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73,
-  0x34, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20,
-  0x32, 0x29, 0x3b, 0x20, 0x0a, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
-  0x20, 0x3d, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30,
-  0x20, 0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x3b, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x57, 0x65, 0x20, 0x77, 0x69,
-  0x6c, 0x6c, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f,
-  0x20, 0x32, 0x5e, 0x31, 0x33, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x62, 0x75, 0x63, 0x6b,
-  0x65, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d,
-  0x61, 0x6c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x22, 0x62, 0x75, 0x63,
-  0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x22, 0x09, 0x0a, 0x09, 0x70,
-  0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f,
-  0x69, 0x6e, 0x63, 0x28, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
-  0x73, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x29, 0x3b, 0x0a,
-  0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x20, 0x3d,
-  0x20, 0x73, 0x68, 0x72, 0x5f, 0x34, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75,
-  0x74, 0x2e, 0x6c, 0x6f, 0x2c, 0x31, 0x33, 0x29, 0x3b, 0x0a, 0x09, 0x09,
-  0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x70, 0x6f, 0x73, 0x20, 0x3c, 0x20,
-  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20,
-  0x7b, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x4c, 0x6f,
-  0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2a, 0x62, 0x75, 0x63, 0x6b,
-  0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20,
-  0x3d, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x3b,
-  0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x48, 0x69, 0x5b,
-  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2a, 0x62, 0x75, 0x63, 0x6b, 0x65,
-  0x74, 0x53, 0x69, 0x7a, 0x65, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d,
-  0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x34, 0x3b, 0x0a,
-  0x09, 0x7d, 0x0a, 0x0a, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
-  0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x34, 0x5d, 0x3b,
+  0x2e, 0x73, 0x33, 0x20, 0x5e, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5b, 0x34,
+  0x5d, 0x20, 0x3d, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x20, 0x5e, 0x20, 0x62,
+  0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73,
+  0x34, 0x20, 0x5e, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x20,
+  0x3d, 0x20, 0x76, 0x5b, 0x35, 0x5d, 0x20, 0x5e, 0x20, 0x62, 0x6c, 0x61,
+  0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x35, 0x20,
+  0x5e, 0x20, 0x76, 0x5b, 0x31, 0x33, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x20, 0x3d, 0x20,
+  0x76, 0x5b, 0x36, 0x5d, 0x20, 0x5e, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65,
+  0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x36, 0x20, 0x5e, 0x20,
+  0x76, 0x5b, 0x31, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x76, 0x5b, 0x37, 0x5d,
+  0x20, 0x3d, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x20, 0x5e, 0x20, 0x62, 0x6c,
+  0x61, 0x6b, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x37,
+  0x20, 0x5e, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x3b, 0x20, 0x0a, 0x0a,
+  0x09, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x6f, 0x73,
+  0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x75, 0x63, 0x6b,
+  0x65, 0x74, 0x3b, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x53,
+  0x68, 0x61, 0x72, 0x65, 0x5b, 0x34, 0x30, 0x39, 0x36, 0x5d, 0x3b, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x70, 0x72, 0x65, 0x70,
+  0x61, 0x72, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x69, 0x70, 0x65,
+  0x6c, 0x69, 0x6e, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x0a,
+  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x49, 0x64, 0x20, 0x3d,
+  0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69,
+  0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20,
+  0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69,
+  0x3c, 0x38, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x09,
+  0x09, 0x64, 0x61, 0x74, 0x61, 0x53, 0x68, 0x61, 0x72, 0x65, 0x5b, 0x31,
+  0x36, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x32, 0x2a, 0x69, 0x2b, 0x30, 0x5d,
+  0x20, 0x3d, 0x20, 0x76, 0x5b, 0x69, 0x5d, 0x20, 0x3b, 0x20, 0x0a, 0x09,
+  0x09, 0x64, 0x61, 0x74, 0x61, 0x53, 0x68, 0x61, 0x72, 0x65, 0x5b, 0x31,
+  0x36, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x32, 0x2a, 0x69, 0x2b, 0x31, 0x5d,
+  0x20, 0x3d, 0x20, 0x76, 0x5b, 0x69, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x33,
+  0x32, 0x3b, 0x20, 0x09, 0x09, 0x0a, 0x09, 0x7d, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4e, 0x6f, 0x77, 0x20,
+  0x61, 0x6c, 0x6c, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x69, 0x73,
+  0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x0a, 0x09, 0x0a, 0x09, 0x62,
+  0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c,
+  0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e,
+  0x43, 0x45, 0x29, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f,
+  0x2f, 0x20, 0x42, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x20, 0x69, 0x73,
+  0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x65, 0x64,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x43, 0x50, 0x55, 0x20, 0x6d, 0x69, 0x6e,
+  0x69, 0x6e, 0x67, 0x2c, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20,
+  0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x6d,
+  0x6f, 0x64, 0x65, 0x72, 0x6e, 0x20, 0x47, 0x50, 0x55, 0x73, 0x0a, 0x09,
+  0x09, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x76, 0x32, 0x5b, 0x31,
+  0x36, 0x5d, 0x3b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f,
+  0x2f, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x20,
+  0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x31, 0x35, 0x20, 0x77, 0x6f, 0x72,
+  0x64, 0x73, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x74, 0x61,
+  0x72, 0x74, 0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64, 0x20, 0x26, 0x20, 0x30,
+  0x78, 0x46, 0x30, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f,
+  0x2f, 0x20, 0x47, 0x65, 0x74, 0x20, 0x72, 0x69, 0x64, 0x20, 0x6f, 0x66,
+  0x20, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x34, 0x20, 0x62, 0x69, 0x74,
+  0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69, 0x3c, 0x31, 0x36, 0x3b, 0x20,
+  0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x76, 0x32, 0x5b,
+  0x69, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x09, 0x09, 0x66, 0x6f,
+  0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6a, 0x20, 0x3d, 0x20,
+  0x73, 0x74, 0x61, 0x72, 0x74, 0x3b, 0x20, 0x6a, 0x3c, 0x3d, 0x6c, 0x49,
+  0x64, 0x3b, 0x20, 0x6a, 0x2b, 0x2b, 0x29, 0x20, 0x76, 0x32, 0x5b, 0x69,
+  0x5d, 0x20, 0x2b, 0x3d, 0x20, 0x64, 0x61, 0x74, 0x61, 0x53, 0x68, 0x61,
+  0x72, 0x65, 0x5b, 0x31, 0x36, 0x2a, 0x6a, 0x20, 0x2b, 0x20, 0x69, 0x5d,
+  0x3b, 0x0a, 0x09, 0x09, 0x76, 0x32, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20,
+  0x73, 0x77, 0x61, 0x70, 0x42, 0x69, 0x74, 0x4f, 0x72, 0x64, 0x65, 0x72,
+  0x28, 0x76, 0x32, 0x5b, 0x69, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x7d, 0x09,
+  0x09, 0x09, 0x09, 0x0a, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x30, 0x5d, 0x3b,
   0x20, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x46,
   0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
-  0x20, 0x61, 0x72, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x31,
-  0x35, 0x20, 0x74, 0x6f, 0x20, 0x33, 0x31, 0x20, 0x0a, 0x09, 0x6f, 0x75,
-  0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x76, 0x32,
-  0x5b, 0x35, 0x5d, 0x3b, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
-  0x2e, 0x73, 0x32, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x36, 0x5d, 0x3b,
-  0x20, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x33,
-  0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x37, 0x5d, 0x20, 0x26, 0x20, 0x30,
-  0x78, 0x31, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x3b, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20,
-  0x6c, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x32, 0x39, 0x20, 0x62, 0x69, 0x74,
-  0x73, 0x20, 0x20, 0x0a, 0x09, 0x20, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0a,
+  0x20, 0x61, 0x72, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x30,
+  0x20, 0x74, 0x6f, 0x20, 0x31, 0x35, 0x20, 0x0a, 0x09, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b,
+  0x31, 0x5d, 0x3b, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e,
+  0x73, 0x32, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x32, 0x5d, 0x3b, 0x20,
+  0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x33, 0x20,
+  0x3d, 0x20, 0x76, 0x32, 0x5b, 0x33, 0x5d, 0x20, 0x26, 0x20, 0x30, 0x78,
+  0x31, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x3b, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x6c,
+  0x6f, 0x77, 0x65, 0x72, 0x20, 0x32, 0x39, 0x20, 0x62, 0x69, 0x74, 0x73,
+  0x20, 0x20, 0x0a, 0x0a, 0x09, 0x20, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0a,
   0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x34, 0x20, 0x3d,
-  0x20, 0x28, 0x74, 0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x29, 0x2b,
-  0x31, 0x3b, 0x20, 0x0a, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20,
-  0x3d, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20,
-  0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x3b, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x57, 0x65, 0x20, 0x77, 0x69, 0x6c,
-  0x6c, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
-  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20,
-  0x32, 0x5e, 0x31, 0x33, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65,
-  0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x61,
-  0x6c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x22, 0x62, 0x75, 0x63, 0x6b,
-  0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x22, 0x09, 0x0a, 0x09, 0x70, 0x6f,
-  0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x69,
-  0x6e, 0x63, 0x28, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73,
-  0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x29, 0x3b, 0x0a, 0x09,
-  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x20, 0x3d, 0x20,
-  0x73, 0x68, 0x72, 0x5f, 0x34, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
-  0x2e, 0x6c, 0x6f, 0x2c, 0x31, 0x33, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x0a,
-  0x09, 0x69, 0x66, 0x20, 0x28, 0x70, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x62,
-  0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b,
-  0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x4c, 0x6f, 0x5b,
-  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2a, 0x62, 0x75, 0x63, 0x6b, 0x65,
+  0x20, 0x28, 0x74, 0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x29, 0x3b,
+  0x20, 0x0a, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20, 0x26, 0x20,
+  0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x3b, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x2f, 0x2f, 0x20, 0x57, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20,
+  0x73, 0x6f, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x32, 0x5e,
+  0x31, 0x33, 0x20, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e,
+  0x6c, 0x6f, 0x20, 0x3d, 0x20, 0x73, 0x68, 0x72, 0x5f, 0x34, 0x28, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x2c, 0x31, 0x33, 0x29,
+  0x3b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x62, 0x75, 0x63,
+  0x6b, 0x65, 0x74, 0x73, 0x2c, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x73,
+  0x70, 0x6c, 0x69, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x38, 0x20,
+  0x73, 0x75, 0x62, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x73, 0x0a,
+  0x09, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x62,
+  0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29, 0x20,
+  0x7c, 0x20, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30,
+  0x20, 0x26, 0x20, 0x30, 0x78, 0x37, 0x29, 0x3b, 0x09, 0x09, 0x09, 0x09,
+  0x2f, 0x2f, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x61,
+  0x6c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x22, 0x73, 0x75, 0x62, 0x42,
+  0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x22, 0x0a, 0x09,
+  0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63,
+  0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65,
+  0x72, 0x73, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x29, 0x3b,
+  0x0a, 0x09, 0x09, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x70, 0x6f, 0x73,
+  0x20, 0x3c, 0x20, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74,
+  0x53, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x4c, 0x6f, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65,
+  0x74, 0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53,
+  0x69, 0x7a, 0x65, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x3b, 0x0a, 0x09, 0x09,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x48, 0x69, 0x5b, 0x62, 0x75, 0x63,
+  0x6b, 0x65, 0x74, 0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65,
   0x74, 0x53, 0x69, 0x7a, 0x65, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d,
-  0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x3b, 0x0a,
-  0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x48, 0x69, 0x5b, 0x62,
-  0x75, 0x63, 0x6b, 0x65, 0x74, 0x2a, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
+  0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x34, 0x3b, 0x0a,
+  0x09, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x09, 0x09,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x4c, 0x6f, 0x73, 0x73, 0x28, 0x26, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x6c, 0x6f, 0x73, 0x73,
+  0x42, 0x61, 0x73, 0x65, 0x5d, 0x2c, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x42,
+  0x75, 0x63, 0x6b, 0x65, 0x74, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x7d, 0x0a,
+  0x0a, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30,
+  0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x34, 0x5d, 0x3b, 0x20, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x46, 0x69, 0x72, 0x73,
+  0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x72,
+  0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x31, 0x35, 0x20, 0x74,
+  0x6f, 0x20, 0x33, 0x31, 0x20, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x35, 0x5d,
+  0x3b, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x32,
+  0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x36, 0x5d, 0x3b, 0x20, 0x0a, 0x09,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20,
+  0x76, 0x32, 0x5b, 0x37, 0x5d, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31, 0x46,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x3b, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x2f, 0x2f, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x6c, 0x6f, 0x77,
+  0x65, 0x72, 0x20, 0x32, 0x39, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x20,
+  0x0a, 0x09, 0x20, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x34, 0x20, 0x3d, 0x20, 0x28, 0x74,
+  0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x29, 0x2b, 0x31, 0x3b, 0x20,
+  0x0a, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20, 0x26, 0x20, 0x30,
+  0x78, 0x31, 0x46, 0x46, 0x46, 0x3b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x2f, 0x2f, 0x20, 0x57, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x73,
+  0x6f, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x32, 0x5e, 0x31,
+  0x33, 0x20, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c,
+  0x6f, 0x20, 0x3d, 0x20, 0x73, 0x68, 0x72, 0x5f, 0x34, 0x28, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x2c, 0x31, 0x33, 0x29, 0x3b,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x62, 0x75, 0x63, 0x6b,
+  0x65, 0x74, 0x73, 0x2c, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x73, 0x70,
+  0x6c, 0x69, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x38, 0x20, 0x73,
+  0x75, 0x62, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x73, 0x0a, 0x09,
+  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29, 0x20, 0x7c,
+  0x20, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20,
+  0x26, 0x20, 0x30, 0x78, 0x37, 0x29, 0x3b, 0x09, 0x09, 0x09, 0x09, 0x2f,
+  0x2f, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x61, 0x6c,
+  0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x22, 0x73, 0x75, 0x62, 0x42, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x22, 0x0a, 0x09, 0x70,
+  0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f,
+  0x69, 0x6e, 0x63, 0x28, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
+  0x73, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x29, 0x3b, 0x0a,
+  0x09, 0x09, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x70, 0x6f, 0x73, 0x20,
+  0x3c, 0x20, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53,
+  0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x4c, 0x6f, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
+  0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69,
+  0x7a, 0x65, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x3b, 0x0a, 0x09, 0x09, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x48, 0x69, 0x5b, 0x62, 0x75, 0x63, 0x6b,
+  0x65, 0x74, 0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74,
   0x53, 0x69, 0x7a, 0x65, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20,
   0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x34, 0x3b, 0x0a, 0x09,
-  0x7d, 0x0a, 0x0a, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e,
-  0x73, 0x30, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x38, 0x5d, 0x3b, 0x20,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x46, 0x69,
-  0x72, 0x73, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
-  0x61, 0x72, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x33, 0x32,
-  0x20, 0x74, 0x6f, 0x20, 0x34, 0x37, 0x20, 0x0a, 0x09, 0x6f, 0x75, 0x74,
-  0x70, 0x75, 0x74, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b,
-  0x39, 0x5d, 0x3b, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e,
-  0x73, 0x32, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x31, 0x30, 0x5d, 0x3b,
-  0x20, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x33,
-  0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x31, 0x31, 0x5d, 0x20, 0x26, 0x20,
-  0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x3b, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20,
-  0x6c, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x32, 0x39, 0x20, 0x62, 0x69, 0x74,
-  0x73, 0x20, 0x20, 0x0a, 0x09, 0x20, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0a,
-  0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x34, 0x20, 0x3d,
-  0x20, 0x28, 0x74, 0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x29, 0x2b,
-  0x32, 0x3b, 0x20, 0x0a, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20,
-  0x3d, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20,
-  0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x3b, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x57, 0x65, 0x20, 0x77, 0x69, 0x6c,
-  0x6c, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
-  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20,
-  0x32, 0x5e, 0x31, 0x33, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65,
-  0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x61,
-  0x6c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x22, 0x62, 0x75, 0x63, 0x6b,
-  0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x22, 0x09, 0x0a, 0x09, 0x70, 0x6f,
-  0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x69,
-  0x6e, 0x63, 0x28, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73,
-  0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x29, 0x3b, 0x0a, 0x09,
-  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x20, 0x3d, 0x20,
-  0x73, 0x68, 0x72, 0x5f, 0x34, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
-  0x2e, 0x6c, 0x6f, 0x2c, 0x31, 0x33, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x0a,
-  0x09, 0x69, 0x66, 0x20, 0x28, 0x70, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x62,
-  0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b,
-  0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x4c, 0x6f, 0x5b,
-  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2a, 0x62, 0x75, 0x63, 0x6b, 0x65,
-  0x74, 0x53, 0x69, 0x7a, 0x65, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d,
-  0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x3b, 0x0a,
-  0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x48, 0x69, 0x5b, 0x62,
-  0x75, 0x63, 0x6b, 0x65, 0x74, 0x2a, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
+  0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x4c, 0x6f, 0x73, 0x73, 0x28, 0x26, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x6c, 0x6f, 0x73, 0x73, 0x42,
+  0x61, 0x73, 0x65, 0x5d, 0x2c, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x42, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x7d, 0x0a, 0x0a,
+  0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20,
+  0x3d, 0x20, 0x76, 0x32, 0x5b, 0x38, 0x5d, 0x3b, 0x20, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x46, 0x69, 0x72, 0x73, 0x74,
+  0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x72, 0x65,
+  0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x33, 0x32, 0x20, 0x74, 0x6f,
+  0x20, 0x34, 0x37, 0x20, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x39, 0x5d, 0x3b,
+  0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x32, 0x20,
+  0x3d, 0x20, 0x76, 0x32, 0x5b, 0x31, 0x30, 0x5d, 0x3b, 0x20, 0x0a, 0x09,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20,
+  0x76, 0x32, 0x5b, 0x31, 0x31, 0x5d, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x3b, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x2f, 0x2f, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x6c, 0x6f, 0x77,
+  0x65, 0x72, 0x20, 0x32, 0x39, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x20,
+  0x0a, 0x09, 0x20, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x34, 0x20, 0x3d, 0x20, 0x28, 0x74,
+  0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x29, 0x2b, 0x32, 0x3b, 0x20,
+  0x0a, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20, 0x26, 0x20, 0x30,
+  0x78, 0x31, 0x46, 0x46, 0x46, 0x3b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x2f, 0x2f, 0x20, 0x57, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x73,
+  0x6f, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x32, 0x5e, 0x31,
+  0x33, 0x20, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c,
+  0x6f, 0x20, 0x3d, 0x20, 0x73, 0x68, 0x72, 0x5f, 0x34, 0x28, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x2c, 0x31, 0x33, 0x29, 0x3b,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x62, 0x75, 0x63, 0x6b,
+  0x65, 0x74, 0x73, 0x2c, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x73, 0x70,
+  0x6c, 0x69, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x38, 0x20, 0x73,
+  0x75, 0x62, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x73, 0x0a, 0x09,
+  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29, 0x20, 0x7c,
+  0x20, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20,
+  0x26, 0x20, 0x30, 0x78, 0x37, 0x29, 0x3b, 0x09, 0x09, 0x09, 0x09, 0x2f,
+  0x2f, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x61, 0x6c,
+  0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x22, 0x73, 0x75, 0x62, 0x42, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x22, 0x0a, 0x09, 0x70,
+  0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f,
+  0x69, 0x6e, 0x63, 0x28, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
+  0x73, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x29, 0x3b, 0x0a,
+  0x09, 0x09, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x70, 0x6f, 0x73, 0x20,
+  0x3c, 0x20, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53,
+  0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x4c, 0x6f, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
+  0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69,
+  0x7a, 0x65, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x3b, 0x0a, 0x09, 0x09, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x48, 0x69, 0x5b, 0x62, 0x75, 0x63, 0x6b,
+  0x65, 0x74, 0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74,
   0x53, 0x69, 0x7a, 0x65, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20,
   0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x34, 0x3b, 0x0a, 0x09,
-  0x7d, 0x0a, 0x0a, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e,
-  0x73, 0x30, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x31, 0x32, 0x5d, 0x3b,
-  0x20, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x46,
-  0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
-  0x20, 0x61, 0x72, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x34,
-  0x38, 0x20, 0x74, 0x6f, 0x20, 0x36, 0x33, 0x20, 0x0a, 0x09, 0x6f, 0x75,
-  0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x76, 0x32,
-  0x5b, 0x31, 0x33, 0x5d, 0x3b, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75,
-  0x74, 0x2e, 0x73, 0x32, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x31, 0x34,
-  0x5d, 0x3b, 0x20, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e,
-  0x73, 0x33, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x31, 0x35, 0x5d, 0x20,
-  0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
-  0x3b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4f, 0x6e, 0x6c,
-  0x79, 0x20, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x32, 0x39, 0x20, 0x62,
-  0x69, 0x74, 0x73, 0x20, 0x20, 0x0a, 0x09, 0x20, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x34,
-  0x20, 0x3d, 0x20, 0x28, 0x74, 0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x32,
-  0x29, 0x2b, 0x33, 0x3b, 0x20, 0x0a, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x65,
-  0x74, 0x20, 0x3d, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73,
-  0x30, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x3b, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x57, 0x65, 0x20, 0x77,
-  0x69, 0x6c, 0x6c, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x74,
-  0x6f, 0x20, 0x32, 0x5e, 0x31, 0x33, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x62, 0x75, 0x63,
-  0x6b, 0x65, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x78, 0x69,
-  0x6d, 0x61, 0x6c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x22, 0x62, 0x75,
-  0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x22, 0x09, 0x0a, 0x09,
-  0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63,
-  0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65,
-  0x72, 0x73, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x29, 0x3b,
-  0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x20,
-  0x3d, 0x20, 0x73, 0x68, 0x72, 0x5f, 0x34, 0x28, 0x6f, 0x75, 0x74, 0x70,
-  0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x2c, 0x31, 0x33, 0x29, 0x3b, 0x0a, 0x09,
-  0x09, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x70, 0x6f, 0x73, 0x20, 0x3c,
-  0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x29,
-  0x20, 0x7b, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x4c,
-  0x6f, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2a, 0x62, 0x75, 0x63,
-  0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2b, 0x70, 0x6f, 0x73, 0x5d,
-  0x20, 0x3d, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f,
-  0x3b, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x48, 0x69,
-  0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2a, 0x62, 0x75, 0x63, 0x6b,
+  0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x4c, 0x6f, 0x73, 0x73, 0x28, 0x26, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x6c, 0x6f, 0x73, 0x73, 0x42,
+  0x61, 0x73, 0x65, 0x5d, 0x2c, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x42, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x7d, 0x0a, 0x0a,
+  0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20,
+  0x3d, 0x20, 0x76, 0x32, 0x5b, 0x31, 0x32, 0x5d, 0x3b, 0x20, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x46, 0x69, 0x72, 0x73,
+  0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x72,
+  0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x34, 0x38, 0x20, 0x74,
+  0x6f, 0x20, 0x36, 0x33, 0x20, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x31, 0x33,
+  0x5d, 0x3b, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73,
+  0x32, 0x20, 0x3d, 0x20, 0x76, 0x32, 0x5b, 0x31, 0x34, 0x5d, 0x3b, 0x20,
+  0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x33, 0x20,
+  0x3d, 0x20, 0x76, 0x32, 0x5b, 0x31, 0x35, 0x5d, 0x20, 0x26, 0x20, 0x30,
+  0x78, 0x31, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x3b, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x6c,
+  0x6f, 0x77, 0x65, 0x72, 0x20, 0x32, 0x39, 0x20, 0x62, 0x69, 0x74, 0x73,
+  0x20, 0x20, 0x0a, 0x09, 0x20, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x09,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x34, 0x20, 0x3d, 0x20,
+  0x28, 0x74, 0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x29, 0x2b, 0x33,
+  0x3b, 0x20, 0x0a, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d,
+  0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20, 0x26,
+  0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x3b, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x2f, 0x2f, 0x20, 0x57, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c,
+  0x20, 0x73, 0x6f, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x32,
+  0x5e, 0x31, 0x33, 0x20, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x2e, 0x6c, 0x6f, 0x20, 0x3d, 0x20, 0x73, 0x68, 0x72, 0x5f, 0x34, 0x28,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x2c, 0x31, 0x33,
+  0x29, 0x3b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x62, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x73, 0x2c, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+  0x73, 0x70, 0x6c, 0x69, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x38,
+  0x20, 0x73, 0x75, 0x62, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x73,
+  0x0a, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x28,
+  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29,
+  0x20, 0x7c, 0x20, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73,
+  0x30, 0x20, 0x26, 0x20, 0x30, 0x78, 0x37, 0x29, 0x3b, 0x09, 0x09, 0x09,
+  0x09, 0x2f, 0x2f, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d,
+  0x61, 0x6c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x22, 0x73, 0x75, 0x62,
+  0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x22, 0x0a,
+  0x09, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69,
+  0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x65, 0x72, 0x73, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x29,
+  0x3b, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x70, 0x6f,
+  0x73, 0x20, 0x3c, 0x20, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65,
+  0x74, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x4c, 0x6f, 0x5b, 0x62, 0x75, 0x63, 0x6b,
+  0x65, 0x74, 0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74,
+  0x53, 0x69, 0x7a, 0x65, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x6c, 0x6f, 0x3b, 0x0a, 0x09,
+  0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x48, 0x69, 0x5b, 0x62, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b,
   0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20,
   0x3d, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x34, 0x3b,
-  0x0a, 0x09, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64,
-  0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x75, 0x69,
-  0x6e, 0x74, 0x34, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20,
-  0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x2c, 0x20, 0x5f, 0x5f, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x2a, 0x20, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x2c, 0x20, 0x5f, 0x5f, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x2a, 0x20, 0x74, 0x61,
-  0x62, 0x20, 0x2c, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20,
-  0x75, 0x69, 0x6e, 0x74, 0x2a, 0x20, 0x63, 0x6e, 0x74, 0x2c, 0x20, 0x75,
-  0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x20, 0x7b, 0x0a,
-  0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30,
-  0x2e, 0x73, 0x30, 0x20, 0x26, 0x20, 0x30, 0x78, 0x37, 0x29, 0x20, 0x3d,
-  0x3d, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09,
-  0x75, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61,
-  0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x63,
-  0x6e, 0x74, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x69, 0x66,
-  0x20, 0x28, 0x70, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x31, 0x32, 0x31, 0x36,
-  0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f,
-  0x6d, 0x69, 0x63, 0x5f, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x74, 0x61,
-  0x62, 0x5b, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2e, 0x73, 0x30,
-  0x20, 0x3e, 0x3e, 0x20, 0x33, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31,
-  0x46, 0x46, 0x5d, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x29, 0x3b, 0x20, 0x0a,
-  0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x70,
-  0x6f, 0x73, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x30, 0x2e, 0x73, 0x30, 0x3b, 0x09, 0x0a, 0x09,
-  0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x31, 0x32,
-  0x31, 0x36, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x30, 0x2e, 0x73, 0x31, 0x3b, 0x0a, 0x09, 0x09, 0x09,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x32, 0x34, 0x33, 0x32,
-  0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x30, 0x2e, 0x73, 0x32, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x63,
+  0x0a, 0x09, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x09,
+  0x09, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x4c, 0x6f, 0x73, 0x73, 0x28, 0x26,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x6c, 0x6f, 0x73,
+  0x73, 0x42, 0x61, 0x73, 0x65, 0x5d, 0x2c, 0x20, 0x6c, 0x6f, 0x73, 0x73,
+  0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x7d,
+  0x0a, 0x7d, 0x0a, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61,
+  0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x34,
+  0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x70, 0x6f, 0x73, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x69, 0x64, 0x2c, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20,
+  0x75, 0x69, 0x6e, 0x74, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x2c, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x2a, 0x20, 0x74, 0x61, 0x62, 0x29, 0x20, 0x7b, 0x0a,
+  0x23, 0x69, 0x66, 0x64, 0x65, 0x66, 0x20, 0x43, 0x4f, 0x4c, 0x4c, 0x49,
+  0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x53, 0x4f, 0x52, 0x54, 0x0a, 0x09, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x20, 0x3d,
+  0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28,
+  0x26, 0x74, 0x61, 0x62, 0x5b, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30,
+  0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x33, 0x29, 0x20, 0x26, 0x20,
+  0x30, 0x78, 0x31, 0x46, 0x46, 0x5d, 0x29, 0x3b, 0x09, 0x09, 0x2f, 0x2f,
+  0x20, 0x52, 0x61, 0x6e, 0x6b, 0x20, 0x61, 0x6d, 0x6f, 0x6e, 0x67, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x20, 0x63, 0x6f,
+  0x6c, 0x6c, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x69, 0x74, 0x73,
+  0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x20, 0x3d, 0x20, 0x61, 0x74,
+  0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x74,
+  0x61, 0x62, 0x5b, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2e, 0x73,
+  0x30, 0x20, 0x3e, 0x3e, 0x20, 0x33, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78,
+  0x31, 0x46, 0x46, 0x5d, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x29, 0x3b, 0x20,
+  0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x09, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x5b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2e,
+  0x73, 0x30, 0x3b, 0x09, 0x0a, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x5b, 0x31, 0x32, 0x31, 0x36, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20,
+  0x3d, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2e, 0x73, 0x31, 0x3b,
+  0x0a, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x32, 0x34,
+  0x33, 0x32, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x69, 0x6e,
+  0x70, 0x75, 0x74, 0x30, 0x2e, 0x73, 0x32, 0x3b, 0x0a, 0x09, 0x73, 0x63,
   0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x33, 0x36, 0x34, 0x38, 0x2b, 0x70,
   0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30,
-  0x2e, 0x73, 0x33, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x34, 0x38, 0x36, 0x34, 0x2b, 0x70, 0x6f, 0x73,
-  0x5d, 0x20, 0x3d, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x20, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x36, 0x30, 0x38, 0x30, 0x2b, 0x70, 0x6f, 0x73,
-  0x5d, 0x20, 0x3d, 0x20, 0x69, 0x64, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a,
-  0x09, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72,
-  0x6e, 0x65, 0x6c, 0x20, 0x5f, 0x5f, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
-  0x75, 0x74, 0x65, 0x5f, 0x5f, 0x28, 0x28, 0x72, 0x65, 0x71, 0x64, 0x5f,
-  0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x73,
-  0x69, 0x7a, 0x65, 0x28, 0x32, 0x35, 0x36, 0x2c, 0x20, 0x31, 0x2c, 0x20,
-  0x31, 0x29, 0x29, 0x29, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x6f,
-  0x75, 0x6e, 0x64, 0x31, 0x20, 0x28, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f,
-  0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x31, 0x0a, 0x09, 0x09, 0x5f,
-  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
-  0x34, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x0a,
-  0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
-  0x69, 0x6e, 0x74, 0x34, 0x20, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75,
-  0x74, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
-  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63, 0x6f,
-  0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x75,
-  0x69, 0x6e, 0x74, 0x20, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x20, 0x67, 0x65,
-  0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30,
-  0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x67, 0x72, 0x70,
-  0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70,
-  0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x20, 0x0a, 0x0a, 0x09, 0x75,
-  0x69, 0x6e, 0x74, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d,
-  0x20, 0x67, 0x72, 0x70, 0x20, 0x3e, 0x3e, 0x20, 0x33, 0x3b, 0x0a, 0x09,
-  0x75, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20,
-  0x28, 0x67, 0x72, 0x70, 0x20, 0x26, 0x20, 0x37, 0x29, 0x3b, 0x0a, 0x0a,
-  0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x37, 0x32,
-  0x39, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x20, 0x3d, 0x20, 0x26, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x09,
+  0x2e, 0x73, 0x33, 0x3b, 0x0a, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x5b, 0x34, 0x38, 0x36, 0x34, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20,
+  0x3d, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x20, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x0a, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
+  0x36, 0x30, 0x38, 0x30, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20,
+  0x69, 0x64, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x0a, 0x23, 0x69, 0x66, 0x64,
+  0x65, 0x66, 0x20, 0x4d, 0x45, 0x4d, 0x33, 0x47, 0x0a, 0x75, 0x69, 0x6e,
+  0x74, 0x34, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x52, 0x6f, 0x75, 0x6e, 0x64,
+  0x32, 0x28, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x32, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74,
+  0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x29, 0x20,
+  0x7b, 0x0a, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x75,
+  0x69, 0x6e, 0x74, 0x34, 0x29, 0x20, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
+  0x5b, 0x70, 0x6f, 0x73, 0x5d, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74,
+  0x5b, 0x68, 0x61, 0x6c, 0x66, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2b,
+  0x70, 0x6f, 0x73, 0x5d, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x23, 0x65, 0x6c,
+  0x73, 0x65, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x6c,
+  0x6f, 0x61, 0x64, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x32, 0x28, 0x69, 0x6e,
+  0x70, 0x75, 0x74, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x29, 0x20, 0x28, 0x69,
+  0x6e, 0x70, 0x75, 0x74, 0x29, 0x5b, 0x70, 0x6f, 0x73, 0x5d, 0x0a, 0x23,
+  0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x52, 0x65,
+  0x73, 0x74, 0x6f, 0x72, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x36,
+  0x32, 0x20, 0x62, 0x69, 0x74, 0x20, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61,
+  0x64, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20,
+  0x62, 0x69, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x65, 0x71, 0x75,
+  0x61, 0x6c, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x73, 0x75, 0x62, 0x20,
+  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63,
+  0x61, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x79, 0x20, 0x30, 0x0a, 0x75, 0x69,
+  0x6e, 0x74, 0x34, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x52, 0x6f, 0x75, 0x6e,
+  0x64, 0x33, 0x28, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
+  0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x29,
+  0x20, 0x7b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x65, 0x6c,
+  0x65, 0x6d, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b, 0x70,
+  0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x29, 0x20, 0x28, 0x65, 0x6c,
+  0x65, 0x6d, 0x2e, 0x73, 0x30, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x2c, 0x20,
+  0x28, 0x28, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x31, 0x20, 0x26, 0x20,
+  0x30, 0x78, 0x37, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x29, 0x20, 0x3c,
+  0x3c, 0x20, 0x33, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x65, 0x6c, 0x65, 0x6d,
+  0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x39, 0x29, 0x2c, 0x20,
+  0x30, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x2f, 0x2f,
+  0x20, 0x55, 0x70, 0x70, 0x65, 0x72, 0x20, 0x32, 0x37, 0x20, 0x62, 0x69,
+  0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x31, 0x20, 0x61, 0x72, 0x65,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x20,
+  0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x73, 0x33, 0x20,
+  0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x70,
+  0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x64, 0x69, 0x64, 0x61, 0x74,
+  0x65, 0x73, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x6c, 0x6f, 0x61,
+  0x64, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x34, 0x28, 0x5f, 0x5f, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x2a,
+  0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x70, 0x6f, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x75, 0x69, 0x6e,
+  0x74, 0x32, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20, 0x69, 0x6e,
+  0x70, 0x75, 0x74, 0x5b, 0x70, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x34,
+  0x29, 0x20, 0x28, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x30, 0x2c, 0x20,
+  0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x31, 0x20, 0x26, 0x20, 0x30, 0x78,
+  0x31, 0x46, 0x2c, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x31, 0x20,
+  0x3e, 0x3e, 0x20, 0x35, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x29, 0x3b, 0x0a,
+  0x7d, 0x0a, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x54, 0x77, 0x6f, 0x20, 0x64,
+  0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x70, 0x6f, 0x73,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20,
+  0x73, 0x75, 0x62, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x61,
+  0x73, 0x20, 0x32, 0x30, 0x20, 0x62, 0x69, 0x74, 0x20, 0x63, 0x6f, 0x64,
+  0x65, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72,
+  0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6d, 0x61,
+  0x74, 0x74, 0x65, 0x72, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x61,
+  0x69, 0x72, 0x43, 0x6f, 0x64, 0x65, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x61, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x29, 0x20, 0x7b,
+  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x68, 0x69, 0x20, 0x3d, 0x20,
+  0x6d, 0x61, 0x78, 0x28, 0x61, 0x2c, 0x20, 0x62, 0x29, 0x3b, 0x0a, 0x09,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x28, 0x68, 0x69, 0x20,
+  0x2a, 0x20, 0x28, 0x68, 0x69, 0x2d, 0x31, 0x29, 0x29, 0x20, 0x3e, 0x3e,
+  0x20, 0x31, 0x29, 0x20, 0x2b, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x61, 0x2c,
+  0x20, 0x62, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x75, 0x69, 0x6e, 0x74,
+  0x32, 0x20, 0x70, 0x61, 0x69, 0x72, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x6f, 0x64,
+  0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x68,
+  0x69, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x28,
+  0x28, 0x31, 0x2e, 0x30, 0x66, 0x20, 0x2b, 0x20, 0x73, 0x71, 0x72, 0x74,
+  0x28, 0x31, 0x2e, 0x30, 0x66, 0x20, 0x2b, 0x20, 0x38, 0x2e, 0x30, 0x66,
+  0x20, 0x2a, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x29, 0x29, 0x20, 0x2a, 0x20,
+  0x30, 0x2e, 0x35, 0x66, 0x29, 0x3b, 0x0a, 0x09, 0x77, 0x68, 0x69, 0x6c,
+  0x65, 0x20, 0x28, 0x28, 0x28, 0x68, 0x69, 0x20, 0x2a, 0x20, 0x28, 0x68,
+  0x69, 0x2d, 0x31, 0x29, 0x29, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20,
+  0x3e, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x29, 0x20, 0x68, 0x69, 0x2d, 0x2d,
+  0x3b, 0x0a, 0x09, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x28, 0x28,
+  0x68, 0x69, 0x20, 0x2a, 0x20, 0x28, 0x68, 0x69, 0x2b, 0x31, 0x29, 0x29,
+  0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20, 0x3c, 0x3d, 0x20, 0x63, 0x6f,
+  0x64, 0x65, 0x29, 0x20, 0x68, 0x69, 0x2b, 0x2b, 0x3b, 0x0a, 0x09, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32,
+  0x29, 0x20, 0x28, 0x68, 0x69, 0x2c, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20,
+  0x2d, 0x20, 0x28, 0x28, 0x68, 0x69, 0x20, 0x2a, 0x20, 0x28, 0x68, 0x69,
+  0x2d, 0x31, 0x29, 0x29, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x29, 0x3b,
+  0x0a, 0x7d, 0x0a, 0x0a, 0x0a, 0x2f, 0x2a, 0x0a, 0x09, 0x53, 0x6f, 0x72,
+  0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72,
+  0x79, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x39,
+  0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x62,
+  0x69, 0x74, 0x73, 0x2e, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67,
+  0x34, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x0a, 0x09, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20,
+  0x63, 0x6f, 0x6c, 0x6c, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x61, 0x62, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x64, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x72, 0x61, 0x6e, 0x6b, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x61,
+  0x63, 0x68, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x09,
+  0x61, 0x6d, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x71,
+  0x75, 0x61, 0x6c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x69,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x20,
+  0x31, 0x36, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x73,
+  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x2e, 0x20, 0x41, 0x6e, 0x20,
+  0x65, 0x78, 0x63, 0x6c, 0x75, 0x73, 0x69, 0x76, 0x65, 0x20, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x20, 0x73, 0x75, 0x6d, 0x20, 0x6f, 0x76, 0x65,
+  0x72, 0x0a, 0x09, 0x74, 0x61, 0x62, 0x20, 0x67, 0x69, 0x76, 0x65, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x72, 0x75, 0x6e, 0x2c, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x6f,
+  0x72, 0x64, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x6f, 0x72,
+  0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x70,
+  0x70, 0x65, 0x72, 0x20, 0x31, 0x36, 0x20, 0x62, 0x69, 0x74, 0x73, 0x2e,
+  0x0a, 0x2a, 0x2f, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x6f, 0x72,
+  0x74, 0x43, 0x6f, 0x6c, 0x6c, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x28,
   0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
-  0x20, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x20,
-  0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x31,
-  0x32, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x32, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x32, 0x34, 0x33, 0x32, 0x5d, 0x3b,
-  0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69,
-  0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x33, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x5b, 0x33, 0x36, 0x34, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x20, 0x3d, 0x20, 0x26,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x34, 0x38, 0x36, 0x34,
-  0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20,
-  0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x35, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x5b, 0x36, 0x30, 0x38, 0x30, 0x5d, 0x3b, 0x0a, 0x0a, 0x09,
-  0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
-  0x20, 0x74, 0x61, 0x62, 0x5b, 0x35, 0x31, 0x32, 0x5d, 0x3b, 0x0a, 0x09,
-  0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
-  0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x32, 0x5d, 0x3b, 0x0a, 0x0a, 0x09,
-  0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65,
-  0x72, 0x20, 0x3d, 0x20, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
-  0x73, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
-  0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6f,
-  0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x3d, 0x20,
-  0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x38, 0x31,
-  0x39, 0x32, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6c,
-  0x49, 0x64, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09,
-  0x09, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x30,
-  0x3b, 0x0a, 0x09, 0x09, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x20,
-  0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x2c,
-  0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65,
-  0x74, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x0a,
-  0x0a, 0x09, 0x74, 0x61, 0x62, 0x5b, 0x6c, 0x49, 0x64, 0x5d, 0x20, 0x3d,
-  0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x09, 0x74, 0x61, 0x62,
-  0x5b, 0x6c, 0x49, 0x64, 0x2b, 0x32, 0x35, 0x36, 0x5d, 0x20, 0x3d, 0x20,
-  0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x0a, 0x09, 0x62, 0x61, 0x72,
-  0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43,
-  0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45,
-  0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x66,
-  0x73, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2a, 0x62,
-  0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x09, 0x0a,
-  0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x6c, 0x49,
-  0x64, 0x5d, 0x2c, 0x20, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74,
-  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a,
-  0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x35, 0x36,
-  0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x32, 0x35, 0x36, 0x2b, 0x6c,
-  0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20,
-  0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b,
-  0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b,
-  0x6f, 0x66, 0x73, 0x2b, 0x35, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d,
-  0x2c, 0x20, 0x35, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43,
-  0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29,
-  0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x37,
-  0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x37, 0x36, 0x38,
-  0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d,
-  0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x6d,
-  0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x30, 0x32, 0x34, 0x2b,
-  0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x31, 0x30, 0x32, 0x34, 0x2b, 0x6c,
-  0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20,
-  0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b,
-  0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b,
-  0x6f, 0x66, 0x73, 0x2b, 0x31, 0x32, 0x38, 0x30, 0x2b, 0x6c, 0x49, 0x64,
-  0x5d, 0x2c, 0x20, 0x31, 0x32, 0x38, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c,
-  0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73,
-  0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67,
-  0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73,
-  0x2b, 0x31, 0x35, 0x33, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20,
-  0x31, 0x35, 0x33, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b,
-  0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x37,
-  0x39, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x31, 0x37, 0x39,
-  0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09,
-  0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x30, 0x34, 0x38,
-  0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x32, 0x30, 0x34, 0x38, 0x2b,
-  0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c,
-  0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73,
-  0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30,
-  0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x33, 0x30, 0x34, 0x2b, 0x6c, 0x49,
-  0x64, 0x5d, 0x2c, 0x20, 0x32, 0x33, 0x30, 0x34, 0x2b, 0x6c, 0x49, 0x64,
-  0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61,
-  0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e,
-  0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66,
-  0x73, 0x2b, 0x32, 0x35, 0x36, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c,
-  0x20, 0x32, 0x35, 0x36, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43,
-  0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29,
-  0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x32,
-  0x38, 0x31, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x32, 0x38,
-  0x31, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61,
-  0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a,
-  0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x30, 0x37,
-  0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x33, 0x30, 0x37, 0x32,
-  0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d,
-  0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-  0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x33, 0x32, 0x38, 0x2b, 0x6c,
-  0x49, 0x64, 0x5d, 0x2c, 0x20, 0x33, 0x33, 0x32, 0x38, 0x2b, 0x6c, 0x49,
-  0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d,
-  0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69,
-  0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f,
-  0x66, 0x73, 0x2b, 0x33, 0x35, 0x38, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x5d,
-  0x2c, 0x20, 0x33, 0x35, 0x38, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
-  0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69,
-  0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34,
-  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b,
-  0x33, 0x38, 0x34, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x33,
-  0x38, 0x34, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74,
-  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a,
-  0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x34, 0x30,
-  0x39, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x34, 0x30, 0x39,
-  0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d,
-  0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x34, 0x33, 0x35, 0x32, 0x2b,
-  0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x34, 0x33, 0x35, 0x32, 0x2b, 0x6c,
-  0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20,
-  0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b,
-  0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b,
-  0x6f, 0x66, 0x73, 0x2b, 0x34, 0x36, 0x30, 0x38, 0x2b, 0x6c, 0x49, 0x64,
-  0x5d, 0x2c, 0x20, 0x34, 0x36, 0x30, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c,
-  0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73,
-  0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67,
-  0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73,
-  0x2b, 0x34, 0x38, 0x36, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20,
-  0x34, 0x38, 0x36, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b,
-  0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x35,
-  0x31, 0x32, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x35, 0x31,
-  0x32, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61,
-  0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09,
-  0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x33, 0x37, 0x36,
-  0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x35, 0x33, 0x37, 0x36, 0x2b,
-  0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c,
-  0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73,
-  0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30,
-  0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x36, 0x33, 0x32, 0x2b, 0x6c, 0x49,
-  0x64, 0x5d, 0x2c, 0x20, 0x35, 0x36, 0x33, 0x32, 0x2b, 0x6c, 0x49, 0x64,
-  0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61,
-  0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e,
-  0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66,
-  0x73, 0x2b, 0x35, 0x38, 0x38, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c,
-  0x20, 0x35, 0x38, 0x38, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43,
-  0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29,
-  0x3b, 0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34,
-  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b,
-  0x36, 0x31, 0x34, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x36,
-  0x31, 0x34, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74,
-  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a,
-  0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x36, 0x34, 0x30,
-  0x30, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x36, 0x34, 0x30, 0x30,
-  0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d,
-  0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-  0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x36, 0x36, 0x35, 0x36, 0x2b, 0x6c,
-  0x49, 0x64, 0x5d, 0x2c, 0x20, 0x36, 0x36, 0x35, 0x36, 0x2b, 0x6c, 0x49,
-  0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d,
-  0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69,
-  0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f,
-  0x66, 0x73, 0x2b, 0x36, 0x39, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d,
-  0x2c, 0x20, 0x36, 0x39, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
-  0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69,
-  0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67,
-  0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73,
-  0x2b, 0x37, 0x31, 0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20,
-  0x37, 0x31, 0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b,
-  0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x34,
-  0x32, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x37, 0x34, 0x32,
-  0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x69,
-  0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x37, 0x36,
-  0x38, 0x30, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30,
-  0x5d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x37,
-  0x36, 0x38, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x37, 0x36,
-  0x38, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61,
-  0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09,
-  0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x37,
-  0x39, 0x33, 0x36, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x30, 0x5d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34,
-  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b,
-  0x37, 0x39, 0x33, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x37,
-  0x39, 0x33, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74,
-  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a,
-  0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b,
-  0x20, 0x38, 0x31, 0x39, 0x32, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x30, 0x5d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e,
-  0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66,
-  0x73, 0x2b, 0x38, 0x31, 0x39, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c,
-  0x20, 0x38, 0x31, 0x39, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43,
-  0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29,
-  0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20,
-  0x2b, 0x20, 0x38, 0x34, 0x34, 0x38, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x43,
-  0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69,
-  0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f,
-  0x66, 0x73, 0x2b, 0x38, 0x34, 0x34, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d,
-  0x2c, 0x20, 0x38, 0x34, 0x34, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
-  0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69,
-  0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x29, 0x3b, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69,
-  0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c,
-  0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b,
-  0x09, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x4c,
-  0x69, 0x6d, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29,
-  0x20, 0x31, 0x32, 0x31, 0x36, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x62, 0x61,
-  0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f,
-  0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43,
-  0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f,
-  0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64, 0x3b,
-  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x3d,
-  0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x6f, 0x77,
-  0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74,
-  0x20, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6f, 0x77,
-  0x6e, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x75, 0x63,
-  0x6b, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x63, 0x6e, 0x74, 0x3d, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x75,
-  0x69, 0x6e, 0x74, 0x38, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45,
-  0x6c, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20,
-  0x28, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e,
-  0x4c, 0x69, 0x6d, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x28, 0x6f, 0x74,
-  0x68, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d,
-  0x29, 0x20, 0x3f, 0x20, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3a,
-  0x20, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x2b, 0x32, 0x35, 0x36, 0x3b,
-  0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d,
-  0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x5b,
-  0x61, 0x64, 0x64, 0x72, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x09,
-  0x69, 0x66, 0x20, 0x28, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3c,
-  0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09,
-  0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x30,
-  0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b,
-  0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x5e, 0x20, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x6f, 0x74, 0x68, 0x50, 0x6f,
-  0x73, 0x5d, 0x3b, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70,
-  0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x6f, 0x77, 0x6e, 0x50, 0x6f,
+  0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x2c, 0x20, 0x5f,
+  0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x2a,
+  0x20, 0x74, 0x61, 0x62, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69,
+  0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x73, 0x20, 0x3d,
+  0x20, 0x31, 0x3b, 0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x64, 0x20, 0x3d, 0x20, 0x32, 0x35, 0x36, 0x3b,
+  0x20, 0x64, 0x20, 0x3e, 0x20, 0x30, 0x3b, 0x20, 0x64, 0x20, 0x3e, 0x3e,
+  0x3d, 0x20, 0x31, 0x29, 0x20, 0x7b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f,
+  0x2f, 0x20, 0x55, 0x70, 0x20, 0x73, 0x77, 0x65, 0x65, 0x70, 0x0a, 0x09,
+  0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b,
+  0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46,
+  0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x64, 0x29, 0x20, 0x74, 0x61,
+  0x62, 0x5b, 0x6f, 0x66, 0x73, 0x2a, 0x28, 0x32, 0x2a, 0x6c, 0x49, 0x64,
+  0x2b, 0x32, 0x29, 0x2d, 0x31, 0x5d, 0x20, 0x2b, 0x3d, 0x20, 0x74, 0x61,
+  0x62, 0x5b, 0x6f, 0x66, 0x73, 0x2a, 0x28, 0x32, 0x2a, 0x6c, 0x49, 0x64,
+  0x2b, 0x31, 0x29, 0x2d, 0x31, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x6f, 0x66,
+  0x73, 0x20, 0x3c, 0x3c, 0x3d, 0x20, 0x31, 0x3b, 0x0a, 0x09, 0x7d, 0x0a,
+  0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c,
+  0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f,
+  0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x74,
+  0x61, 0x62, 0x5b, 0x35, 0x31, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b,
+  0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x64, 0x20, 0x3d, 0x20, 0x31, 0x3b, 0x20, 0x64, 0x20, 0x3c, 0x20,
+  0x35, 0x31, 0x32, 0x3b, 0x20, 0x64, 0x20, 0x3c, 0x3c, 0x3d, 0x20, 0x31,
+  0x29, 0x20, 0x7b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x44,
+  0x6f, 0x77, 0x6e, 0x20, 0x73, 0x77, 0x65, 0x65, 0x70, 0x0a, 0x09, 0x09,
+  0x6f, 0x66, 0x73, 0x20, 0x3e, 0x3e, 0x3d, 0x20, 0x31, 0x3b, 0x0a, 0x09,
+  0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b,
+  0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46,
+  0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x64, 0x29, 0x20, 0x7b, 0x0a,
+  0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x6d, 0x70, 0x20,
+  0x3d, 0x20, 0x74, 0x61, 0x62, 0x5b, 0x6f, 0x66, 0x73, 0x2a, 0x28, 0x32,
+  0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x31, 0x29, 0x2d, 0x31, 0x5d, 0x3b, 0x0a,
+  0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x5b, 0x6f, 0x66, 0x73, 0x2a, 0x28,
+  0x32, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x31, 0x29, 0x2d, 0x31, 0x5d, 0x20,
+  0x3d, 0x20, 0x74, 0x61, 0x62, 0x5b, 0x6f, 0x66, 0x73, 0x2a, 0x28, 0x32,
+  0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x32, 0x29, 0x2d, 0x31, 0x5d, 0x3b, 0x0a,
+  0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x5b, 0x6f, 0x66, 0x73, 0x2a, 0x28,
+  0x32, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x32, 0x29, 0x2d, 0x31, 0x5d, 0x20,
+  0x2b, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a,
+  0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72,
+  0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d,
+  0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a,
+  0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x70,
+  0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64, 0x3b, 0x20, 0x70, 0x20, 0x3c, 0x20,
+  0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x3b, 0x20, 0x70, 0x20, 0x2b, 0x3d, 0x20,
+  0x32, 0x35, 0x36, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20,
+  0x74, 0x61, 0x62, 0x5b, 0x28, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x5b, 0x70, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x33, 0x29, 0x20, 0x26, 0x20,
+  0x30, 0x78, 0x31, 0x46, 0x46, 0x5d, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x63,
+  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x34, 0x38, 0x36, 0x34, 0x2b, 0x70,
+  0x5d, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x29, 0x3b,
+  0x0a, 0x09, 0x09, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x6f, 0x72,
+  0x28, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x34, 0x38,
+  0x36, 0x34, 0x2b, 0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73, 0x5d, 0x2c,
+  0x20, 0x70, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x36, 0x29, 0x3b, 0x0a, 0x09,
+  0x7d, 0x0a, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28,
+  0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45,
+  0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x7d, 0x0a,
+  0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x69,
+  0x64, 0x65, 0x31, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e,
+  0x50, 0x6f, 0x73, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x74,
+  0x68, 0x50, 0x6f, 0x73, 0x2c, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61,
+  0x74, 0x63, 0x68, 0x2c, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61,
+  0x6c, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x30, 0x2c,
+  0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69,
+  0x6e, 0x74, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74,
+  0x65, 0x72, 0x2c, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x2a, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x2c,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
+  0x29, 0x20, 0x7b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x75,
+  0x63, 0x6b, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x3b, 0x0a, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x38, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c,
+  0x3b, 0x0a, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c,
+  0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x5b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x5e, 0x20,
+  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x6f, 0x74, 0x68, 0x50,
+  0x6f, 0x73, 0x5d, 0x3b, 0x09, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x45, 0x6c, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x5b, 0x31, 0x32, 0x31, 0x36, 0x2b, 0x6f, 0x77,
+  0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x5e, 0x20, 0x73, 0x63, 0x72, 0x61,
+  0x74, 0x63, 0x68, 0x5b, 0x31, 0x32, 0x31, 0x36, 0x2b, 0x6f, 0x74, 0x68,
+  0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x31, 0x20, 0x21,
+  0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x62, 0x75, 0x63,
+  0x6b, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x45, 0x6c, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x32,
+  0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x29, 0x20,
+  0x3c, 0x3c, 0x20, 0x33, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e,
+  0x20, 0x32, 0x35, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x37, 0x29, 0x3b,
+  0x09, 0x2f, 0x2f, 0x20, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x6f, 0x66, 0x20, 0x6e,
+  0x65, 0x78, 0x74, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x0a, 0x09, 0x09,
+  0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63,
+  0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75,
+  0x6e, 0x74, 0x65, 0x72, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x5d, 0x29, 0x3b,
+  0x0a, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c,
+  0x2e, 0x73, 0x32, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x5b, 0x32, 0x34, 0x33, 0x32, 0x2b, 0x6f, 0x77, 0x6e, 0x50, 0x6f,
   0x73, 0x5d, 0x20, 0x5e, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x31, 0x5b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09,
-  0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
-  0x45, 0x6c, 0x2e, 0x73, 0x31, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x20,
-  0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x20, 0x3d,
+  0x5b, 0x32, 0x34, 0x33, 0x32, 0x2b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73,
+  0x5d, 0x3b, 0x09, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x45, 0x6c, 0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61,
+  0x74, 0x63, 0x68, 0x5b, 0x33, 0x36, 0x34, 0x38, 0x2b, 0x6f, 0x77, 0x6e,
+  0x50, 0x6f, 0x73, 0x5d, 0x20, 0x5e, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74,
+  0x63, 0x68, 0x5b, 0x33, 0x36, 0x34, 0x38, 0x2b, 0x6f, 0x74, 0x68, 0x50,
+  0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x45, 0x6c, 0x2e, 0x6c, 0x6f, 0x20, 0x3d, 0x20, 0x73, 0x68,
+  0x72, 0x5f, 0x34, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c,
+  0x2e, 0x6c, 0x6f, 0x2c, 0x32, 0x35, 0x29, 0x3b, 0x20, 0x09, 0x09, 0x09,
+  0x2f, 0x2f, 0x20, 0x53, 0x68, 0x69, 0x66, 0x74, 0x20, 0x61, 0x77, 0x61,
+  0x79, 0x20, 0x32, 0x35, 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a, 0x0a, 0x09,
+  0x09, 0x2f, 0x2f, 0x20, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73,
+  0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x32, 0x2a, 0x31, 0x34, 0x20, 0x62,
+  0x69, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x70, 0x6c, 0x75,
+  0x73, 0x20, 0x31, 0x33, 0x20, 0x62, 0x69, 0x74, 0x20, 0x62, 0x75, 0x63,
+  0x6b, 0x65, 0x74, 0x0a, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x53, 0x6f, 0x20,
+  0x31, 0x32, 0x35, 0x20, 0x2d, 0x20, 0x32, 0x35, 0x20, 0x2d, 0x20, 0x31,
+  0x33, 0x20, 0x3d, 0x20, 0x38, 0x37, 0x20, 0x62, 0x69, 0x74, 0x20, 0x70,
+  0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x70, 0x6c, 0x75, 0x73, 0x20,
+  0x34, 0x31, 0x20, 0x62, 0x69, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78,
+  0x20, 0x74, 0x72, 0x65, 0x65, 0x0a, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x31,
+  0x32, 0x38, 0x20, 0x62, 0x69, 0x74, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c,
+  0x20, 0x2d, 0x20, 0x66, 0x69, 0x74, 0x20, 0x65, 0x78, 0x61, 0x63, 0x74,
+  0x6c, 0x79, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34,
+  0x20, 0x3a, 0x44, 0x20, 0x0a, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20, 0x73, 0x63,
+  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x36, 0x30, 0x38, 0x30, 0x2b, 0x6f,
+  0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x33, 0x20, 0x7c, 0x3d,
+  0x20, 0x28, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x36, 0x30,
+  0x38, 0x30, 0x2b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x3c,
+  0x3c, 0x20, 0x31, 0x34, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x33, 0x20, 0x7c, 0x3d, 0x20,
+  0x28, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3c, 0x3c, 0x20, 0x32,
+  0x38, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x45, 0x6c, 0x2e, 0x73, 0x32, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x62,
+  0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3e, 0x3e, 0x20, 0x34, 0x29, 0x20,
+  0x3c, 0x3c, 0x20, 0x32, 0x33, 0x3b, 0x20, 0x0a, 0x0a, 0x09, 0x09, 0x69,
+  0x66, 0x20, 0x28, 0x70, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x73, 0x75, 0x62,
+  0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20,
+  0x7b, 0x0a, 0x09, 0x09, 0x09, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20,
+  0x62, 0x75, 0x63, 0x6b, 0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b,
+  0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x0a, 0x23, 0x69, 0x66, 0x64,
+  0x65, 0x66, 0x20, 0x4d, 0x45, 0x4d, 0x33, 0x47, 0x0a, 0x09, 0x09, 0x09,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x70, 0x6f, 0x73, 0x5d,
+  0x20, 0x3d, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e,
+  0x73, 0x30, 0x31, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x30, 0x5b, 0x68, 0x61, 0x6c, 0x66, 0x4f, 0x66, 0x66, 0x73,
+  0x65, 0x74, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x32, 0x33, 0x3b, 0x0a,
+  0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x30, 0x5b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x6c, 0x6f, 0x3b,
+  0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x09, 0x09, 0x7d, 0x20,
+  0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x4c, 0x6f, 0x73, 0x73, 0x28, 0x6c, 0x6f, 0x73, 0x73,
+  0x2c, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74,
+  0x30, 0x2b, 0x31, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d,
+  0x0a, 0x7d, 0x0a, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x54, 0x77, 0x6f, 0x20,
+  0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x31, 0x20, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+  0x20, 0x30, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x63, 0x61,
+  0x6e, 0x20, 0x6e, 0x65, 0x76, 0x65, 0x72, 0x20, 0x62, 0x65, 0x20, 0x70,
+  0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6c,
+  0x69, 0x64, 0x0a, 0x2f, 0x2f, 0x20, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69,
+  0x6f, 0x6e, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x69, 0x72, 0x20, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x20, 0x74, 0x72, 0x65, 0x65, 0x73, 0x20, 0x61, 0x72,
+  0x65, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2c, 0x20, 0x73, 0x6f, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x69, 0x73, 0x20,
+  0x66, 0x72, 0x65, 0x65, 0x2e, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73,
+  0x68, 0x61, 0x72, 0x65, 0x73, 0x50, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x28,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x2c,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73,
+  0x2c, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69,
+  0x6e, 0x74, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x29,
+  0x20, 0x7b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e,
+  0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x33,
+  0x36, 0x34, 0x38, 0x2b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x3b,
+  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x74, 0x68, 0x20, 0x3d,
+  0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x33, 0x36, 0x34,
+  0x38, 0x2b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x0a,
+  0x09, 0x2f, 0x2f, 0x20, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x30, 0x2c, 0x20, 0x75,
+  0x70, 0x70, 0x65, 0x72, 0x20, 0x39, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x73, 0x32, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x75, 0x70,
+  0x70, 0x65, 0x72, 0x20, 0x34, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x6f,
+  0x66, 0x20, 0x73, 0x33, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x28,
+  0x28, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x32, 0x34, 0x33,
+  0x32, 0x2b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x5e, 0x20,
+  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x32, 0x34, 0x33, 0x32,
+  0x2b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x29, 0x20, 0x3e, 0x3e,
+  0x20, 0x32, 0x33, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7c,
+  0x7c, 0x20, 0x28, 0x28, 0x28, 0x6f, 0x77, 0x6e, 0x20, 0x5e, 0x20, 0x6f,
+  0x74, 0x68, 0x29, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x38, 0x29, 0x20, 0x21,
+  0x3d, 0x20, 0x30, 0x29, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x30, 0x20, 0x3d, 0x20, 0x6f, 0x77,
+  0x6e, 0x20, 0x26, 0x20, 0x30, 0x78, 0x33, 0x46, 0x46, 0x46, 0x2c, 0x20,
+  0x6f, 0x77, 0x6e, 0x31, 0x20, 0x3d, 0x20, 0x28, 0x6f, 0x77, 0x6e, 0x20,
+  0x3e, 0x3e, 0x20, 0x31, 0x34, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x33,
+  0x46, 0x46, 0x46, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f,
+  0x74, 0x68, 0x30, 0x20, 0x3d, 0x20, 0x6f, 0x74, 0x68, 0x20, 0x26, 0x20,
+  0x30, 0x78, 0x33, 0x46, 0x46, 0x46, 0x2c, 0x20, 0x6f, 0x74, 0x68, 0x31,
+  0x20, 0x3d, 0x20, 0x28, 0x6f, 0x74, 0x68, 0x20, 0x3e, 0x3e, 0x20, 0x31,
+  0x34, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x33, 0x46, 0x46, 0x46, 0x3b,
+  0x0a, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x6f, 0x77,
+  0x6e, 0x30, 0x20, 0x3d, 0x3d, 0x20, 0x6f, 0x74, 0x68, 0x30, 0x29, 0x20,
+  0x7c, 0x7c, 0x20, 0x28, 0x6f, 0x77, 0x6e, 0x30, 0x20, 0x3d, 0x3d, 0x20,
+  0x6f, 0x74, 0x68, 0x31, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x28, 0x6f, 0x77,
+  0x6e, 0x31, 0x20, 0x3d, 0x3d, 0x20, 0x6f, 0x74, 0x68, 0x30, 0x29, 0x20,
+  0x7c, 0x7c, 0x20, 0x28, 0x6f, 0x77, 0x6e, 0x31, 0x20, 0x3d, 0x3d, 0x20,
+  0x6f, 0x74, 0x68, 0x31, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x0a, 0x76,
+  0x6f, 0x69, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x69, 0x64, 0x65, 0x32,
+  0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73,
+  0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x74, 0x68, 0x50, 0x6f,
+  0x73, 0x2c, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x2c, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x30,
+  0x2c, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e,
+  0x74, 0x65, 0x72, 0x2c, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61,
+  0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x2a, 0x20, 0x6c, 0x6f, 0x73, 0x73,
+  0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x67, 0x72, 0x70, 0x29, 0x20,
+  0x7b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x75, 0x63, 0x6b,
+  0x2c, 0x20, 0x70, 0x6f, 0x73, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x38, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x3b, 0x0a,
+  0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73,
+  0x30, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
+  0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x5e, 0x20, 0x73, 0x63,
+  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73,
+  0x5d, 0x3b, 0x09, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45,
+  0x6c, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74,
+  0x63, 0x68, 0x5b, 0x31, 0x32, 0x31, 0x36, 0x2b, 0x6f, 0x77, 0x6e, 0x50,
+  0x6f, 0x73, 0x5d, 0x20, 0x5e, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x5b, 0x31, 0x32, 0x31, 0x36, 0x2b, 0x6f, 0x74, 0x68, 0x50, 0x6f,
+  0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x31, 0x20, 0x21, 0x3d, 0x20,
+  0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x73,
+  0x68, 0x61, 0x72, 0x65, 0x73, 0x50, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x28,
+  0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x2c, 0x20, 0x6f, 0x74, 0x68, 0x50,
+  0x6f, 0x73, 0x2c, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x29,
+  0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x4c, 0x6f, 0x73, 0x73, 0x28, 0x6c, 0x6f, 0x73, 0x73, 0x2c, 0x20, 0x6c,
+  0x6f, 0x73, 0x73, 0x50, 0x72, 0x75, 0x6e, 0x65, 0x64, 0x29, 0x3b, 0x0a,
+  0x09, 0x09, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x09,
+  0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x20, 0x3d,
+  0x20, 0x28, 0x28, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c,
+  0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x32, 0x29, 0x20, 0x26,
+  0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x29, 0x20, 0x3c, 0x3c, 0x20,
+  0x33, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x45, 0x6c, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x35,
+  0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x37, 0x29, 0x3b, 0x09, 0x2f, 0x2f,
+  0x20, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x6d, 0x61, 0x73, 0x6b, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x65, 0x78, 0x74,
+  0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x0a, 0x09, 0x09, 0x70, 0x6f, 0x73,
+  0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x69, 0x6e,
+  0x63, 0x28, 0x26, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65,
+  0x72, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x5d, 0x29, 0x3b, 0x0a, 0x0a, 0x09,
+  0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x32,
+  0x20, 0x3d, 0x20, 0x28, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
+  0x32, 0x34, 0x33, 0x32, 0x2b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d,
+  0x20, 0x5e, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x32,
+  0x34, 0x33, 0x32, 0x2b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x29,
+  0x20, 0x26, 0x20, 0x30, 0x78, 0x37, 0x46, 0x46, 0x46, 0x46, 0x46, 0x3b,
+  0x09, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c,
+  0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x09,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x6c, 0x6f, 0x20,
+  0x3d, 0x20, 0x73, 0x68, 0x72, 0x5f, 0x34, 0x28, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x45, 0x6c, 0x2e, 0x6c, 0x6f, 0x2c, 0x32, 0x35, 0x29, 0x3b,
+  0x20, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x53, 0x68, 0x69, 0x66, 0x74,
+  0x20, 0x61, 0x77, 0x61, 0x79, 0x20, 0x32, 0x35, 0x20, 0x62, 0x69, 0x74,
+  0x73, 0x0a, 0x0a, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x36, 0x32, 0x20, 0x2d,
+  0x20, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x39, 0x20, 0x62, 0x69, 0x74, 0x20,
+  0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x70, 0x6c, 0x75, 0x73,
+  0x20, 0x33, 0x36, 0x20, 0x62, 0x69, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65,
+  0x78, 0x20, 0x70, 0x61, 0x69, 0x72, 0x2c, 0x20, 0x39, 0x36, 0x20, 0x62,
+  0x69, 0x74, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x0a, 0x09, 0x09, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x74, 0x72, 0x65, 0x65, 0x20, 0x3d, 0x20, 0x28,
+  0x67, 0x72, 0x70, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x30, 0x29, 0x20, 0x7c,
+  0x20, 0x70, 0x61, 0x69, 0x72, 0x43, 0x6f, 0x64, 0x65, 0x28, 0x6f, 0x77,
+  0x6e, 0x50, 0x6f, 0x73, 0x2c, 0x20, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73,
+  0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x45, 0x6c, 0x2e, 0x73, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20,
+  0x33, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x45, 0x6c, 0x2e, 0x73, 0x31, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x39, 0x29,
+  0x3b, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c,
+  0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x45, 0x6c, 0x2e, 0x73, 0x31, 0x20, 0x3e, 0x3e, 0x20, 0x33, 0x29,
+  0x20, 0x7c, 0x20, 0x28, 0x28, 0x67, 0x72, 0x70, 0x20, 0x3e, 0x3e, 0x20,
+  0x31, 0x32, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x37, 0x29, 0x3b, 0x0a,
+  0x0a, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x70, 0x6f, 0x73, 0x20, 0x3c,
+  0x20, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69,
+  0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x70, 0x6f, 0x73,
+  0x20, 0x2b, 0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x2a, 0x73, 0x75, 0x62,
+  0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x0a,
+  0x09, 0x09, 0x09, 0x28, 0x28, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61,
+  0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x2a, 0x29, 0x20, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x30, 0x29, 0x5b, 0x70, 0x6f, 0x73, 0x5d,
+  0x20, 0x3d, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e,
+  0x73, 0x32, 0x33, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x30, 0x5b, 0x74, 0x72, 0x65, 0x65, 0x4f, 0x66, 0x66, 0x73,
+  0x65, 0x74, 0x2b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x72,
+  0x65, 0x65, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65,
+  0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x4c,
+  0x6f, 0x73, 0x73, 0x28, 0x6c, 0x6f, 0x73, 0x73, 0x2c, 0x20, 0x6c, 0x6f,
+  0x73, 0x73, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x30, 0x2b, 0x32, 0x29,
+  0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a,
+  0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x69, 0x64,
+  0x65, 0x33, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x50,
+  0x6f, 0x73, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x74, 0x68,
+  0x50, 0x6f, 0x73, 0x2c, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74,
+  0x63, 0x68, 0x2c, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x30, 0x2c, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61,
+  0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x43,
+  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x5f, 0x5f, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x2a, 0x20, 0x6c,
+  0x6f, 0x73, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x62, 0x75, 0x63, 0x6b, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x3b, 0x0a,
+  0x09, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x45, 0x6c, 0x3b, 0x0a, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x45, 0x6c, 0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x5b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d,
+  0x20, 0x5e, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x6f,
+  0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x09, 0x0a, 0x09, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20,
+  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x31, 0x32, 0x31, 0x36,
+  0x2b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x5e, 0x20, 0x73,
+  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x31, 0x32, 0x31, 0x36, 0x2b,
+  0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x69, 0x66,
   0x20, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73,
-  0x30, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x32, 0x29, 0x20, 0x26, 0x20, 0x30,
-  0x78, 0x31, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x70,
-  0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f,
-  0x69, 0x6e, 0x63, 0x28, 0x26, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x5d, 0x29, 0x3b, 0x0a,
-  0x0a, 0x09, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45,
+  0x31, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09,
+  0x62, 0x75, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e,
+  0x20, 0x31, 0x32, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46,
+  0x46, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29, 0x20, 0x7c, 0x20, 0x28,
+  0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x30,
+  0x20, 0x3e, 0x3e, 0x20, 0x32, 0x35, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78,
+  0x37, 0x29, 0x3b, 0x09, 0x2f, 0x2f, 0x20, 0x42, 0x75, 0x63, 0x6b, 0x65,
+  0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x6f,
+  0x66, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+  0x0a, 0x09, 0x09, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f,
+  0x6d, 0x69, 0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x6f, 0x75, 0x74,
+  0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x62, 0x75, 0x63, 0x6b,
+  0x5d, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x45, 0x6c, 0x2e, 0x73, 0x32, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20,
+  0x09, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c,
+  0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x09,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x6c, 0x6f, 0x20,
+  0x3d, 0x20, 0x73, 0x68, 0x72, 0x5f, 0x34, 0x28, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x45, 0x6c, 0x2e, 0x6c, 0x6f, 0x2c, 0x32, 0x35, 0x29, 0x3b,
+  0x20, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x53, 0x68, 0x69, 0x66, 0x74,
+  0x20, 0x61, 0x77, 0x61, 0x79, 0x20, 0x32, 0x35, 0x20, 0x62, 0x69, 0x74,
+  0x73, 0x0a, 0x0a, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45,
   0x6c, 0x2e, 0x73, 0x32, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x32, 0x5b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20,
-  0x5e, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x32, 0x5b, 0x6f,
-  0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x09, 0x0a, 0x09, 0x09, 0x09,
-  0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x33,
-  0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x33, 0x5b,
+  0x63, 0x68, 0x5b, 0x36, 0x30, 0x38, 0x30, 0x2b, 0x6f, 0x77, 0x6e, 0x50,
+  0x6f, 0x73, 0x5d, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20,
+  0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x73,
+  0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x64, 0x0a, 0x0a, 0x09, 0x09, 0x69,
+  0x66, 0x20, 0x28, 0x70, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x73, 0x75, 0x62,
+  0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20,
+  0x7b, 0x0a, 0x09, 0x09, 0x09, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20,
+  0x62, 0x75, 0x63, 0x6b, 0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b,
+  0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x70, 0x6f, 0x73, 0x5d, 0x20,
+  0x3d, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x29, 0x20, 0x28, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x30, 0x2c, 0x20,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x31, 0x20,
+  0x7c, 0x20, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e,
+  0x73, 0x32, 0x20, 0x3c, 0x3c, 0x20, 0x35, 0x29, 0x29, 0x3b, 0x09, 0x2f,
+  0x2f, 0x20, 0x33, 0x37, 0x20, 0x62, 0x69, 0x74, 0x20, 0x70, 0x61, 0x79,
+  0x6c, 0x6f, 0x61, 0x64, 0x0a, 0x09, 0x09, 0x7d, 0x20, 0x65, 0x6c, 0x73,
+  0x65, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x4c, 0x6f, 0x73, 0x73, 0x28, 0x6c, 0x6f, 0x73, 0x73, 0x2c, 0x20, 0x6c,
+  0x6f, 0x73, 0x73, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x30, 0x2b, 0x33,
+  0x29, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x7d, 0x0a,
+  0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x69,
+  0x64, 0x65, 0x34, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e,
+  0x50, 0x6f, 0x73, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x74,
+  0x68, 0x50, 0x6f, 0x73, 0x2c, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61,
+  0x74, 0x63, 0x68, 0x2c, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61,
+  0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x2a, 0x20, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x30, 0x2c, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
+  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x2a, 0x20, 0x6f, 0x75, 0x74,
+  0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x5f, 0x5f, 0x67,
+  0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x2a, 0x20,
+  0x6c, 0x6f, 0x73, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x70, 0x6f, 0x73, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x32, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x3b, 0x0a,
+  0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73,
+  0x30, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
   0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x5e, 0x20, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x33, 0x5b, 0x6f, 0x74, 0x68, 0x50, 0x6f,
-  0x73, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74,
-  0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x6c, 0x6f, 0x20, 0x3d, 0x20, 0x73,
-  0x68, 0x72, 0x5f, 0x34, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45,
-  0x6c, 0x2e, 0x6c, 0x6f, 0x2c, 0x32, 0x35, 0x29, 0x3b, 0x20, 0x09, 0x09,
-  0x09, 0x2f, 0x2f, 0x20, 0x53, 0x68, 0x69, 0x66, 0x74, 0x20, 0x61, 0x77,
-  0x61, 0x79, 0x20, 0x32, 0x35, 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a, 0x0a,
-  0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x45, 0x6c, 0x65, 0x6d, 0x65,
-  0x6e, 0x74, 0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x32, 0x2a, 0x31,
-  0x34, 0x20, 0x62, 0x69, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20,
-  0x70, 0x6c, 0x75, 0x73, 0x20, 0x31, 0x33, 0x20, 0x62, 0x69, 0x74, 0x20,
-  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x2f,
-  0x2f, 0x20, 0x53, 0x6f, 0x20, 0x31, 0x32, 0x35, 0x20, 0x2d, 0x20, 0x32,
-  0x35, 0x20, 0x2d, 0x20, 0x31, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x37, 0x20,
-  0x62, 0x69, 0x74, 0x20, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x20,
-  0x70, 0x6c, 0x75, 0x73, 0x20, 0x34, 0x31, 0x20, 0x62, 0x69, 0x74, 0x20,
-  0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x74, 0x72, 0x65, 0x65, 0x0a, 0x09,
-  0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x31, 0x32, 0x38, 0x20, 0x62, 0x69,
-  0x74, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x20, 0x2d, 0x20, 0x66, 0x69,
-  0x74, 0x20, 0x65, 0x78, 0x61, 0x63, 0x74, 0x6c, 0x79, 0x20, 0x6f, 0x6e,
-  0x65, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x3a, 0x44, 0x20, 0x0a,
-  0x0a, 0x09, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45,
-  0x6c, 0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x35, 0x5b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x3b,
-  0x0a, 0x09, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45,
-  0x6c, 0x2e, 0x73, 0x33, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x35, 0x5b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73,
-  0x5d, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x34, 0x29, 0x3b, 0x0a, 0x09, 0x09,
-  0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73,
-  0x33, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
-  0x20, 0x3c, 0x3c, 0x20, 0x32, 0x38, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09,
-  0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73,
-  0x32, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
-  0x20, 0x3e, 0x3e, 0x20, 0x34, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x33,
-  0x3b, 0x20, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28,
-  0x70, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
-  0x53, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b,
-  0x2a, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b,
-  0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
-  0x30, 0x5b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x6f, 0x75, 0x74,
-  0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x6c, 0x6f, 0x3b, 0x0a, 0x09, 0x09,
-  0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x7d,
-  0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x20, 0x0a, 0x09, 0x09, 0x09,
-  0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x3b, 0x0a,
-  0x09, 0x09, 0x09, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x2b, 0x3d,
-  0x20, 0x32, 0x35, 0x36, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x0a, 0x09,
-  0x09, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x65, 0x6c,
-  0x65, 0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73,
-  0x20, 0x3d, 0x20, 0x28, 0x63, 0x6e, 0x74, 0x3c, 0x34, 0x30, 0x29, 0x20,
-  0x3f, 0x20, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3a, 0x20, 0x69,
-  0x6e, 0x4c, 0x69, 0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x63, 0x6e, 0x74, 0x2b,
-  0x2b, 0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x7d, 0x0a, 0x0a, 0x0a, 0x5f,
-  0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x5f, 0x5f, 0x61, 0x74,
-  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x5f, 0x5f, 0x28, 0x28, 0x72,
-  0x65, 0x71, 0x64, 0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x67, 0x72, 0x6f,
-  0x75, 0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x32, 0x35, 0x36, 0x2c,
-  0x20, 0x31, 0x2c, 0x20, 0x31, 0x29, 0x29, 0x29, 0x20, 0x76, 0x6f, 0x69,
-  0x64, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x32, 0x20, 0x28, 0x09, 0x09,
-  0x09, 0x09, 0x2f, 0x2f, 0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x32,
-  0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
-  0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x70, 0x75,
+  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73,
+  0x5d, 0x3b, 0x09, 0x0a, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45,
+  0x6c, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74,
+  0x63, 0x68, 0x5b, 0x31, 0x32, 0x31, 0x36, 0x2b, 0x6f, 0x77, 0x6e, 0x50,
+  0x6f, 0x73, 0x5d, 0x20, 0x5e, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x5b, 0x31, 0x32, 0x31, 0x36, 0x2b, 0x6f, 0x74, 0x68, 0x50, 0x6f,
+  0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x30, 0x20, 0x3d, 0x3d,
+  0x20, 0x30, 0x29, 0x20, 0x26, 0x26, 0x20, 0x28, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x3d, 0x20, 0x30,
+  0x29, 0x29, 0x20, 0x7b, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4c, 0x61,
+  0x73, 0x74, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x77, 0x65, 0x20,
+  0x77, 0x61, 0x6e, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x62, 0x69, 0x74,
+  0x73, 0x20, 0x74, 0x6f, 0x20, 0x76, 0x61, 0x6e, 0x69, 0x73, 0x68, 0x0a,
+  0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x69, 0x6e, 0x64, 0x65,
+  0x78, 0x3b, 0x0a, 0x09, 0x09, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73,
+  0x30, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
+  0x32, 0x34, 0x33, 0x32, 0x2b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d,
+  0x3b, 0x0a, 0x09, 0x09, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73, 0x31,
+  0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x33,
+  0x36, 0x34, 0x38, 0x2b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x3b,
+  0x0a, 0x09, 0x09, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73, 0x32, 0x20,
+  0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x32, 0x34,
+  0x33, 0x32, 0x2b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a,
+  0x09, 0x09, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73, 0x33, 0x20, 0x3d,
+  0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x33, 0x36, 0x34,
+  0x38, 0x2b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x0a,
+  0x09, 0x09, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6f, 0x6b, 0x20, 0x3d, 0x20,
+  0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73, 0x30, 0x20, 0x21, 0x3d,
+  0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73, 0x32, 0x29, 0x3b, 0x09,
+  0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x50, 0x61, 0x72, 0x65, 0x6e, 0x74,
+  0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x6f, 0x77, 0x6e, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x0a, 0x0a, 0x09, 0x09, 0x69, 0x66,
+  0x20, 0x28, 0x6f, 0x6b, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x70,
+  0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f,
+  0x69, 0x6e, 0x63, 0x28, 0x26, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e,
+  0x74, 0x65, 0x72, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09,
+  0x69, 0x66, 0x20, 0x28, 0x70, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x32, 0x35,
+  0x36, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x30, 0x5b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20,
+  0x69, 0x6e, 0x64, 0x65, 0x78, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x20,
+  0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x4c, 0x6f, 0x73, 0x73, 0x28, 0x6c, 0x6f, 0x73,
+  0x73, 0x2c, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x43, 0x61, 0x6e, 0x64, 0x69,
+  0x64, 0x61, 0x74, 0x65, 0x73, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x7d,
+  0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a, 0x0a,
+  0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x5f, 0x5f, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x5f, 0x5f, 0x28, 0x28,
+  0x72, 0x65, 0x71, 0x64, 0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x67, 0x72,
+  0x6f, 0x75, 0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x32, 0x35, 0x36,
+  0x2c, 0x20, 0x31, 0x2c, 0x20, 0x31, 0x29, 0x29, 0x29, 0x20, 0x76, 0x6f,
+  0x69, 0x64, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x31, 0x20, 0x28, 0x09,
+  0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20,
+  0x31, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x70,
+  0x75, 0x74, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x45, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75,
   0x74, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
-  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x2a, 0x20, 0x6f,
-  0x75, 0x74, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f,
-  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x29, 0x20,
+  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f,
+  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x69, 0x74, 0x65,
+  0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73,
+  0x20, 0x2a, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x2c, 0x0a, 0x09,
+  0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x76, 0x6f,
+  0x6c, 0x61, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x2a, 0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x29, 0x20,
   0x7b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x49, 0x64, 0x20,
   0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f,
   0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74,
@@ -1339,301 +1846,350 @@ unsigned char __equihash_125_4_cl[] = {
   0x3b, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20,
   0x75, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x61, 0x62, 0x5b, 0x35, 0x31, 0x32,
   0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20,
-  0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x32, 0x5d,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d,
   0x3b, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
   0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x43, 0x6f,
   0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x26, 0x63, 0x6f, 0x75,
-  0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x38, 0x31, 0x39, 0x32, 0x5d, 0x3b,
-  0x0a, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
-  0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75,
-  0x6e, 0x74, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x26, 0x63, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x73, 0x5b, 0x31, 0x36, 0x33, 0x38, 0x34, 0x5d, 0x3b,
-  0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3d,
-  0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x09, 0x09,
-  0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x6d, 0x69,
-  0x6e, 0x28, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b,
-  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x2c, 0x28, 0x75, 0x69, 0x6e,
-  0x74, 0x29, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a,
-  0x65, 0x29, 0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x0a, 0x09, 0x74, 0x61,
-  0x62, 0x5b, 0x6c, 0x49, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x46,
-  0x46, 0x46, 0x3b, 0x0a, 0x09, 0x74, 0x61, 0x62, 0x5b, 0x6c, 0x49, 0x64,
-  0x2b, 0x32, 0x35, 0x36, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x46, 0x46,
-  0x46, 0x3b, 0x0a, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72,
-  0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d,
-  0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a,
-  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x73, 0x20, 0x3d, 0x20,
-  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2a, 0x62, 0x75, 0x63, 0x6b, 0x65,
-  0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x09, 0x0a, 0x0a, 0x09, 0x6d, 0x61,
+  0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x5f,
+  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65,
+  0x72, 0x20, 0x3d, 0x20, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
+  0x73, 0x5b, 0x36, 0x35, 0x35, 0x33, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x5f,
+  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x2a, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x20, 0x3d, 0x20, 0x26, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x6c, 0x6f, 0x73, 0x73,
+  0x42, 0x61, 0x73, 0x65, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b,
+  0x0a, 0x09, 0x09, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x20, 0x3d,
+  0x20, 0x69, 0x73, 0x53, 0x74, 0x61, 0x6c, 0x65, 0x28, 0x70, 0x61, 0x72,
+  0x61, 0x6d, 0x73, 0x2c, 0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63,
+  0x68, 0x29, 0x20, 0x3f, 0x20, 0x30, 0x20, 0x3a, 0x20, 0x6d, 0x69, 0x6e,
+  0x28, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x67,
+  0x72, 0x70, 0x5d, 0x2c, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x73,
+  0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65,
+  0x29, 0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x0a, 0x09, 0x74, 0x61, 0x62,
+  0x5b, 0x6c, 0x49, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x45,
+  0x6d, 0x70, 0x74, 0x79, 0x3b, 0x0a, 0x09, 0x74, 0x61, 0x62, 0x5b, 0x6c,
+  0x49, 0x64, 0x2b, 0x32, 0x35, 0x36, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x61,
+  0x62, 0x45, 0x6d, 0x70, 0x74, 0x79, 0x3b, 0x0a, 0x0a, 0x09, 0x62, 0x61,
+  0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f,
+  0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43,
+  0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f,
+  0x66, 0x73, 0x20, 0x3d, 0x20, 0x67, 0x72, 0x70, 0x2a, 0x73, 0x75, 0x62,
+  0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4f, 0x6e, 0x6c, 0x79,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20,
+  0x69, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x0a, 0x09, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x20, 0x3d, 0x20, 0x69, 0x43,
+  0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d,
+  0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69,
+  0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x6c, 0x49,
+  0x64, 0x5d, 0x2c, 0x20, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x6d, 0x61, 0x73,
+  0x6b, 0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53,
+  0x69, 0x7a, 0x65, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
+  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74,
+  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x32, 0x35, 0x36, 0x29,
+  0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x6d, 0x61,
   0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20,
-  0x6f, 0x66, 0x73, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
+  0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x35, 0x36, 0x2b, 0x6c, 0x49,
+  0x64, 0x5d, 0x2c, 0x20, 0x32, 0x35, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c,
+  0x20, 0x6d, 0x61, 0x73, 0x6b, 0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63,
+  0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2b, 0x32, 0x35, 0x36, 0x2b,
+  0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30,
+  0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49,
+  0x64, 0x20, 0x2b, 0x20, 0x35, 0x31, 0x32, 0x29, 0x20, 0x3c, 0x20, 0x69,
+  0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e,
+  0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66,
+  0x73, 0x2b, 0x35, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20,
+  0x35, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x6d, 0x61, 0x73,
+  0x6b, 0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53,
+  0x69, 0x7a, 0x65, 0x2b, 0x35, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c,
+  0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d,
+  0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a,
+  0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20,
+  0x37, 0x36, 0x38, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d,
+  0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69,
+  0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x36,
+  0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x37, 0x36, 0x38, 0x2b,
+  0x6c, 0x49, 0x64, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x2a, 0x73, 0x75,
+  0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2b,
+  0x37, 0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
   0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74,
-  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a,
-  0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x35, 0x36,
-  0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x32,
-  0x35, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61,
-  0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09,
-  0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x31, 0x32, 0x2b,
-  0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x31,
-  0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d,
-  0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x36, 0x38, 0x2b, 0x6c,
-  0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x36, 0x38,
-  0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d,
-  0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x6d,
+  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x31, 0x30, 0x32, 0x34,
+  0x29, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x6d,
   0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75,
   0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x30, 0x32, 0x34, 0x2b,
-  0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x30,
-  0x32, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61,
-  0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09,
-  0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x32, 0x38, 0x30,
-  0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x31,
-  0x32, 0x38, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
+  0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x31, 0x30, 0x32, 0x34, 0x2b, 0x6c,
+  0x49, 0x64, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x2a, 0x73, 0x75, 0x62,
+  0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2b, 0x31,
+  0x30, 0x32, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
   0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74,
-  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a,
-  0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x35, 0x33,
-  0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b,
-  0x31, 0x35, 0x33, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b,
-  0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x37,
-  0x39, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73,
-  0x2b, 0x31, 0x37, 0x39, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26,
+  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x62, 0x61,
+  0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f,
+  0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43,
+  0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x23, 0x69, 0x66, 0x64, 0x65, 0x66, 0x20,
+  0x43, 0x4f, 0x4c, 0x4c, 0x49, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x53, 0x4f,
+  0x52, 0x54, 0x0a, 0x09, 0x73, 0x6f, 0x72, 0x74, 0x43, 0x6f, 0x6c, 0x6c,
+  0x69, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x28, 0x26, 0x73, 0x63, 0x72, 0x61,
+  0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62,
+  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x3b,
+  0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6c,
+  0x49, 0x64, 0x3b, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73, 0x20,
+  0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x3b, 0x20, 0x73, 0x6f, 0x72,
+  0x74, 0x50, 0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x35, 0x36, 0x29,
+  0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77,
+  0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74,
+  0x63, 0x68, 0x34, 0x5b, 0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73, 0x5d,
+  0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x72, 0x75, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20,
+  0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73, 0x20, 0x2d, 0x20, 0x28, 0x73,
+  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x6f, 0x77, 0x6e, 0x50,
+  0x6f, 0x73, 0x5d, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46,
+  0x29, 0x3b, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x46, 0x69, 0x72, 0x73, 0x74,
+  0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x20, 0x63, 0x6f, 0x6c, 0x6c,
+  0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a, 0x0a,
+  0x09, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x3b, 0x20, 0x72, 0x75, 0x6e,
+  0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f,
+  0x73, 0x3b, 0x20, 0x72, 0x75, 0x6e, 0x50, 0x6f, 0x73, 0x2b, 0x2b, 0x29,
+  0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x63, 0x6f, 0x6c, 0x6c, 0x69, 0x64,
+  0x65, 0x31, 0x28, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x2c, 0x20, 0x73,
+  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x72, 0x75, 0x6e, 0x50,
+  0x6f, 0x73, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x2c, 0x20, 0x26,
   0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43,
-  0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29,
-  0x3b, 0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34,
-  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b,
-  0x32, 0x30, 0x34, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f,
-  0x66, 0x73, 0x2b, 0x32, 0x30, 0x34, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c,
-  0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73,
-  0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67,
-  0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73,
-  0x2b, 0x32, 0x33, 0x30, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20,
-  0x6f, 0x66, 0x73, 0x2b, 0x32, 0x33, 0x30, 0x34, 0x2b, 0x6c, 0x49, 0x64,
-  0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61,
-  0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e,
-  0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66,
-  0x73, 0x2b, 0x32, 0x35, 0x36, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c,
-  0x20, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x35, 0x36, 0x30, 0x2b, 0x6c, 0x49,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20, 0x6f, 0x75, 0x74,
+  0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x6c, 0x6f, 0x73,
+  0x73, 0x2c, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x29, 0x3b, 0x0a,
+  0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65,
+  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x50, 0x6f,
+  0x73, 0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64, 0x3b, 0x0a, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73,
+  0x5d, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x74, 0x68,
+  0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6f, 0x77, 0x6e, 0x3b, 0x0a, 0x09,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x6e, 0x74, 0x3d, 0x30, 0x3b, 0x0a,
+  0x09, 0x0a, 0x09, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x6f, 0x77,
+  0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d,
+  0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x61,
+  0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x28, 0x6f, 0x74, 0x68, 0x50, 0x6f,
+  0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x3f,
+  0x20, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3a, 0x20, 0x6f, 0x77,
+  0x6e, 0x50, 0x6f, 0x73, 0x2b, 0x32, 0x35, 0x36, 0x3b, 0x0a, 0x09, 0x09,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20,
+  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x61, 0x64, 0x64,
+  0x72, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e,
+  0x4c, 0x69, 0x6d, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x63, 0x6f,
+  0x6c, 0x6c, 0x69, 0x64, 0x65, 0x31, 0x28, 0x6f, 0x77, 0x6e, 0x50, 0x6f,
+  0x73, 0x2c, 0x20, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x2c, 0x20, 0x26,
+  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20, 0x6f, 0x75, 0x74,
+  0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x6c, 0x6f, 0x73,
+  0x73, 0x2c, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x29, 0x3b, 0x0a,
+  0x09, 0x09, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x20, 0x0a,
+  0x09, 0x09, 0x09, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65,
+  0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73,
+  0x20, 0x2b, 0x3d, 0x20, 0x32, 0x35, 0x36, 0x3b, 0x0a, 0x09, 0x09, 0x7d,
+  0x0a, 0x0a, 0x09, 0x09, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3d,
+  0x20, 0x65, 0x6c, 0x65, 0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x28, 0x63, 0x6e, 0x74, 0x20, 0x3e, 0x3d, 0x20, 0x63, 0x68, 0x61,
+  0x69, 0x6e, 0x43, 0x61, 0x70, 0x29, 0x20, 0x26, 0x26, 0x20, 0x28, 0x6f,
+  0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69,
+  0x6d, 0x29, 0x29, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x4c, 0x6f, 0x73,
+  0x73, 0x28, 0x6c, 0x6f, 0x73, 0x73, 0x2c, 0x20, 0x6c, 0x6f, 0x73, 0x73,
+  0x43, 0x68, 0x61, 0x69, 0x6e, 0x31, 0x2b, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x09, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x63,
+  0x6e, 0x74, 0x3c, 0x63, 0x68, 0x61, 0x69, 0x6e, 0x43, 0x61, 0x70, 0x29,
+  0x20, 0x3f, 0x20, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3a, 0x20,
+  0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x63, 0x6e, 0x74,
+  0x2b, 0x2b, 0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x23, 0x65, 0x6e, 0x64,
+  0x69, 0x66, 0x0a, 0x7d, 0x0a, 0x0a, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72,
+  0x6e, 0x65, 0x6c, 0x20, 0x5f, 0x5f, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x5f, 0x5f, 0x28, 0x28, 0x72, 0x65, 0x71, 0x64, 0x5f,
+  0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x73,
+  0x69, 0x7a, 0x65, 0x28, 0x32, 0x35, 0x36, 0x2c, 0x20, 0x31, 0x2c, 0x20,
+  0x31, 0x29, 0x29, 0x29, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x6f,
+  0x75, 0x6e, 0x64, 0x32, 0x20, 0x28, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f,
+  0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x32, 0x0a, 0x09, 0x09, 0x5f,
+  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x73, 0x70, 0x6c, 0x69,
+  0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x69,
+  0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67,
+  0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a,
+  0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x0a, 0x09, 0x09,
+  0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73,
+  0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
+  0x6e, 0x74, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x20, 0x2a, 0x20, 0x70, 0x61, 0x72,
+  0x61, 0x6d, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x20, 0x76, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6c, 0x65,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6a, 0x6f, 0x62, 0x45,
+  0x70, 0x6f, 0x63, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x67, 0x72, 0x70, 0x20, 0x3d,
+  0x20, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69,
+  0x64, 0x28, 0x30, 0x29, 0x3b, 0x20, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x63,
+  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x37, 0x32, 0x39, 0x36, 0x5d, 0x3b,
+  0x0a, 0x09, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74,
+  0x63, 0x68, 0x30, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
+  0x63, 0x68, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73,
+  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x20, 0x3d, 0x20, 0x26, 0x73,
+  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x31, 0x32, 0x31, 0x36, 0x5d,
+  0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x32, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x5b, 0x32, 0x34, 0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a,
+  0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x33, 0x20, 0x3d, 0x20,
+  0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x33, 0x36, 0x34,
+  0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61,
+  0x74, 0x63, 0x68, 0x34, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
+  0x74, 0x63, 0x68, 0x5b, 0x34, 0x38, 0x36, 0x34, 0x5d, 0x3b, 0x0a, 0x09,
+  0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x35, 0x20,
+  0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x36,
+  0x30, 0x38, 0x30, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x61, 0x62,
+  0x5b, 0x35, 0x31, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x43, 0x4e,
+  0x54, 0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20,
+  0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x3d, 0x20,
+  0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x36, 0x35,
+  0x35, 0x33, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6f,
+  0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x3d, 0x20,
+  0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x31, 0x33,
+  0x31, 0x30, 0x37, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20,
+  0x6c, 0x6f, 0x73, 0x73, 0x20, 0x3d, 0x20, 0x26, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x65, 0x72, 0x73, 0x5b, 0x6c, 0x6f, 0x73, 0x73, 0x42, 0x61, 0x73,
+  0x65, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x49,
+  0x64, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09,
+  0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x69, 0x73,
+  0x53, 0x74, 0x61, 0x6c, 0x65, 0x28, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73,
+  0x2c, 0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x29, 0x20,
+  0x3f, 0x20, 0x30, 0x20, 0x3a, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x69, 0x6e,
+  0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x67, 0x72, 0x70, 0x5d,
+  0x2c, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x73, 0x75, 0x62, 0x42,
+  0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x3b, 0x0a,
+  0x09, 0x7d, 0x20, 0x0a, 0x0a, 0x09, 0x74, 0x61, 0x62, 0x5b, 0x6c, 0x49,
+  0x64, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x45, 0x6d, 0x70, 0x74,
+  0x79, 0x3b, 0x0a, 0x09, 0x74, 0x61, 0x62, 0x5b, 0x6c, 0x49, 0x64, 0x2b,
+  0x32, 0x35, 0x36, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x45, 0x6d,
+  0x70, 0x74, 0x79, 0x3b, 0x0a, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69,
+  0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c,
+  0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b,
+  0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x73, 0x20,
+  0x3d, 0x20, 0x67, 0x72, 0x70, 0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63,
+  0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x69, 0x73, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x69, 0x73, 0x20,
+  0x72, 0x65, 0x61, 0x64, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69,
+  0x6e, 0x4c, 0x69, 0x6d, 0x20, 0x3d, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b,
+  0x30, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x49,
+  0x64, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x6d,
+  0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x6c, 0x6f, 0x61, 0x64,
+  0x52, 0x6f, 0x75, 0x6e, 0x64, 0x32, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
+  0x30, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x6c, 0x49, 0x64, 0x29, 0x2c,
+  0x20, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x6c, 0x49,
   0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d,
-  0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69,
-  0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f,
-  0x66, 0x73, 0x2b, 0x32, 0x38, 0x31, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d,
-  0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x38, 0x31, 0x36, 0x2b, 0x6c,
-  0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20,
-  0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73,
-  0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30,
-  0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x30, 0x37, 0x32, 0x2b, 0x6c, 0x49,
-  0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x30, 0x37, 0x32,
-  0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d,
-  0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-  0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x33, 0x32, 0x38, 0x2b, 0x6c,
-  0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x33, 0x32,
-  0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d,
-  0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x35, 0x38, 0x34, 0x2b,
-  0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x35,
-  0x38, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72,
+  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x29,
+  0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20,
+  0x2b, 0x20, 0x32, 0x35, 0x36, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c,
+  0x69, 0x6d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34,
+  0x28, 0x6c, 0x6f, 0x61, 0x64, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x32, 0x28,
+  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b,
+  0x32, 0x35, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x29, 0x2c, 0x20, 0x32, 0x35,
+  0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x32,
+  0x35, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72,
   0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61,
-  0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09,
-  0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x38, 0x34, 0x30,
-  0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x33,
-  0x38, 0x34, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74,
-  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a,
-  0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x34, 0x30,
-  0x39, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73,
-  0x2b, 0x34, 0x30, 0x39, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43,
-  0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29,
-  0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x34,
-  0x33, 0x35, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66,
-  0x73, 0x2b, 0x34, 0x33, 0x35, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
-  0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69,
-  0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34,
-  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b,
-  0x34, 0x36, 0x30, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f,
-  0x66, 0x73, 0x2b, 0x34, 0x36, 0x30, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c,
+  0x62, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28,
+  0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x35, 0x31, 0x32, 0x29, 0x20,
+  0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x6d, 0x61, 0x73,
+  0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x6c, 0x6f, 0x61, 0x64, 0x52, 0x6f,
+  0x75, 0x6e, 0x64, 0x32, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c,
+  0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64,
+  0x29, 0x2c, 0x20, 0x35, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
+  0x6f, 0x66, 0x73, 0x2b, 0x35, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c,
   0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73,
-  0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67,
-  0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73,
-  0x2b, 0x34, 0x38, 0x36, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20,
-  0x6f, 0x66, 0x73, 0x2b, 0x34, 0x38, 0x36, 0x34, 0x2b, 0x6c, 0x49, 0x64,
-  0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61,
-  0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69,
-  0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f,
-  0x66, 0x73, 0x2b, 0x35, 0x31, 0x32, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x5d,
-  0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x31, 0x32, 0x30, 0x2b, 0x6c,
-  0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20,
-  0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b,
-  0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b,
-  0x6f, 0x66, 0x73, 0x2b, 0x35, 0x33, 0x37, 0x36, 0x2b, 0x6c, 0x49, 0x64,
-  0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x33, 0x37, 0x36, 0x2b,
-  0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c,
-  0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73,
-  0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30,
-  0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x36, 0x33, 0x32, 0x2b, 0x6c, 0x49,
-  0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x36, 0x33, 0x32,
+  0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a,
+  0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20,
+  0x37, 0x36, 0x38, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d,
+  0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x6c,
+  0x6f, 0x61, 0x64, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x32, 0x28, 0x69, 0x6e,
+  0x70, 0x75, 0x74, 0x30, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x36,
+  0x38, 0x2b, 0x6c, 0x49, 0x64, 0x29, 0x2c, 0x20, 0x37, 0x36, 0x38, 0x2b,
+  0x6c, 0x49, 0x64, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x36, 0x38,
   0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
   0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d,
-  0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-  0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x38, 0x38, 0x38, 0x2b, 0x6c,
-  0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x38, 0x38,
-  0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09,
-  0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x36, 0x31, 0x34, 0x34,
-  0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x36,
-  0x31, 0x34, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74,
-  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a,
-  0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x36, 0x34, 0x30,
-  0x30, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b,
-  0x36, 0x34, 0x30, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b,
-  0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x36, 0x36,
-  0x35, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73,
-  0x2b, 0x36, 0x36, 0x35, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43,
-  0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29,
-  0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x36,
-  0x39, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66,
-  0x73, 0x2b, 0x36, 0x39, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
-  0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69,
-  0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67,
-  0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73,
-  0x2b, 0x37, 0x31, 0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20,
-  0x6f, 0x66, 0x73, 0x2b, 0x37, 0x31, 0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64,
-  0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61,
-  0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e,
-  0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66,
-  0x73, 0x2b, 0x37, 0x34, 0x32, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c,
-  0x20, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x34, 0x32, 0x34, 0x2b, 0x6c, 0x49,
+  0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c,
+  0x49, 0x64, 0x20, 0x2b, 0x20, 0x31, 0x30, 0x32, 0x34, 0x29, 0x20, 0x3c,
+  0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b,
+  0x69, 0x6e, 0x67, 0x34, 0x28, 0x6c, 0x6f, 0x61, 0x64, 0x52, 0x6f, 0x75,
+  0x6e, 0x64, 0x32, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20,
+  0x6f, 0x66, 0x73, 0x2b, 0x31, 0x30, 0x32, 0x34, 0x2b, 0x6c, 0x49, 0x64,
+  0x29, 0x2c, 0x20, 0x31, 0x30, 0x32, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c,
+  0x20, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x30, 0x32, 0x34, 0x2b, 0x6c, 0x49,
   0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d,
-  0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28,
-  0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x37, 0x36, 0x38, 0x30, 0x29, 0x20,
-  0x3c, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x29, 0x20, 0x6d,
-  0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x36, 0x38, 0x30, 0x2b,
-  0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x36,
-  0x38, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61,
-  0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09,
-  0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x37,
-  0x39, 0x33, 0x36, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x30, 0x5d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34,
-  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b,
-  0x37, 0x39, 0x33, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f,
-  0x66, 0x73, 0x2b, 0x37, 0x39, 0x33, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c,
-  0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73,
-  0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c,
-  0x49, 0x64, 0x20, 0x2b, 0x20, 0x38, 0x31, 0x39, 0x32, 0x29, 0x20, 0x3c,
-  0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x29, 0x20, 0x6d, 0x61,
-  0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x38, 0x31, 0x39, 0x32, 0x2b, 0x6c,
-  0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x38, 0x31, 0x39,
-  0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x69,
-  0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x38, 0x34,
-  0x34, 0x38, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30,
-  0x5d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x38,
-  0x34, 0x34, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66,
-  0x73, 0x2b, 0x38, 0x34, 0x34, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
-  0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69,
-  0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x29, 0x3b, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69,
-  0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c,
-  0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b,
-  0x09, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x4c,
-  0x69, 0x6d, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29,
-  0x20, 0x31, 0x32, 0x31, 0x36, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x62, 0x61,
-  0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f,
-  0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43,
-  0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f,
-  0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64, 0x3b,
-  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x3d,
-  0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x6f, 0x77,
-  0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74,
-  0x20, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6f, 0x77,
-  0x6e, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x75, 0x63,
-  0x6b, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x63, 0x6e, 0x74, 0x3d, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x75,
-  0x69, 0x6e, 0x74, 0x38, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45,
-  0x6c, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20,
+  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x29,
+  0x3b, 0x0a, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28,
+  0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45,
+  0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x23,
+  0x69, 0x66, 0x64, 0x65, 0x66, 0x20, 0x43, 0x4f, 0x4c, 0x4c, 0x49, 0x53,
+  0x49, 0x4f, 0x4e, 0x5f, 0x53, 0x4f, 0x52, 0x54, 0x0a, 0x09, 0x73, 0x6f,
+  0x72, 0x74, 0x43, 0x6f, 0x6c, 0x6c, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x73,
+  0x28, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d,
+  0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x69,
+  0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72,
+  0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x50,
+  0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64, 0x3b, 0x20, 0x73, 0x6f,
+  0x72, 0x74, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69,
+  0x6d, 0x3b, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73, 0x20, 0x2b,
+  0x3d, 0x20, 0x32, 0x35, 0x36, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d,
+  0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x73, 0x6f,
+  0x72, 0x74, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36,
+  0x3b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x75, 0x6e,
+  0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f,
+  0x73, 0x20, 0x2d, 0x20, 0x28, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x34, 0x5b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x26, 0x20,
+  0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x29, 0x3b, 0x09, 0x09, 0x2f, 0x2f,
+  0x20, 0x46, 0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x71, 0x75, 0x61,
+  0x6c, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20,
+  0x62, 0x69, 0x74, 0x73, 0x0a, 0x0a, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x20,
+  0x28, 0x3b, 0x20, 0x72, 0x75, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20,
+  0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73, 0x3b, 0x20, 0x72, 0x75, 0x6e,
+  0x50, 0x6f, 0x73, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09,
+  0x63, 0x6f, 0x6c, 0x6c, 0x69, 0x64, 0x65, 0x32, 0x28, 0x6f, 0x77, 0x6e,
+  0x50, 0x6f, 0x73, 0x2c, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x34, 0x5b, 0x72, 0x75, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x3e, 0x3e,
+  0x20, 0x31, 0x36, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x30, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65,
+  0x72, 0x2c, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x2c, 0x20, 0x67, 0x72, 0x70,
+  0x29, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x23, 0x65,
+  0x6c, 0x73, 0x65, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77,
+  0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64, 0x3b, 0x0a,
+  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20,
+  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x6f, 0x77, 0x6e,
+  0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6f, 0x77, 0x6e,
+  0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x6e, 0x74, 0x3d,
+  0x30, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20,
   0x28, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e,
   0x4c, 0x69, 0x6d, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e,
   0x74, 0x20, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x28, 0x6f, 0x74,
@@ -1645,1198 +2201,896 @@ unsigned char __equihash_125_4_cl[] = {
   0x61, 0x64, 0x64, 0x72, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x09,
   0x69, 0x66, 0x20, 0x28, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3c,
   0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09,
-  0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x30,
-  0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b,
-  0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x5e, 0x20, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x6f, 0x74, 0x68, 0x50, 0x6f,
-  0x73, 0x5d, 0x3b, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70,
-  0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x6f, 0x77, 0x6e, 0x50, 0x6f,
-  0x73, 0x5d, 0x20, 0x5e, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x31, 0x5b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09,
-  0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
-  0x45, 0x6c, 0x2e, 0x73, 0x31, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x20,
-  0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x20, 0x3d,
-  0x20, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73,
-  0x30, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x32, 0x29, 0x20, 0x26, 0x20, 0x30,
-  0x78, 0x31, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x70,
-  0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f,
-  0x69, 0x6e, 0x63, 0x28, 0x26, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x5d, 0x29, 0x3b, 0x0a,
-  0x0a, 0x09, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45,
-  0x6c, 0x2e, 0x73, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x32, 0x5b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d,
-  0x20, 0x5e, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x32, 0x5b,
-  0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x29, 0x20, 0x26, 0x20, 0x30,
-  0x78, 0x37, 0x46, 0x46, 0x46, 0x46, 0x46, 0x3b, 0x09, 0x0a, 0x09, 0x09,
-  0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73,
-  0x33, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09,
-  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x6c, 0x6f, 0x20,
-  0x3d, 0x20, 0x73, 0x68, 0x72, 0x5f, 0x34, 0x28, 0x6f, 0x75, 0x74, 0x70,
-  0x75, 0x74, 0x45, 0x6c, 0x2e, 0x6c, 0x6f, 0x2c, 0x32, 0x35, 0x29, 0x3b,
-  0x20, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x53, 0x68, 0x69, 0x66, 0x74,
-  0x20, 0x61, 0x77, 0x61, 0x79, 0x20, 0x32, 0x35, 0x20, 0x62, 0x69, 0x74,
-  0x73, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75,
-  0x74, 0x45, 0x6c, 0x2e, 0x73, 0x32, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x35, 0x5b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73,
-  0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75,
-  0x74, 0x45, 0x6c, 0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x35, 0x5b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73,
-  0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28,
-  0x70, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
-  0x53, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b,
-  0x2a, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b,
-  0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
-  0x30, 0x5b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x6f, 0x75, 0x74,
-  0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x6c, 0x6f, 0x3b, 0x0a, 0x09, 0x09,
-  0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x7d,
-  0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x20, 0x0a, 0x09, 0x09, 0x09,
-  0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x3b, 0x0a,
-  0x09, 0x09, 0x09, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x2b, 0x3d,
-  0x20, 0x32, 0x35, 0x36, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x0a, 0x09,
-  0x09, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x65, 0x6c,
-  0x65, 0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73,
-  0x20, 0x3d, 0x20, 0x28, 0x63, 0x6e, 0x74, 0x3c, 0x34, 0x30, 0x29, 0x20,
-  0x3f, 0x20, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3a, 0x20, 0x69,
-  0x6e, 0x4c, 0x69, 0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x63, 0x6e, 0x74, 0x2b,
-  0x2b, 0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x7d, 0x0a, 0x0a, 0x0a, 0x5f,
-  0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x5f, 0x5f, 0x61, 0x74,
-  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x5f, 0x5f, 0x28, 0x28, 0x72,
-  0x65, 0x71, 0x64, 0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x67, 0x72, 0x6f,
-  0x75, 0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x32, 0x35, 0x36, 0x2c,
-  0x20, 0x31, 0x2c, 0x20, 0x31, 0x29, 0x29, 0x29, 0x20, 0x76, 0x6f, 0x69,
-  0x64, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x33, 0x20, 0x28, 0x09, 0x09,
-  0x09, 0x09, 0x2f, 0x2f, 0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x33,
-  0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
-  0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x70, 0x75,
+  0x09, 0x63, 0x6f, 0x6c, 0x6c, 0x69, 0x64, 0x65, 0x32, 0x28, 0x6f, 0x77,
+  0x6e, 0x50, 0x6f, 0x73, 0x2c, 0x20, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73,
+  0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30,
+  0x5d, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20,
+  0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x2c, 0x20,
+  0x6c, 0x6f, 0x73, 0x73, 0x2c, 0x20, 0x67, 0x72, 0x70, 0x29, 0x3b, 0x0a,
+  0x09, 0x09, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x20, 0x0a,
+  0x09, 0x09, 0x09, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65,
+  0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73,
+  0x20, 0x2b, 0x3d, 0x20, 0x32, 0x35, 0x36, 0x3b, 0x0a, 0x09, 0x09, 0x7d,
+  0x0a, 0x0a, 0x09, 0x09, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3d,
+  0x20, 0x65, 0x6c, 0x65, 0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x28, 0x63, 0x6e, 0x74, 0x20, 0x3e, 0x3d, 0x20, 0x63, 0x68, 0x61,
+  0x69, 0x6e, 0x43, 0x61, 0x70, 0x29, 0x20, 0x26, 0x26, 0x20, 0x28, 0x6f,
+  0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69,
+  0x6d, 0x29, 0x29, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x4c, 0x6f, 0x73,
+  0x73, 0x28, 0x6c, 0x6f, 0x73, 0x73, 0x2c, 0x20, 0x6c, 0x6f, 0x73, 0x73,
+  0x43, 0x68, 0x61, 0x69, 0x6e, 0x31, 0x2b, 0x31, 0x29, 0x3b, 0x0a, 0x09,
+  0x09, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x63,
+  0x6e, 0x74, 0x3c, 0x63, 0x68, 0x61, 0x69, 0x6e, 0x43, 0x61, 0x70, 0x29,
+  0x20, 0x3f, 0x20, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3a, 0x20,
+  0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x63, 0x6e, 0x74,
+  0x2b, 0x2b, 0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x23, 0x65, 0x6e, 0x64,
+  0x69, 0x66, 0x0a, 0x7d, 0x0a, 0x0a, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72,
+  0x6e, 0x65, 0x6c, 0x20, 0x5f, 0x5f, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x5f, 0x5f, 0x28, 0x28, 0x72, 0x65, 0x71, 0x64, 0x5f,
+  0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x73,
+  0x69, 0x7a, 0x65, 0x28, 0x32, 0x35, 0x36, 0x2c, 0x20, 0x31, 0x2c, 0x20,
+  0x31, 0x29, 0x29, 0x29, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x6f,
+  0x75, 0x6e, 0x64, 0x33, 0x20, 0x28, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f,
+  0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x33, 0x0a, 0x09, 0x09, 0x5f,
+  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x32, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x0a,
+  0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x32, 0x20, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75,
   0x74, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
-  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x2a, 0x20, 0x6f,
-  0x75, 0x74, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f,
-  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x29, 0x20,
+  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f,
+  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x69, 0x74, 0x65,
+  0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73,
+  0x20, 0x2a, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x2c, 0x0a, 0x09,
+  0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x76, 0x6f,
+  0x6c, 0x61, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x2a, 0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x29, 0x20,
   0x7b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x49, 0x64, 0x20,
   0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f,
   0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74,
   0x20, 0x67, 0x72, 0x70, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x67,
   0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x20,
-  0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x75, 0x63, 0x6b,
-  0x65, 0x74, 0x20, 0x3d, 0x20, 0x67, 0x72, 0x70, 0x20, 0x3e, 0x3e, 0x20,
-  0x33, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73,
-  0x6b, 0x20, 0x3d, 0x20, 0x28, 0x67, 0x72, 0x70, 0x20, 0x26, 0x20, 0x37,
-  0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x5b, 0x37, 0x32, 0x39, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x0a, 0x09,
-  0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
-  0x20, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x20,
-  0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30,
+  0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
+  0x37, 0x32, 0x39, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x5f, 0x5f,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a,
+  0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x20, 0x3d, 0x20,
+  0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x3b,
+  0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x31, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x5b, 0x31, 0x32, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20,
+  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x32, 0x20, 0x3d, 0x20, 0x26,
+  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x32, 0x34, 0x33, 0x32,
   0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20,
   0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x31, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x5b, 0x31, 0x32, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x5f,
+  0x63, 0x68, 0x33, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
+  0x63, 0x68, 0x5b, 0x33, 0x36, 0x34, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x5f,
   0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x32, 0x20, 0x3d,
-  0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x32, 0x34,
-  0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
+  0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x20, 0x3d,
+  0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x34, 0x38,
+  0x36, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
   0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x33, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x5b, 0x33, 0x36, 0x34, 0x38, 0x5d, 0x3b, 0x0a,
-  0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34,
-  0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
-  0x34, 0x38, 0x36, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x35, 0x20, 0x3d, 0x20, 0x26, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x36, 0x30, 0x38, 0x30, 0x5d,
-  0x3b, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20,
-  0x75, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x61, 0x62, 0x5b, 0x35, 0x31, 0x32,
-  0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20,
-  0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x32, 0x5d,
-  0x3b, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
-  0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x43, 0x6f,
-  0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x26, 0x63, 0x6f, 0x75,
-  0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x31, 0x36, 0x33, 0x38, 0x34, 0x5d,
+  0x61, 0x74, 0x63, 0x68, 0x35, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x5b, 0x36, 0x30, 0x38, 0x30, 0x5d, 0x3b, 0x0a,
+  0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x74, 0x61, 0x62, 0x5b, 0x35, 0x31, 0x32, 0x5d, 0x3b,
+  0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x3b, 0x0a,
+  0x0a, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e,
+  0x74, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x65, 0x72, 0x73, 0x5b, 0x31, 0x33, 0x31, 0x30, 0x37, 0x32, 0x5d, 0x3b,
+  0x0a, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75,
+  0x6e, 0x74, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x26, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x65, 0x72, 0x73, 0x5b, 0x31, 0x39, 0x36, 0x36, 0x30, 0x38, 0x5d,
   0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
-  0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x43, 0x6f,
-  0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x26, 0x63, 0x6f, 0x75,
-  0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x32, 0x34, 0x35, 0x37, 0x36, 0x5d,
-  0x3b, 0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20,
-  0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x69, 0x43,
-  0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x09,
-  0x09, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x6d,
-  0x69, 0x6e, 0x28, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
-  0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x2c, 0x28, 0x75, 0x69,
-  0x6e, 0x74, 0x29, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69,
-  0x7a, 0x65, 0x29, 0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x0a, 0x09, 0x74,
-  0x61, 0x62, 0x5b, 0x6c, 0x49, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x78,
-  0x46, 0x46, 0x46, 0x3b, 0x0a, 0x09, 0x74, 0x61, 0x62, 0x5b, 0x6c, 0x49,
-  0x64, 0x2b, 0x32, 0x35, 0x36, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x46,
-  0x46, 0x46, 0x3b, 0x0a, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65,
-  0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f,
-  0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a,
-  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x73, 0x20, 0x3d,
-  0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2a, 0x62, 0x75, 0x63, 0x6b,
-  0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x09, 0x0a, 0x0a, 0x09, 0x6d,
-  0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x20,
+  0x3d, 0x20, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b,
+  0x6c, 0x6f, 0x73, 0x73, 0x42, 0x61, 0x73, 0x65, 0x5d, 0x3b, 0x0a, 0x0a,
+  0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x3d, 0x20,
+  0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x69, 0x43, 0x4e, 0x54, 0x5b,
+  0x30, 0x5d, 0x20, 0x3d, 0x20, 0x69, 0x73, 0x53, 0x74, 0x61, 0x6c, 0x65,
+  0x28, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x2c, 0x20, 0x6a, 0x6f, 0x62,
+  0x45, 0x70, 0x6f, 0x63, 0x68, 0x29, 0x20, 0x3f, 0x20, 0x30, 0x20, 0x3a,
+  0x20, 0x6d, 0x69, 0x6e, 0x28, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74,
+  0x65, 0x72, 0x5b, 0x67, 0x72, 0x70, 0x5d, 0x2c, 0x28, 0x75, 0x69, 0x6e,
+  0x74, 0x29, 0x20, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74,
+  0x53, 0x69, 0x7a, 0x65, 0x29, 0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x0a,
+  0x09, 0x74, 0x61, 0x62, 0x5b, 0x6c, 0x49, 0x64, 0x5d, 0x20, 0x3d, 0x20,
+  0x74, 0x61, 0x62, 0x45, 0x6d, 0x70, 0x74, 0x79, 0x3b, 0x0a, 0x09, 0x74,
+  0x61, 0x62, 0x5b, 0x6c, 0x49, 0x64, 0x2b, 0x32, 0x35, 0x36, 0x5d, 0x20,
+  0x3d, 0x20, 0x74, 0x61, 0x62, 0x45, 0x6d, 0x70, 0x74, 0x79, 0x3b, 0x0a,
+  0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c,
+  0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f,
+  0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x6f, 0x66, 0x73, 0x20, 0x3d, 0x20, 0x67, 0x72, 0x70,
+  0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69,
+  0x7a, 0x65, 0x3b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20,
+  0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6c, 0x69,
+  0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6d,
+  0x61, 0x73, 0x6b, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x0a,
+  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x20,
+  0x3d, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x0a,
+  0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x69,
+  0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e,
+  0x67, 0x34, 0x28, 0x6c, 0x6f, 0x61, 0x64, 0x52, 0x6f, 0x75, 0x6e, 0x64,
+  0x33, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20, 0x6f, 0x66,
+  0x73, 0x2b, 0x6c, 0x49, 0x64, 0x29, 0x2c, 0x20, 0x6c, 0x49, 0x64, 0x2c,
   0x20, 0x6f, 0x66, 0x73, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73,
   0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b,
-  0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x35,
-  0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b,
-  0x32, 0x35, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74,
-  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a,
-  0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x31, 0x32,
-  0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35,
-  0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61,
-  0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09,
-  0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x36, 0x38, 0x2b,
-  0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x36,
-  0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09,
-  0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x30, 0x32, 0x34,
-  0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x31,
-  0x30, 0x32, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74,
-  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a,
-  0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x32, 0x38,
-  0x30, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b,
-  0x31, 0x32, 0x38, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b,
-  0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x35,
-  0x33, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73,
-  0x2b, 0x31, 0x35, 0x33, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43,
-  0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29,
-  0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x31,
-  0x37, 0x39, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66,
-  0x73, 0x2b, 0x31, 0x37, 0x39, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
-  0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69,
-  0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67,
-  0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73,
-  0x2b, 0x32, 0x30, 0x34, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20,
-  0x6f, 0x66, 0x73, 0x2b, 0x32, 0x30, 0x34, 0x38, 0x2b, 0x6c, 0x49, 0x64,
-  0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61,
-  0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e,
-  0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66,
-  0x73, 0x2b, 0x32, 0x33, 0x30, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c,
-  0x20, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x33, 0x30, 0x34, 0x2b, 0x6c, 0x49,
+  0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66,
+  0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x32, 0x35, 0x36,
+  0x29, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x6d,
+  0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x6c, 0x6f, 0x61, 0x64,
+  0x52, 0x6f, 0x75, 0x6e, 0x64, 0x33, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
+  0x30, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x35, 0x36, 0x2b, 0x6c,
+  0x49, 0x64, 0x29, 0x2c, 0x20, 0x32, 0x35, 0x36, 0x2b, 0x6c, 0x49, 0x64,
+  0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x35, 0x36, 0x2b, 0x6c, 0x49,
   0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d,
-  0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69,
-  0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f,
-  0x66, 0x73, 0x2b, 0x32, 0x35, 0x36, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x5d,
-  0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x35, 0x36, 0x30, 0x2b, 0x6c,
-  0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20,
-  0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b,
-  0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b,
-  0x6f, 0x66, 0x73, 0x2b, 0x32, 0x38, 0x31, 0x36, 0x2b, 0x6c, 0x49, 0x64,
-  0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x38, 0x31, 0x36, 0x2b,
-  0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c,
-  0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x6d, 0x61,
-  0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x30, 0x37, 0x32, 0x2b, 0x6c,
-  0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x30, 0x37,
-  0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d,
-  0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x33, 0x32, 0x38, 0x2b,
-  0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x33,
-  0x32, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72,
+  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x29,
+  0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20,
+  0x2b, 0x20, 0x35, 0x31, 0x32, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c,
+  0x69, 0x6d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34,
+  0x28, 0x6c, 0x6f, 0x61, 0x64, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x33, 0x28,
+  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b,
+  0x35, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x29, 0x2c, 0x20, 0x35, 0x31,
+  0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35,
+  0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72,
   0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61,
-  0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09,
-  0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x35, 0x38, 0x34,
-  0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x33,
-  0x35, 0x38, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74,
-  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a,
-  0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x38, 0x34,
-  0x30, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b,
-  0x33, 0x38, 0x34, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b,
-  0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x34,
-  0x30, 0x39, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66,
-  0x73, 0x2b, 0x34, 0x30, 0x39, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
-  0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69,
-  0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34,
-  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b,
-  0x34, 0x33, 0x35, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f,
-  0x66, 0x73, 0x2b, 0x34, 0x33, 0x35, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c,
+  0x62, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28,
+  0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x37, 0x36, 0x38, 0x29, 0x20,
+  0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x6d, 0x61, 0x73,
+  0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x6c, 0x6f, 0x61, 0x64, 0x52, 0x6f,
+  0x75, 0x6e, 0x64, 0x33, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c,
+  0x20, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64,
+  0x29, 0x2c, 0x20, 0x37, 0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
+  0x6f, 0x66, 0x73, 0x2b, 0x37, 0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c,
   0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73,
-  0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67,
-  0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73,
-  0x2b, 0x34, 0x36, 0x30, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20,
-  0x6f, 0x66, 0x73, 0x2b, 0x34, 0x36, 0x30, 0x38, 0x2b, 0x6c, 0x49, 0x64,
-  0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61,
-  0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e,
-  0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66,
-  0x73, 0x2b, 0x34, 0x38, 0x36, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c,
-  0x20, 0x6f, 0x66, 0x73, 0x2b, 0x34, 0x38, 0x36, 0x34, 0x2b, 0x6c, 0x49,
-  0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d,
-  0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b,
-  0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b,
-  0x6f, 0x66, 0x73, 0x2b, 0x35, 0x31, 0x32, 0x30, 0x2b, 0x6c, 0x49, 0x64,
-  0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x31, 0x32, 0x30, 0x2b,
-  0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c,
-  0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73,
-  0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30,
-  0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x33, 0x37, 0x36, 0x2b, 0x6c, 0x49,
-  0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x33, 0x37, 0x36,
-  0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d,
-  0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-  0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x36, 0x33, 0x32, 0x2b, 0x6c,
-  0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x36, 0x33,
-  0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d,
-  0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x38, 0x38, 0x38, 0x2b,
-  0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x38,
-  0x38, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61,
-  0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a,
-  0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x36, 0x31, 0x34,
-  0x34, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b,
-  0x36, 0x31, 0x34, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73,
+  0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a,
+  0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20,
+  0x31, 0x30, 0x32, 0x34, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69,
+  0x6d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
+  0x6c, 0x6f, 0x61, 0x64, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x33, 0x28, 0x69,
+  0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x31,
+  0x30, 0x32, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x29, 0x2c, 0x20, 0x31, 0x30,
+  0x32, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b,
+  0x31, 0x30, 0x32, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73,
   0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b,
-  0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x36, 0x34,
-  0x30, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73,
-  0x2b, 0x36, 0x34, 0x30, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43,
-  0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29,
-  0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x36,
-  0x36, 0x35, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66,
-  0x73, 0x2b, 0x36, 0x36, 0x35, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
-  0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69,
-  0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34,
-  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b,
-  0x36, 0x39, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f,
-  0x66, 0x73, 0x2b, 0x36, 0x39, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c,
-  0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73,
-  0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e,
-  0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66,
-  0x73, 0x2b, 0x37, 0x31, 0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c,
-  0x20, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x31, 0x36, 0x38, 0x2b, 0x6c, 0x49,
-  0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d,
-  0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28,
-  0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x37, 0x34, 0x32, 0x34, 0x29, 0x20,
-  0x3c, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x29, 0x20, 0x6d,
-  0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x34, 0x32, 0x34, 0x2b,
-  0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x34,
-  0x32, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72,
+  0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x62,
+  0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c,
+  0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e,
+  0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x23, 0x69, 0x66, 0x64, 0x65, 0x66,
+  0x20, 0x43, 0x4f, 0x4c, 0x4c, 0x49, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x53,
+  0x4f, 0x52, 0x54, 0x0a, 0x09, 0x73, 0x6f, 0x72, 0x74, 0x43, 0x6f, 0x6c,
+  0x6c, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x28, 0x26, 0x73, 0x63, 0x72,
   0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61,
-  0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09,
-  0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x37,
-  0x36, 0x38, 0x30, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x30, 0x5d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34,
-  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b,
-  0x37, 0x36, 0x38, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f,
-  0x66, 0x73, 0x2b, 0x37, 0x36, 0x38, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c,
-  0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73,
-  0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49,
-  0x64, 0x20, 0x2b, 0x20, 0x37, 0x39, 0x33, 0x36, 0x29, 0x20, 0x3c, 0x20,
-  0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x29, 0x20, 0x6d, 0x61, 0x73,
-  0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30,
-  0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x39, 0x33, 0x36, 0x2b, 0x6c, 0x49,
-  0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x39, 0x33, 0x36,
-  0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d,
-  0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x69,
-  0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x38, 0x31,
-  0x39, 0x32, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30,
-  0x5d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x38,
-  0x31, 0x39, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66,
-  0x73, 0x2b, 0x38, 0x31, 0x39, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
+  0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29,
+  0x3b, 0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20,
+  0x6c, 0x49, 0x64, 0x3b, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73,
+  0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x3b, 0x20, 0x73, 0x6f,
+  0x72, 0x74, 0x50, 0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x35, 0x36,
+  0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f,
+  0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61,
+  0x74, 0x63, 0x68, 0x34, 0x5b, 0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73,
+  0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09, 0x09, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x72, 0x75, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d,
+  0x20, 0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73, 0x20, 0x2d, 0x20, 0x28,
+  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x6f, 0x77, 0x6e,
+  0x50, 0x6f, 0x73, 0x5d, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46,
+  0x46, 0x29, 0x3b, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x46, 0x69, 0x72, 0x73,
+  0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x20, 0x63, 0x6f, 0x6c,
+  0x6c, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a,
+  0x0a, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x3b, 0x20, 0x72, 0x75,
+  0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x50,
+  0x6f, 0x73, 0x3b, 0x20, 0x72, 0x75, 0x6e, 0x50, 0x6f, 0x73, 0x2b, 0x2b,
+  0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x63, 0x6f, 0x6c, 0x6c, 0x69,
+  0x64, 0x65, 0x33, 0x28, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x2c, 0x20,
+  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x72, 0x75, 0x6e,
+  0x50, 0x6f, 0x73, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x2c, 0x20,
   0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69,
-  0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64,
-  0x20, 0x2b, 0x20, 0x38, 0x34, 0x34, 0x38, 0x29, 0x20, 0x3c, 0x20, 0x69,
-  0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b,
-  0x6f, 0x66, 0x73, 0x2b, 0x38, 0x34, 0x34, 0x38, 0x2b, 0x6c, 0x49, 0x64,
-  0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x38, 0x34, 0x34, 0x38, 0x2b,
-  0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c,
-  0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x0a, 0x09,
-  0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f,
-  0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45,
-  0x4e, 0x43, 0x45, 0x29, 0x3b, 0x09, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x20, 0x3d, 0x20, 0x6d, 0x69,
-  0x6e, 0x28, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x28,
-  0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x31, 0x32, 0x31, 0x36, 0x29, 0x3b,
-  0x0a, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43,
-  0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d,
-  0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75,
-  0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d,
-  0x20, 0x6c, 0x49, 0x64, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x34, 0x5b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a,
-  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73,
-  0x20, 0x3d, 0x20, 0x6f, 0x77, 0x6e, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x3b,
-  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x6e, 0x74, 0x3d, 0x30,
-  0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x20, 0x6f, 0x75,
-  0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x77,
-  0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73,
+  0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20, 0x6f, 0x75,
+  0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x6c, 0x6f,
+  0x73, 0x73, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a,
+  0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64,
+  0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x20,
+  0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x6f,
+  0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6f,
+  0x77, 0x6e, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x6e,
+  0x74, 0x3d, 0x30, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x77, 0x68, 0x69, 0x6c,
+  0x65, 0x20, 0x28, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20,
+  0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x28,
+  0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c,
+  0x69, 0x6d, 0x29, 0x20, 0x3f, 0x20, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73,
+  0x20, 0x3a, 0x20, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x2b, 0x32, 0x35,
+  0x36, 0x3b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x6c,
+  0x65, 0x6d, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x34, 0x5b, 0x61, 0x64, 0x64, 0x72, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x0a,
+  0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73,
   0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x7b, 0x0a,
-  0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x64, 0x64, 0x72, 0x20,
-  0x3d, 0x20, 0x28, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20,
-  0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x3f, 0x20, 0x6f, 0x74, 0x68,
-  0x50, 0x6f, 0x73, 0x20, 0x3a, 0x20, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73,
-  0x2b, 0x32, 0x35, 0x36, 0x3b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74,
-  0x20, 0x65, 0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x34, 0x5b, 0x61, 0x64, 0x64, 0x72, 0x5d, 0x3b, 0x0a,
-  0x09, 0x09, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6f, 0x74, 0x68,
-  0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29,
-  0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
-  0x45, 0x6c, 0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x30, 0x5b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d,
-  0x20, 0x5e, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b,
-  0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x09, 0x0a, 0x09, 0x09,
-  0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x31,
-  0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b,
-  0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x5e, 0x20, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x6f, 0x74, 0x68, 0x50, 0x6f,
-  0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6f,
-  0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x31, 0x20, 0x21,
-  0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x62,
-  0x75, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75,
-  0x74, 0x45, 0x6c, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x32,
-  0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x3b, 0x0a,
-  0x09, 0x09, 0x09, 0x09, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74,
-  0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x6f, 0x75,
-  0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x62, 0x75, 0x63,
-  0x6b, 0x5d, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x6f, 0x75,
-  0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x32, 0x20, 0x3d, 0x20,
-  0x30, 0x3b, 0x20, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74,
-  0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20, 0x30,
-  0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75,
-  0x74, 0x45, 0x6c, 0x2e, 0x6c, 0x6f, 0x20, 0x3d, 0x20, 0x73, 0x68, 0x72,
-  0x5f, 0x34, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e,
-  0x6c, 0x6f, 0x2c, 0x32, 0x35, 0x29, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x2f,
-  0x2f, 0x20, 0x53, 0x68, 0x69, 0x66, 0x74, 0x20, 0x61, 0x77, 0x61, 0x79,
-  0x20, 0x32, 0x35, 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a, 0x0a, 0x09, 0x09,
-  0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73,
-  0x32, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x35,
-  0x5b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x20, 0x0a, 0x09,
-  0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e,
-  0x73, 0x33, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x35, 0x5b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x20, 0x0a,
-  0x0a, 0x09, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x70, 0x6f, 0x73,
-  0x20, 0x3c, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a,
-  0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x70, 0x6f,
-  0x73, 0x20, 0x2b, 0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x2a, 0x62, 0x75,
-  0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x0a, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x70,
-  0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
-  0x45, 0x6c, 0x2e, 0x6c, 0x6f, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7d,
-  0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x7d, 0x20, 0x65, 0x6c,
-  0x73, 0x65, 0x20, 0x7b, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x6f, 0x77, 0x6e,
-  0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x09,
-  0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x35,
-  0x36, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x09, 0x6f, 0x74,
-  0x68, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x3b,
-  0x0a, 0x09, 0x09, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20,
-  0x28, 0x63, 0x6e, 0x74, 0x3c, 0x34, 0x30, 0x29, 0x20, 0x3f, 0x20, 0x6f,
-  0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x4c, 0x69,
-  0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x63, 0x6e, 0x74, 0x2b, 0x2b, 0x3b, 0x0a,
-  0x09, 0x7d, 0x20, 0x0a, 0x7d, 0x0a, 0x0a, 0x0a, 0x5f, 0x5f, 0x6b, 0x65,
-  0x72, 0x6e, 0x65, 0x6c, 0x20, 0x5f, 0x5f, 0x61, 0x74, 0x74, 0x72, 0x69,
-  0x62, 0x75, 0x74, 0x65, 0x5f, 0x5f, 0x28, 0x28, 0x72, 0x65, 0x71, 0x64,
-  0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f,
-  0x73, 0x69, 0x7a, 0x65, 0x28, 0x32, 0x35, 0x36, 0x2c, 0x20, 0x31, 0x2c,
-  0x20, 0x31, 0x29, 0x29, 0x29, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72,
-  0x6f, 0x75, 0x6e, 0x64, 0x34, 0x20, 0x28, 0x09, 0x09, 0x09, 0x09, 0x2f,
-  0x2f, 0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x34, 0x0a, 0x09, 0x09,
-  0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
-  0x74, 0x34, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c,
+  0x09, 0x09, 0x09, 0x63, 0x6f, 0x6c, 0x6c, 0x69, 0x64, 0x65, 0x33, 0x28,
+  0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x2c, 0x20, 0x6f, 0x74, 0x68, 0x50,
+  0x6f, 0x73, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x30,
+  0x2c, 0x20, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
+  0x2c, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x7d,
+  0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x20, 0x0a, 0x09, 0x09, 0x09,
+  0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x3b, 0x0a,
+  0x09, 0x09, 0x09, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x2b, 0x3d,
+  0x20, 0x32, 0x35, 0x36, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x0a, 0x09,
+  0x09, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x65, 0x6c,
+  0x65, 0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x63,
+  0x6e, 0x74, 0x20, 0x3e, 0x3d, 0x20, 0x63, 0x68, 0x61, 0x69, 0x6e, 0x43,
+  0x61, 0x70, 0x29, 0x20, 0x26, 0x26, 0x20, 0x28, 0x6f, 0x77, 0x6e, 0x50,
+  0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x29,
+  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x4c, 0x6f, 0x73, 0x73, 0x28, 0x6c,
+  0x6f, 0x73, 0x73, 0x2c, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x43, 0x68, 0x61,
+  0x69, 0x6e, 0x31, 0x2b, 0x32, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x6f, 0x77,
+  0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6e, 0x74, 0x3c,
+  0x63, 0x68, 0x61, 0x69, 0x6e, 0x43, 0x61, 0x70, 0x29, 0x20, 0x3f, 0x20,
+  0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x4c,
+  0x69, 0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x63, 0x6e, 0x74, 0x2b, 0x2b, 0x3b,
+  0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a,
+  0x7d, 0x0a, 0x0a, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c,
+  0x20, 0x5f, 0x5f, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x5f, 0x5f, 0x28, 0x28, 0x72, 0x65, 0x71, 0x64, 0x5f, 0x77, 0x6f, 0x72,
+  0x6b, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65,
+  0x28, 0x32, 0x35, 0x36, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x31, 0x29, 0x29,
+  0x29, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+  0x34, 0x20, 0x28, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x52, 0x6f,
+  0x75, 0x6e, 0x64, 0x20, 0x34, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x2a,
+  0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x5f,
+  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x34, 0x20, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x30, 0x2c,
   0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
-  0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x70,
-  0x75, 0x74, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
-  0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63,
-  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x09,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x65, 0x72, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x63, 0x6f, 0x6e,
+  0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x20, 0x2a, 0x20,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x76, 0x6f, 0x6c, 0x61, 0x74,
+  0x69, 0x6c, 0x65, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6a,
+  0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x09,
   0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x20, 0x67,
   0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28,
   0x30, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x67, 0x72,
   0x70, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x72, 0x6f, 0x75,
   0x70, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x20, 0x0a, 0x0a, 0x09,
-  0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20,
-  0x3d, 0x20, 0x67, 0x72, 0x70, 0x20, 0x3e, 0x3e, 0x20, 0x33, 0x3b, 0x0a,
-  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d,
-  0x20, 0x28, 0x67, 0x72, 0x70, 0x20, 0x26, 0x20, 0x37, 0x29, 0x3b, 0x0a,
-  0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69,
-  0x6e, 0x74, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x37,
-  0x32, 0x39, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x5f, 0x5f, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x20, 0x3d, 0x20, 0x26,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x3b, 0x0a,
+  0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x37, 0x32, 0x39,
+  0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73, 0x63,
+  0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63,
+  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x5f,
+  0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x20, 0x3d,
+  0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x31, 0x32,
+  0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x32, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x5b, 0x32, 0x34, 0x33, 0x32, 0x5d, 0x3b, 0x0a,
   0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31,
+  0x74, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x33,
   0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
-  0x31, 0x32, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f,
+  0x33, 0x36, 0x34, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f,
   0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x32, 0x20, 0x3d, 0x20, 0x26, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x32, 0x34, 0x33, 0x32, 0x5d,
+  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x20, 0x3d, 0x20, 0x26, 0x73,
+  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x34, 0x38, 0x36, 0x34, 0x5d,
   0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75,
   0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x33, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x5b, 0x33, 0x36, 0x34, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a,
-  0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x20, 0x3d, 0x20,
-  0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x34, 0x38, 0x36,
-  0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x35, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x36, 0x30, 0x38, 0x30, 0x5d, 0x3b, 0x0a, 0x0a,
-  0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x74, 0x61, 0x62, 0x5b, 0x35, 0x31, 0x32, 0x5d, 0x3b, 0x0a,
-  0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x32, 0x5d, 0x3b, 0x0a, 0x0a,
-  0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69,
-  0x6e, 0x74, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74,
-  0x65, 0x72, 0x20, 0x3d, 0x20, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65,
-  0x72, 0x73, 0x5b, 0x32, 0x34, 0x35, 0x37, 0x36, 0x5d, 0x3b, 0x0a, 0x09,
+  0x68, 0x35, 0x20, 0x3d, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x5b, 0x36, 0x30, 0x38, 0x30, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x5f,
+  0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x74, 0x61, 0x62, 0x5b, 0x35, 0x31, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x5f,
+  0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x5f,
+  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x2a, 0x20, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
+  0x20, 0x3d, 0x20, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73,
+  0x5b, 0x31, 0x39, 0x36, 0x36, 0x30, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x5f,
+  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65,
+  0x72, 0x20, 0x3d, 0x20, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
+  0x73, 0x5b, 0x32, 0x36, 0x32, 0x31, 0x34, 0x34, 0x5d, 0x3b, 0x0a, 0x09,
   0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74,
-  0x65, 0x72, 0x20, 0x3d, 0x20, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65,
-  0x72, 0x73, 0x5b, 0x33, 0x32, 0x37, 0x36, 0x38, 0x5d, 0x3b, 0x0a, 0x0a,
-  0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x3d, 0x20,
-  0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x31, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x09, 0x09, 0x69, 0x43,
-  0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28,
-  0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x62, 0x75,
-  0x63, 0x6b, 0x65, 0x74, 0x5d, 0x2c, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29,
-  0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x29,
-  0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x0a, 0x09, 0x74, 0x61, 0x62, 0x5b,
-  0x6c, 0x49, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46,
-  0x3b, 0x0a, 0x09, 0x74, 0x61, 0x62, 0x5b, 0x6c, 0x49, 0x64, 0x2b, 0x32,
-  0x35, 0x36, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x3b,
-  0x0a, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43,
-  0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d,
-  0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75,
-  0x69, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x73, 0x20, 0x3d, 0x20, 0x62, 0x75,
-  0x63, 0x6b, 0x65, 0x74, 0x2a, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53,
-  0x69, 0x7a, 0x65, 0x3b, 0x09, 0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b,
-  0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b,
-  0x6f, 0x66, 0x73, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66,
+  0x74, 0x20, 0x2a, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x20, 0x3d, 0x20, 0x26,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x6c, 0x6f, 0x73,
+  0x73, 0x42, 0x61, 0x73, 0x65, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x69, 0x66,
+  0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20,
+  0x7b, 0x0a, 0x09, 0x09, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x20,
+  0x3d, 0x20, 0x69, 0x73, 0x53, 0x74, 0x61, 0x6c, 0x65, 0x28, 0x70, 0x61,
+  0x72, 0x61, 0x6d, 0x73, 0x2c, 0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f,
+  0x63, 0x68, 0x29, 0x20, 0x3f, 0x20, 0x30, 0x20, 0x3a, 0x20, 0x6d, 0x69,
+  0x6e, 0x28, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b,
+  0x67, 0x72, 0x70, 0x5d, 0x2c, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20,
+  0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a,
+  0x65, 0x29, 0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x0a, 0x09, 0x74, 0x61,
+  0x62, 0x5b, 0x6c, 0x49, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62,
+  0x45, 0x6d, 0x70, 0x74, 0x79, 0x3b, 0x0a, 0x09, 0x74, 0x61, 0x62, 0x5b,
+  0x6c, 0x49, 0x64, 0x2b, 0x32, 0x35, 0x36, 0x5d, 0x20, 0x3d, 0x20, 0x74,
+  0x61, 0x62, 0x45, 0x6d, 0x70, 0x74, 0x79, 0x3b, 0x0a, 0x0a, 0x09, 0x62,
+  0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c,
+  0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e,
+  0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x6f, 0x66, 0x73, 0x20, 0x3d, 0x20, 0x67, 0x72, 0x70, 0x2a, 0x73, 0x75,
+  0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4f, 0x6e, 0x6c,
+  0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6d, 0x61, 0x73, 0x6b,
+  0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x0a, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x20, 0x3d, 0x20, 0x69,
+  0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x69, 0x66,
+  0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69,
+  0x6d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
+  0x6c, 0x6f, 0x61, 0x64, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x34, 0x28, 0x69,
+  0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x6c,
+  0x49, 0x64, 0x29, 0x2c, 0x20, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x6f, 0x66,
   0x73, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
   0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d,
-  0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x35, 0x36, 0x2b, 0x6c,
-  0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x35, 0x36,
-  0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d,
-  0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-  0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x31, 0x32, 0x2b, 0x6c, 0x49,
-  0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x31, 0x32, 0x2b,
-  0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c,
-  0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73,
-  0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30,
-  0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64,
-  0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x36, 0x38, 0x2b, 0x6c,
-  0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20,
-  0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73,
-  0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30,
-  0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x30, 0x32, 0x34, 0x2b, 0x6c, 0x49,
-  0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x30, 0x32, 0x34,
-  0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d,
-  0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-  0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x32, 0x38, 0x30, 0x2b, 0x6c,
-  0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x32, 0x38,
-  0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d,
-  0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x35, 0x33, 0x36, 0x2b,
-  0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x35,
-  0x33, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61,
-  0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09,
-  0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x37, 0x39, 0x32,
-  0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x31,
-  0x37, 0x39, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74,
-  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a,
-  0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x32, 0x30,
-  0x34, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73,
-  0x2b, 0x32, 0x30, 0x34, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43,
-  0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29,
-  0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x32,
-  0x33, 0x30, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66,
-  0x73, 0x2b, 0x32, 0x33, 0x30, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
+  0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28,
+  0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x32, 0x35, 0x36, 0x29, 0x20, 0x3c,
+  0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b,
+  0x69, 0x6e, 0x67, 0x34, 0x28, 0x6c, 0x6f, 0x61, 0x64, 0x52, 0x6f, 0x75,
+  0x6e, 0x64, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20,
+  0x6f, 0x66, 0x73, 0x2b, 0x32, 0x35, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x29,
+  0x2c, 0x20, 0x32, 0x35, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x6f,
+  0x66, 0x73, 0x2b, 0x32, 0x35, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
   0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69,
-  0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34,
-  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b,
-  0x32, 0x35, 0x36, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f,
-  0x66, 0x73, 0x2b, 0x32, 0x35, 0x36, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c,
-  0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73,
-  0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67,
-  0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73,
-  0x2b, 0x32, 0x38, 0x31, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20,
-  0x6f, 0x66, 0x73, 0x2b, 0x32, 0x38, 0x31, 0x36, 0x2b, 0x6c, 0x49, 0x64,
-  0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61,
-  0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69,
-  0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f,
-  0x66, 0x73, 0x2b, 0x33, 0x30, 0x37, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d,
-  0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x30, 0x37, 0x32, 0x2b, 0x6c,
-  0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20,
-  0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b,
-  0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b,
-  0x6f, 0x66, 0x73, 0x2b, 0x33, 0x33, 0x32, 0x38, 0x2b, 0x6c, 0x49, 0x64,
-  0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x33, 0x32, 0x38, 0x2b,
+  0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09,
+  0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x35,
+  0x31, 0x32, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29,
+  0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x6c, 0x6f,
+  0x61, 0x64, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x34, 0x28, 0x69, 0x6e, 0x70,
+  0x75, 0x74, 0x30, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x31, 0x32,
+  0x2b, 0x6c, 0x49, 0x64, 0x29, 0x2c, 0x20, 0x35, 0x31, 0x32, 0x2b, 0x6c,
+  0x49, 0x64, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x31, 0x32, 0x2b,
   0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
   0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c,
-  0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73,
-  0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30,
-  0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x35, 0x38, 0x34, 0x2b, 0x6c, 0x49,
-  0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x35, 0x38, 0x34,
-  0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d,
-  0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-  0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x38, 0x34, 0x30, 0x2b, 0x6c,
-  0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x33, 0x38, 0x34,
-  0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09,
-  0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x34, 0x30, 0x39, 0x36,
-  0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x34,
-  0x30, 0x39, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74,
-  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a,
-  0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x34, 0x33, 0x35,
-  0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b,
-  0x34, 0x33, 0x35, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73,
+  0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49,
+  0x64, 0x20, 0x2b, 0x20, 0x37, 0x36, 0x38, 0x29, 0x20, 0x3c, 0x20, 0x69,
+  0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e,
+  0x67, 0x34, 0x28, 0x6c, 0x6f, 0x61, 0x64, 0x52, 0x6f, 0x75, 0x6e, 0x64,
+  0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20, 0x6f, 0x66,
+  0x73, 0x2b, 0x37, 0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x29, 0x2c, 0x20,
+  0x37, 0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x6f, 0x66, 0x73,
+  0x2b, 0x37, 0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73,
   0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b,
-  0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x34, 0x36,
-  0x30, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73,
-  0x2b, 0x34, 0x36, 0x30, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43,
-  0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29,
-  0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x34,
-  0x38, 0x36, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66,
-  0x73, 0x2b, 0x34, 0x38, 0x36, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
-  0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69,
-  0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67,
-  0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73,
-  0x2b, 0x35, 0x31, 0x32, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20,
-  0x6f, 0x66, 0x73, 0x2b, 0x35, 0x31, 0x32, 0x30, 0x2b, 0x6c, 0x49, 0x64,
-  0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61,
-  0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e,
-  0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66,
-  0x73, 0x2b, 0x35, 0x33, 0x37, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c,
-  0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x33, 0x37, 0x36, 0x2b, 0x6c, 0x49,
-  0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d,
-  0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69,
-  0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f,
-  0x66, 0x73, 0x2b, 0x35, 0x36, 0x33, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d,
-  0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x36, 0x33, 0x32, 0x2b, 0x6c,
-  0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20,
-  0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b,
-  0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b,
-  0x6f, 0x66, 0x73, 0x2b, 0x35, 0x38, 0x38, 0x38, 0x2b, 0x6c, 0x49, 0x64,
-  0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x35, 0x38, 0x38, 0x38, 0x2b,
-  0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c,
-  0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x6d, 0x61,
-  0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x36, 0x31, 0x34, 0x34, 0x2b, 0x6c,
-  0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x36, 0x31, 0x34,
+  0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66,
+  0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x31, 0x30, 0x32,
+  0x34, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20,
+  0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x6c, 0x6f, 0x61,
+  0x64, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x30, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x30, 0x32, 0x34,
+  0x2b, 0x6c, 0x49, 0x64, 0x29, 0x2c, 0x20, 0x31, 0x30, 0x32, 0x34, 0x2b,
+  0x6c, 0x49, 0x64, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x31, 0x30, 0x32,
   0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61,
   0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62,
-  0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31,
-  0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x6d,
-  0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x36, 0x34, 0x30, 0x30, 0x2b,
-  0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x36, 0x34,
-  0x30, 0x30, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61,
-  0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09,
-  0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x36, 0x36, 0x35, 0x36,
-  0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x36,
-  0x36, 0x35, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74,
-  0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54,
-  0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a,
-  0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x36, 0x39, 0x31,
-  0x32, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b,
-  0x36, 0x39, 0x31, 0x32, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b,
-  0x0a, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x37,
-  0x31, 0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66,
-  0x73, 0x2b, 0x37, 0x31, 0x36, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20,
-  0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c,
-  0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69,
-  0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x29, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34,
-  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b,
-  0x37, 0x34, 0x32, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f,
-  0x66, 0x73, 0x2b, 0x37, 0x34, 0x32, 0x34, 0x2b, 0x6c, 0x49, 0x64, 0x2c,
-  0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d,
-  0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73,
-  0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49,
-  0x64, 0x20, 0x2b, 0x20, 0x37, 0x36, 0x38, 0x30, 0x29, 0x20, 0x3c, 0x20,
-  0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x29, 0x20, 0x6d, 0x61, 0x73,
-  0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30,
-  0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x36, 0x38, 0x30, 0x2b, 0x6c, 0x49,
-  0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x36, 0x38, 0x30,
-  0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b,
-  0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d,
-  0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66,
-  0x20, 0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x37, 0x39, 0x33,
-  0x36, 0x29, 0x20, 0x3c, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d,
-  0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x37, 0x39,
-  0x33, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73,
-  0x2b, 0x37, 0x39, 0x33, 0x36, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20,
-  0x26, 0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43,
-  0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29,
-  0x3b, 0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x49, 0x64,
-  0x20, 0x2b, 0x20, 0x38, 0x31, 0x39, 0x32, 0x29, 0x20, 0x3c, 0x20, 0x69,
-  0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x29, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x30, 0x5b,
-  0x6f, 0x66, 0x73, 0x2b, 0x38, 0x31, 0x39, 0x32, 0x2b, 0x6c, 0x49, 0x64,
-  0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b, 0x38, 0x31, 0x39, 0x32, 0x2b,
-  0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30,
-  0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x31, 0x5d, 0x2c,
-  0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x20,
-  0x28, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x38, 0x34, 0x34, 0x38,
-  0x29, 0x20, 0x3c, 0x20, 0x69, 0x43, 0x4e, 0x54, 0x5b, 0x30, 0x5d, 0x29,
-  0x20, 0x6d, 0x61, 0x73, 0x6b, 0x69, 0x6e, 0x67, 0x34, 0x28, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x30, 0x5b, 0x6f, 0x66, 0x73, 0x2b, 0x38, 0x34, 0x34,
-  0x38, 0x2b, 0x6c, 0x49, 0x64, 0x5d, 0x2c, 0x20, 0x6f, 0x66, 0x73, 0x2b,
-  0x38, 0x34, 0x34, 0x38, 0x2b, 0x6c, 0x49, 0x64, 0x2c, 0x20, 0x26, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26,
-  0x74, 0x61, 0x62, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x69, 0x43, 0x4e,
-  0x54, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x3b,
-  0x0a, 0x09, 0x09, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72,
-  0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d,
-  0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x09, 0x0a,
-  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d,
-  0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x69, 0x43, 0x4e, 0x54, 0x5b,
-  0x31, 0x5d, 0x2c, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x31,
-  0x32, 0x31, 0x36, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72,
+  0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72,
   0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41,
   0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29,
-  0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e,
+  0x3b, 0x0a, 0x0a, 0x23, 0x69, 0x66, 0x64, 0x65, 0x66, 0x20, 0x43, 0x4f,
+  0x4c, 0x4c, 0x49, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x53, 0x4f, 0x52, 0x54,
+  0x0a, 0x09, 0x73, 0x6f, 0x72, 0x74, 0x43, 0x6f, 0x6c, 0x6c, 0x69, 0x73,
+  0x69, 0x6f, 0x6e, 0x73, 0x28, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x26, 0x74, 0x61, 0x62, 0x5b, 0x30,
+  0x5d, 0x2c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x3b, 0x0a, 0x0a,
+  0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73,
+  0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64,
+  0x3b, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20,
+  0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x3b, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x50,
+  0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x35, 0x36, 0x29, 0x20, 0x7b,
+  0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x50,
+  0x6f, 0x73, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x34, 0x5b, 0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x3e,
+  0x3e, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x72, 0x75, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x73, 0x6f,
+  0x72, 0x74, 0x50, 0x6f, 0x73, 0x20, 0x2d, 0x20, 0x28, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73,
+  0x5d, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x29, 0x3b,
+  0x09, 0x09, 0x2f, 0x2f, 0x20, 0x46, 0x69, 0x72, 0x73, 0x74, 0x20, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x65, 0x71, 0x75, 0x61, 0x6c, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x69, 0x73,
+  0x69, 0x6f, 0x6e, 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a, 0x0a, 0x09, 0x09,
+  0x66, 0x6f, 0x72, 0x20, 0x28, 0x3b, 0x20, 0x72, 0x75, 0x6e, 0x50, 0x6f,
+  0x73, 0x20, 0x3c, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x50, 0x6f, 0x73, 0x3b,
+  0x20, 0x72, 0x75, 0x6e, 0x50, 0x6f, 0x73, 0x2b, 0x2b, 0x29, 0x20, 0x7b,
+  0x0a, 0x09, 0x09, 0x09, 0x63, 0x6f, 0x6c, 0x6c, 0x69, 0x64, 0x65, 0x34,
+  0x28, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x2c, 0x20, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x72, 0x75, 0x6e, 0x50, 0x6f, 0x73,
+  0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x2c, 0x20, 0x26, 0x73, 0x63,
+  0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x43, 0x6f,
+  0x75, 0x6e, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x29,
+  0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x23, 0x65, 0x6c,
+  0x73, 0x65, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e,
   0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64, 0x3b, 0x0a, 0x09,
   0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x73,
   0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x6f, 0x77, 0x6e, 0x50,
   0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f,
   0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6f, 0x77, 0x6e, 0x3b,
-  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x2c,
-  0x20, 0x70, 0x6f, 0x73, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x63, 0x6e, 0x74, 0x3d, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e,
-  0x74, 0x32, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x3b,
-  0x0a, 0x09, 0x0a, 0x09, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x6f,
-  0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69,
-  0x6d, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x61, 0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x28, 0x6f, 0x74, 0x68, 0x50,
-  0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20,
-  0x3f, 0x20, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3a, 0x20, 0x6f,
-  0x77, 0x6e, 0x50, 0x6f, 0x73, 0x2b, 0x32, 0x35, 0x36, 0x3b, 0x0a, 0x09,
-  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x20, 0x3d,
-  0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x61, 0x64,
-  0x64, 0x72, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x69, 0x66,
-  0x20, 0x28, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69,
-  0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x6f,
-  0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x73, 0x30, 0x20, 0x3d,
-  0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x6f, 0x77,
-  0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x5e, 0x20, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x30, 0x5b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d,
-  0x3b, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
-  0x45, 0x6c, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x31, 0x5b, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d,
-  0x20, 0x5e, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b,
-  0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09,
-  0x69, 0x66, 0x20, 0x28, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45,
-  0x6c, 0x2e, 0x73, 0x30, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x26,
-  0x26, 0x20, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e,
-  0x73, 0x31, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x29, 0x20, 0x7b, 0x09,
-  0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4c, 0x61, 0x73, 0x74, 0x20, 0x72, 0x6f,
-  0x75, 0x6e, 0x64, 0x20, 0x77, 0x65, 0x20, 0x77, 0x61, 0x6e, 0x74, 0x20,
-  0x61, 0x6c, 0x6c, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20,
-  0x76, 0x61, 0x6e, 0x69, 0x73, 0x68, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75,
-  0x69, 0x6e, 0x74, 0x34, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3b, 0x0a,
-  0x09, 0x09, 0x09, 0x09, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73, 0x30,
-  0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x32, 0x5b,
-  0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09,
-  0x09, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x33, 0x5b, 0x6f, 0x77, 0x6e,
-  0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x69, 0x6e,
-  0x64, 0x65, 0x78, 0x2e, 0x73, 0x32, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72,
-  0x61, 0x74, 0x63, 0x68, 0x32, 0x5b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73,
-  0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x69, 0x6e, 0x64, 0x65, 0x78,
-  0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x33, 0x5b, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x5d, 0x3b, 0x0a,
-  0x0a, 0x09, 0x09, 0x09, 0x09, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6f, 0x6b,
-  0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x0a, 0x09, 0x09, 0x09,
-  0x09, 0x6f, 0x6b, 0x20, 0x3d, 0x20, 0x6f, 0x6b, 0x20, 0x26, 0x26, 0x20,
-  0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73, 0x30, 0x20, 0x21, 0x3d,
-  0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73, 0x31, 0x29, 0x20, 0x26,
-  0x26, 0x20, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73, 0x30, 0x20,
-  0x21, 0x3d, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73, 0x32, 0x29,
-  0x20, 0x26, 0x26, 0x20, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73,
-  0x30, 0x20, 0x21, 0x3d, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73,
-  0x33, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x6f, 0x6b, 0x20, 0x3d,
-  0x20, 0x6f, 0x6b, 0x20, 0x26, 0x26, 0x20, 0x28, 0x69, 0x6e, 0x64, 0x65,
-  0x78, 0x2e, 0x73, 0x31, 0x20, 0x21, 0x3d, 0x20, 0x69, 0x6e, 0x64, 0x65,
-  0x78, 0x2e, 0x73, 0x32, 0x29, 0x20, 0x26, 0x26, 0x20, 0x28, 0x69, 0x6e,
-  0x64, 0x65, 0x78, 0x2e, 0x73, 0x31, 0x20, 0x21, 0x3d, 0x20, 0x69, 0x6e,
-  0x64, 0x65, 0x78, 0x2e, 0x73, 0x33, 0x29, 0x20, 0x26, 0x26, 0x20, 0x28,
-  0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73, 0x32, 0x20, 0x21, 0x3d, 0x20,
-  0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73, 0x33, 0x29, 0x3b, 0x09, 0x0a,
-  0x0a, 0x09, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6f, 0x6b, 0x29,
-  0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x70, 0x6f, 0x73, 0x20,
-  0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x69, 0x6e, 0x63,
-  0x28, 0x26, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
-  0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x69,
-  0x66, 0x20, 0x28, 0x70, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x32, 0x35, 0x36,
-  0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x6f, 0x75,
-  0x74, 0x70, 0x75, 0x74, 0x30, 0x5b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d,
-  0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09,
-  0x7d, 0x0a, 0x09, 0x09, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b,
-  0x20, 0x0a, 0x09, 0x09, 0x09, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x65,
-  0x6c, 0x65, 0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x6f, 0x77, 0x6e, 0x50,
-  0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x35, 0x36, 0x3b, 0x0a, 0x09,
-  0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x09, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73,
-  0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x6f,
-  0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6e, 0x74,
-  0x3c, 0x34, 0x30, 0x29, 0x20, 0x3f, 0x20, 0x6f, 0x77, 0x6e, 0x50, 0x6f,
-  0x73, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x3b, 0x0a, 0x09,
-  0x09, 0x63, 0x6e, 0x74, 0x2b, 0x2b, 0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x0a,
-  0x7d, 0x0a, 0x0a, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c,
-  0x20, 0x5f, 0x5f, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
-  0x5f, 0x5f, 0x28, 0x28, 0x72, 0x65, 0x71, 0x64, 0x5f, 0x77, 0x6f, 0x72,
-  0x6b, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65,
-  0x28, 0x31, 0x36, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x31, 0x29, 0x29, 0x29,
-  0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e,
-  0x65, 0x20, 0x28, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x43, 0x6f,
-  0x6d, 0x62, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x6f,
-  0x75, 0x6e, 0x64, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
-  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x2a, 0x20, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x52, 0x32, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f,
-  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34,
-  0x20, 0x2a, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x52, 0x31, 0x2c, 0x0a,
-  0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
-  0x69, 0x6e, 0x74, 0x34, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x52, 0x33, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
-  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x20, 0x2a, 0x20, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x52, 0x30, 0x2c, 0x09, 0x09, 0x0a, 0x09, 0x09,
+  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x6e, 0x74, 0x3d, 0x30,
+  0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28,
+  0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c,
+  0x69, 0x6d, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x28, 0x6f, 0x74, 0x68,
+  0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29,
+  0x20, 0x3f, 0x20, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3a, 0x20,
+  0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x2b, 0x32, 0x35, 0x36, 0x3b, 0x0a,
+  0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x20,
+  0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x34, 0x5b, 0x61,
+  0x64, 0x64, 0x72, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x69,
+  0x66, 0x20, 0x28, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x20, 0x3c, 0x20,
+  0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09,
+  0x63, 0x6f, 0x6c, 0x6c, 0x69, 0x64, 0x65, 0x34, 0x28, 0x6f, 0x77, 0x6e,
+  0x50, 0x6f, 0x73, 0x2c, 0x20, 0x6f, 0x74, 0x68, 0x50, 0x6f, 0x73, 0x2c,
+  0x20, 0x26, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x30, 0x5d,
+  0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x30, 0x2c, 0x20, 0x6f,
+  0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x6c,
+  0x6f, 0x73, 0x73, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x20, 0x65, 0x6c,
+  0x73, 0x65, 0x20, 0x7b, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x6f, 0x77, 0x6e,
+  0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x3b, 0x0a, 0x09, 0x09, 0x09,
+  0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x35,
+  0x36, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x09, 0x6f, 0x74,
+  0x68, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x3b,
+  0x0a, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x63, 0x6e, 0x74, 0x20,
+  0x3e, 0x3d, 0x20, 0x63, 0x68, 0x61, 0x69, 0x6e, 0x43, 0x61, 0x70, 0x29,
+  0x20, 0x26, 0x26, 0x20, 0x28, 0x6f, 0x77, 0x6e, 0x50, 0x6f, 0x73, 0x20,
+  0x3c, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x29, 0x29, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x4c, 0x6f, 0x73, 0x73, 0x28, 0x6c, 0x6f, 0x73, 0x73,
+  0x2c, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x43, 0x68, 0x61, 0x69, 0x6e, 0x31,
+  0x2b, 0x33, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x6f, 0x77, 0x6e, 0x50, 0x6f,
+  0x73, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6e, 0x74, 0x3c, 0x63, 0x68, 0x61,
+  0x69, 0x6e, 0x43, 0x61, 0x70, 0x29, 0x20, 0x3f, 0x20, 0x6f, 0x77, 0x6e,
+  0x50, 0x6f, 0x73, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x3b,
+  0x0a, 0x09, 0x09, 0x63, 0x6e, 0x74, 0x2b, 0x2b, 0x3b, 0x0a, 0x09, 0x7d,
+  0x20, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x7d, 0x0a, 0x0a,
+  0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x5f, 0x5f,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x5f, 0x5f, 0x28,
+  0x28, 0x72, 0x65, 0x71, 0x64, 0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x67,
+  0x72, 0x6f, 0x75, 0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x31, 0x36,
+  0x2c, 0x20, 0x31, 0x2c, 0x20, 0x31, 0x29, 0x29, 0x29, 0x20, 0x76, 0x6f,
+  0x69, 0x64, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x20, 0x28,
+  0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69,
+  0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+  0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
+  0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x52, 0x32, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x45, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74,
+  0x52, 0x31, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
+  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x2a, 0x20, 0x69,
+  0x6e, 0x70, 0x75, 0x74, 0x52, 0x33, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x20, 0x2a, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x52, 0x30, 0x2c, 0x09,
+  0x09, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x70,
+  0x75, 0x74, 0x52, 0x34, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x0a, 0x09, 0x09,
   0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
-  0x74, 0x34, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x52, 0x34,
-  0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
-  0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c,
-  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x2a,
-  0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x29, 0x20, 0x7b, 0x0a,
-  0x0a, 0x09, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x67, 0x49, 0x64, 0x20,
-  0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f,
-  0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74,
-  0x20, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a,
-  0x0a, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
-  0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74,
-  0x65, 0x72, 0x73, 0x5b, 0x33, 0x32, 0x37, 0x36, 0x38, 0x5d, 0x3b, 0x0a,
-  0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69,
-  0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x5f, 0x67, 0x6c,
-  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x2a, 0x29, 0x20,
-  0x26, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x5b, 0x30, 0x5d, 0x3b,
-  0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75,
-  0x69, 0x6e, 0x74, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30,
-  0x5b, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x31, 0x5b, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x5f,
-  0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x6f, 0x6b, 0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20,
-  0x28, 0x67, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x69, 0x6e, 0x43, 0x6f, 0x75,
-  0x6e, 0x74, 0x65, 0x72, 0x5b, 0x30, 0x5d, 0x29, 0x20, 0x7b, 0x0a, 0x09,
-  0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x3d, 0x20,
-  0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x6f, 0x6b, 0x5b, 0x30,
-  0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x75,
-  0x69, 0x6e, 0x74, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x3b, 0x0a, 0x09, 0x09,
-  0x09, 0x74, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x52, 0x34, 0x5b, 0x67, 0x49, 0x64, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09,
-  0x0a, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31,
-  0x5b, 0x34, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x30, 0x5d, 0x20, 0x3d, 0x20,
-  0x74, 0x6d, 0x70, 0x2e, 0x73, 0x30, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x34, 0x2a, 0x6c, 0x49,
-  0x64, 0x2b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x2e, 0x73,
-  0x31, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x31, 0x5b, 0x34, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x32, 0x5d, 0x20,
-  0x3d, 0x20, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x32, 0x3b, 0x0a, 0x09, 0x09,
-  0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x34, 0x2a,
-  0x6c, 0x49, 0x64, 0x2b, 0x33, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70,
-  0x2e, 0x73, 0x33, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x09,
-  0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f,
-  0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45,
-  0x4e, 0x43, 0x45, 0x29, 0x3b, 0x20, 0x0a, 0x0a, 0x09, 0x09, 0x69, 0x66,
-  0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x34, 0x29, 0x20, 0x7b,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x52,
-  0x65, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x70,
-  0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20,
-  0x32, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x64,
-  0x64, 0x72, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x31, 0x5b, 0x6c, 0x49, 0x64, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x69,
-  0x66, 0x20, 0x28, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3c, 0x20, 0x28, 0x62,
-  0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x3c, 0x3c,
-  0x20, 0x31, 0x33, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09,
-  0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x20, 0x3d, 0x20,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x52, 0x32, 0x5b, 0x61, 0x64, 0x64, 0x72,
-  0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x09,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x32, 0x2a, 0x6c,
-  0x49, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x32,
-  0x3b, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x30, 0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x31, 0x5d,
-  0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x33, 0x3b, 0x09, 0x0a,
-  0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x09,
-  0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f,
-  0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45,
-  0x4e, 0x43, 0x45, 0x29, 0x3b, 0x20, 0x0a, 0x0a, 0x09, 0x09, 0x69, 0x66,
-  0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x7b,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x52,
-  0x65, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x70,
-  0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20,
-  0x31, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x64,
-  0x64, 0x72, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x30, 0x5b, 0x6c, 0x49, 0x64, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x69,
-  0x66, 0x20, 0x28, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3c, 0x20, 0x28, 0x62,
-  0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x3c, 0x3c,
-  0x20, 0x31, 0x33, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09,
-  0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x20, 0x3d, 0x20,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x52, 0x31, 0x5b, 0x61, 0x64, 0x64, 0x72,
-  0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x2e,
-  0x73, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x33, 0x20,
-  0x26, 0x20, 0x30, 0x78, 0x33, 0x46, 0x46, 0x46, 0x3b, 0x09, 0x09, 0x09,
-  0x09, 0x2f, 0x2f, 0x20, 0x55, 0x6e, 0x70, 0x61, 0x63, 0x6b, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d,
-  0x70, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x2e,
-  0x73, 0x33, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x34, 0x29, 0x20, 0x26, 0x20,
-  0x30, 0x78, 0x33, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09,
-  0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x32, 0x20, 0x3d, 0x20, 0x74, 0x6d,
-  0x70, 0x2e, 0x73, 0x32, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x33, 0x3b, 0x0a,
-  0x09, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x33, 0x20, 0x3d,
-  0x20, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x33, 0x20, 0x3e, 0x3e, 0x20, 0x32,
-  0x38, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x2e,
-  0x73, 0x33, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x2e, 0x73,
-  0x32, 0x20, 0x3c, 0x3c, 0x20, 0x34, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09,
-  0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x33, 0x20, 0x2a, 0x3d, 0x20, 0x62,
-  0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x0a, 0x09,
-  0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x31, 0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64, 0x5d, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x30, 0x20, 0x2b,
-  0x20, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x33, 0x3b, 0x09, 0x0a, 0x09, 0x09,
-  0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x32,
-  0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x6d,
-  0x70, 0x2e, 0x73, 0x31, 0x20, 0x2b, 0x20, 0x74, 0x6d, 0x70, 0x2e, 0x73,
-  0x33, 0x3b, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x20, 0x0a, 0x09, 0x09,
-  0x7d, 0x0a, 0x0a, 0x09, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72,
-  0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d,
-  0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x20, 0x09,
-  0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-  0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x64, 0x64, 0x72,
-  0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b,
-  0x6c, 0x49, 0x64, 0x5d, 0x3b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f,
-  0x20, 0x52, 0x65, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75,
-  0x74, 0x70, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x52, 0x6f, 0x75, 0x6e,
-  0x64, 0x20, 0x30, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x61, 0x64,
-  0x64, 0x72, 0x20, 0x3c, 0x20, 0x28, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
-  0x53, 0x69, 0x7a, 0x65, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x33, 0x29, 0x29,
-  0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x30, 0x5b, 0x6c, 0x49, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x52, 0x30, 0x5b, 0x61, 0x64, 0x64, 0x72, 0x5d, 0x3b,
-  0x09, 0x0a, 0x09, 0x09, 0x7d, 0x20, 0x0a, 0x0a, 0x09, 0x09, 0x62, 0x61,
+  0x74, 0x34, 0x20, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73,
+  0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x67, 0x49, 0x64, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x72,
+  0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x20, 0x67,
+  0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28,
+  0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
+  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x69, 0x6e,
+  0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x26, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x32, 0x36, 0x32, 0x31,
+  0x34, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
+  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6f, 0x75,
+  0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x20, 0x3d, 0x20,
+  0x28, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69,
+  0x6e, 0x74, 0x2a, 0x29, 0x20, 0x26, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+  0x73, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x09,
+  0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x31, 0x36,
+  0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x6b, 0x5b, 0x31, 0x5d, 0x3b, 0x0a,
+  0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x5b, 0x32, 0x5d, 0x3b,
+  0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x67, 0x49, 0x64, 0x20, 0x3c,
+  0x20, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x30,
+  0x5d, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6c,
+  0x49, 0x64, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09,
+  0x09, 0x09, 0x6f, 0x6b, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b,
+  0x0a, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x74,
+  0x6d, 0x70, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x20, 0x3d,
+  0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x52, 0x34, 0x5b, 0x67, 0x49, 0x64,
+  0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x63,
+  0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x34, 0x2a, 0x6c, 0x49, 0x64,
+  0x2b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x30,
+  0x3b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x31, 0x5b, 0x34, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x31, 0x5d, 0x20, 0x3d,
+  0x20, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x31, 0x3b, 0x0a, 0x09, 0x09, 0x09,
+  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x34, 0x2a, 0x6c,
+  0x49, 0x64, 0x2b, 0x32, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x2e,
+  0x73, 0x32, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74,
+  0x63, 0x68, 0x31, 0x5b, 0x34, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x33, 0x5d,
+  0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x33, 0x3b, 0x0a, 0x09,
+  0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65,
+  0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f,
+  0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x20,
+  0x0a, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20,
+  0x3c, 0x20, 0x32, 0x29, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x5b,
+  0x6c, 0x49, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x62, 0x61,
   0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f,
   0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43,
-  0x45, 0x29, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20,
-  0x43, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x6f,
-  0x75, 0x62, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x65, 0x6e, 0x74,
-  0x72, 0x69, 0x65, 0x73, 0x0a, 0x0a, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x20,
-  0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69,
-  0x3c, 0x31, 0x36, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a,
-  0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x30, 0x5b, 0x6c, 0x49, 0x64, 0x5d, 0x20, 0x3d, 0x3d, 0x20,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x69, 0x5d, 0x29,
-  0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x69, 0x6e,
-  0x63, 0x28, 0x26, 0x6f, 0x6b, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09,
-  0x09, 0x7d, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x62, 0x61, 0x72, 0x72,
-  0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41,
-  0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29,
-  0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6f, 0x6b, 0x5b,
-  0x30, 0x5d, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x36, 0x29, 0x20, 0x7b, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4f, 0x6e, 0x6c, 0x79,
-  0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x74,
-  0x73, 0x65, 0x6c, 0x66, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20,
-  0x65, 0x71, 0x75, 0x61, 0x6c, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x61, 0x64, 0x64, 0x72, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x69,
-  0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29,
-  0x20, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d,
-  0x69, 0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x6f, 0x75, 0x74, 0x43,
-  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x30, 0x5d, 0x29, 0x3b,
-  0x09, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x20,
-  0x65, 0x6c, 0x65, 0x6d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x66,
-  0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x7b,
-  0x0a, 0x09, 0x09, 0x09, 0x09, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x30,
-  0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b,
-  0x32, 0x2a, 0x6c, 0x49, 0x64, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09,
-  0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64,
-  0x2b, 0x31, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x69, 0x66,
-  0x20, 0x28, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x20,
-  0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x31, 0x29, 0x20, 0x65, 0x6c, 0x65,
-  0x6d, 0x2e, 0x73, 0x30, 0x31, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d,
-  0x2e, 0x73, 0x31, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x32, 0x2a, 0x6c, 0x49,
-  0x64, 0x5d, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x30,
-  0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x31, 0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x31, 0x5d, 0x20,
-  0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x31, 0x3b, 0x09, 0x09,
-  0x09, 0x09, 0x2f, 0x2f, 0x20, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
-  0x73, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
-  0x32, 0x20, 0x45, 0x6c, 0x65, 0x6d, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a,
-  0x0a, 0x09, 0x09, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28,
+  0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x7b, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x46, 0x69, 0x6e, 0x64,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x20,
+  0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x6f,
+  0x74, 0x68, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x33, 0x20, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x0a, 0x09, 0x09, 0x09, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64, 0x20,
+  0x3e, 0x3e, 0x20, 0x33, 0x3b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f,
+  0x2f, 0x20, 0x38, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x69, 0x74, 0x65,
+  0x6d, 0x73, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x61,
+  0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x31, 0x5b, 0x32, 0x2a, 0x65, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x73,
+  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x32, 0x2a, 0x65, 0x2b,
+  0x31, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28,
+  0x28, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3c, 0x20, 0x28, 0x62, 0x75, 0x63,
+  0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x3c, 0x3c, 0x20, 0x31,
+  0x33, 0x29, 0x29, 0x20, 0x26, 0x26, 0x20, 0x28, 0x70, 0x6f, 0x73, 0x20,
+  0x3c, 0x20, 0x28, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a,
+  0x65, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x33, 0x29, 0x29, 0x29, 0x20, 0x7b,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x65,
+  0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x52,
+  0x33, 0x5b, 0x70, 0x6f, 0x73, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20,
+  0x69, 0x6e, 0x70, 0x75, 0x74, 0x52, 0x32, 0x5b, 0x61, 0x64, 0x64, 0x72,
+  0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x64,
+  0x69, 0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x33, 0x37, 0x20, 0x62, 0x69, 0x74, 0x20, 0x70, 0x61, 0x79, 0x6c,
+  0x6f, 0x61, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x6f,
+  0x75, 0x6e, 0x64, 0x20, 0x33, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x32, 0x20, 0x64, 0x69, 0x66, 0x66, 0x3b, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x64, 0x69, 0x66, 0x66, 0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20,
+  0x28, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x30, 0x20, 0x3c, 0x3c, 0x20,
+  0x32, 0x35, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x70, 0x6f, 0x73, 0x20,
+  0x2f, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65,
+  0x29, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x32, 0x29, 0x3b, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x64, 0x69, 0x66, 0x66, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20,
+  0x28, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20,
+  0x37, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x65, 0x6c, 0x65, 0x6d, 0x2e,
+  0x73, 0x31, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x29, 0x20, 0x3c,
+  0x3c, 0x20, 0x32, 0x35, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74,
+  0x3b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x57,
+  0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d,
+  0x61, 0x73, 0x6b, 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a, 0x09, 0x09, 0x09,
+  0x09, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2e, 0x73, 0x30, 0x20, 0x3d,
+  0x20, 0x6f, 0x77, 0x6e, 0x2e, 0x73, 0x30, 0x20, 0x5e, 0x20, 0x28, 0x28,
+  0x64, 0x69, 0x66, 0x66, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x33,
+  0x29, 0x20, 0x7c, 0x20, 0x28, 0x64, 0x69, 0x66, 0x66, 0x2e, 0x73, 0x31,
+  0x20, 0x3c, 0x3c, 0x20, 0x32, 0x39, 0x29, 0x29, 0x3b, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2e, 0x73, 0x31, 0x20,
+  0x3d, 0x20, 0x28, 0x6f, 0x77, 0x6e, 0x2e, 0x73, 0x31, 0x20, 0x5e, 0x20,
+  0x28, 0x64, 0x69, 0x66, 0x66, 0x2e, 0x73, 0x31, 0x20, 0x3e, 0x3e, 0x20,
+  0x33, 0x29, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x37, 0x46, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x67, 0x72, 0x70, 0x20, 0x3d, 0x20, 0x61, 0x64, 0x64,
+  0x72, 0x20, 0x2f, 0x20, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65,
+  0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x63, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x6d, 0x69,
+  0x6e, 0x28, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x31,
+  0x33, 0x31, 0x30, 0x37, 0x32, 0x2b, 0x67, 0x72, 0x70, 0x5d, 0x2c, 0x20,
+  0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x73, 0x75, 0x62, 0x42, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x3b, 0x0a, 0x0a,
+  0x09, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x26,
+  0x20, 0x37, 0x29, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x63, 0x6e, 0x74,
+  0x3b, 0x20, 0x69, 0x20, 0x2b, 0x3d, 0x20, 0x38, 0x29, 0x20, 0x7b, 0x0a,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x74,
+  0x68, 0x20, 0x3d, 0x20, 0x67, 0x72, 0x70, 0x2a, 0x73, 0x75, 0x62, 0x42,
+  0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x2b, 0x20,
+  0x69, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x32, 0x20, 0x63, 0x61, 0x6e, 0x64, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x70,
+  0x75, 0x74, 0x52, 0x32, 0x5b, 0x6f, 0x74, 0x68, 0x5d, 0x3b, 0x0a, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6f, 0x74, 0x68,
+  0x20, 0x21, 0x3d, 0x20, 0x61, 0x64, 0x64, 0x72, 0x29, 0x20, 0x26, 0x26,
+  0x20, 0x28, 0x63, 0x61, 0x6e, 0x64, 0x2e, 0x73, 0x30, 0x20, 0x3d, 0x3d,
+  0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2e, 0x73, 0x30, 0x29, 0x20,
+  0x26, 0x26, 0x20, 0x28, 0x28, 0x63, 0x61, 0x6e, 0x64, 0x2e, 0x73, 0x31,
+  0x20, 0x26, 0x20, 0x30, 0x78, 0x37, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+  0x29, 0x20, 0x3d, 0x3d, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2e,
+  0x73, 0x31, 0x29, 0x29, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f,
+  0x6d, 0x69, 0x6e, 0x28, 0x26, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x5b,
+  0x65, 0x5d, 0x2c, 0x20, 0x6f, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x7d,
+  0x0a, 0x0a, 0x09, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28,
   0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45,
-  0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x09, 0x09, 0x09,
-  0x09, 0x2f, 0x2f, 0x20, 0x44, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x45,
-  0x71, 0x75, 0x69, 0x68, 0x61, 0x73, 0x68, 0x20, 0x65, 0x6c, 0x65, 0x6d,
-  0x65, 0x6e, 0x74, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x69, 0x6e, 0x67, 0x0a,
-  0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x74, 0x6d,
-  0x70, 0x32, 0x3b, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x66,
+  0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09,
+  0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x32,
+  0x29, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x32,
+  0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x70, 0x61,
+  0x72, 0x65, 0x6e, 0x74, 0x5b, 0x6c, 0x49, 0x64, 0x5d, 0x3b, 0x0a, 0x0a,
+  0x09, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c,
+  0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f,
+  0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x69,
+  0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x34, 0x29, 0x20,
+  0x7b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20,
+  0x52, 0x65, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64,
+  0x65, 0x78, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x32, 0x0a, 0x09, 0x09, 0x09, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x73,
+  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x6c, 0x49, 0x64, 0x5d,
+  0x3b, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x61, 0x64, 0x64,
+  0x72, 0x20, 0x3c, 0x20, 0x28, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53,
+  0x69, 0x7a, 0x65, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x33, 0x29, 0x29, 0x20,
+  0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x74,
+  0x72, 0x65, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x5f, 0x5f, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x29,
+  0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x52, 0x32, 0x29, 0x5b, 0x74, 0x72,
+  0x65, 0x65, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2b, 0x61, 0x64, 0x64,
+  0x72, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x67, 0x72, 0x70, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x69, 0x6e, 0x70,
+  0x75, 0x74, 0x52, 0x32, 0x5b, 0x61, 0x64, 0x64, 0x72, 0x5d, 0x2e, 0x73,
+  0x31, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x37, 0x29, 0x20, 0x3c, 0x3c, 0x20,
+  0x31, 0x32, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x74, 0x72, 0x65, 0x65, 0x20,
+  0x3e, 0x3e, 0x20, 0x32, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x70, 0x61, 0x69, 0x72, 0x20, 0x3d,
+  0x20, 0x70, 0x61, 0x69, 0x72, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x73, 0x28, 0x74, 0x72, 0x65, 0x65, 0x20, 0x26, 0x20, 0x30, 0x78,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x30, 0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x67,
+  0x72, 0x70, 0x2a, 0x73, 0x75, 0x62, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74,
+  0x53, 0x69, 0x7a, 0x65, 0x20, 0x2b, 0x20, 0x70, 0x61, 0x69, 0x72, 0x2e,
+  0x73, 0x30, 0x3b, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64, 0x2b,
+  0x31, 0x5d, 0x20, 0x3d, 0x20, 0x67, 0x72, 0x70, 0x2a, 0x73, 0x75, 0x62,
+  0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x2b,
+  0x20, 0x70, 0x61, 0x69, 0x72, 0x2e, 0x73, 0x31, 0x3b, 0x09, 0x0a, 0x09,
+  0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x09, 0x62,
+  0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c,
+  0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e,
+  0x43, 0x45, 0x29, 0x3b, 0x20, 0x0a, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x7b, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x52, 0x65,
+  0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x31,
+  0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x64, 0x64,
+  0x72, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30,
+  0x5b, 0x6c, 0x49, 0x64, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x66,
+  0x20, 0x28, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3c, 0x20, 0x28, 0x62, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x3c, 0x3c, 0x20,
+  0x31, 0x33, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x23, 0x69, 0x66, 0x64, 0x65,
+  0x66, 0x20, 0x4d, 0x45, 0x4d, 0x33, 0x47, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x20, 0x3d, 0x20,
+  0x28, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x29, 0x20, 0x28, 0x30, 0x2c, 0x20,
+  0x30, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x52, 0x31, 0x5b, 0x68,
+  0x61, 0x6c, 0x66, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2b, 0x61, 0x64,
+  0x64, 0x72, 0x5d, 0x29, 0x3b, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a,
+  0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x74, 0x6d,
+  0x70, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x52, 0x31, 0x5b,
+  0x61, 0x64, 0x64, 0x72, 0x5d, 0x3b, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69,
+  0x66, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73,
+  0x30, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x33, 0x20, 0x26,
+  0x20, 0x30, 0x78, 0x33, 0x46, 0x46, 0x46, 0x3b, 0x09, 0x09, 0x09, 0x09,
+  0x2f, 0x2f, 0x20, 0x55, 0x6e, 0x70, 0x61, 0x63, 0x6b, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70,
+  0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x2e, 0x73,
+  0x33, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x34, 0x29, 0x20, 0x26, 0x20, 0x30,
+  0x78, 0x33, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x74, 0x6d, 0x70, 0x2e, 0x73, 0x32, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70,
+  0x2e, 0x73, 0x32, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x33, 0x3b, 0x0a, 0x09,
+  0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20,
+  0x74, 0x6d, 0x70, 0x2e, 0x73, 0x33, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x38,
+  0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73,
+  0x33, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x32,
+  0x20, 0x3c, 0x3c, 0x20, 0x34, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x74, 0x6d, 0x70, 0x2e, 0x73, 0x33, 0x20, 0x2a, 0x3d, 0x20, 0x62, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74,
+  0x63, 0x68, 0x31, 0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64, 0x5d, 0x20, 0x20,
+  0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x30, 0x20, 0x2b, 0x20,
+  0x74, 0x6d, 0x70, 0x2e, 0x73, 0x33, 0x3b, 0x09, 0x0a, 0x09, 0x09, 0x09,
+  0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x32, 0x2a,
+  0x6c, 0x49, 0x64, 0x2b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70,
+  0x2e, 0x73, 0x31, 0x20, 0x2b, 0x20, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x33,
+  0x3b, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x20, 0x0a, 0x09, 0x09, 0x7d,
+  0x0a, 0x0a, 0x09, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28,
+  0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45,
+  0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x20, 0x09, 0x0a,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0a,
+  0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x64, 0x64, 0x72, 0x20,
+  0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x6c,
+  0x49, 0x64, 0x5d, 0x3b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20,
+  0x52, 0x65, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x52, 0x6f, 0x75, 0x6e, 0x64,
+  0x20, 0x30, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x61, 0x64, 0x64,
+  0x72, 0x20, 0x3c, 0x20, 0x28, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53,
+  0x69, 0x7a, 0x65, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x33, 0x29, 0x29, 0x20,
+  0x7b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x30, 0x5b, 0x6c, 0x49, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x70,
+  0x75, 0x74, 0x52, 0x30, 0x5b, 0x61, 0x64, 0x64, 0x72, 0x5d, 0x3b, 0x09,
+  0x0a, 0x09, 0x09, 0x7d, 0x20, 0x0a, 0x0a, 0x09, 0x09, 0x62, 0x61, 0x72,
+  0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43,
+  0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45,
+  0x29, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x43,
+  0x68, 0x65, 0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x6f, 0x75,
+  0x62, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x65, 0x6e, 0x74, 0x72,
+  0x69, 0x65, 0x73, 0x0a, 0x0a, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69, 0x3c,
+  0x31, 0x36, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x09,
+  0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x30, 0x5b, 0x6c, 0x49, 0x64, 0x5d, 0x20, 0x3d, 0x3d, 0x20, 0x73,
+  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x69, 0x5d, 0x29, 0x20,
+  0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x69, 0x6e, 0x63,
+  0x28, 0x26, 0x6f, 0x6b, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09,
+  0x7d, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69,
+  0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c,
+  0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b,
+  0x0a, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6f, 0x6b, 0x5b, 0x30,
+  0x5d, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x36, 0x29, 0x20, 0x7b, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20,
+  0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x74, 0x73,
+  0x65, 0x6c, 0x66, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x65,
+  0x71, 0x75, 0x61, 0x6c, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x61, 0x64, 0x64, 0x72, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x66,
+  0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20,
+  0x61, 0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69,
+  0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x6f, 0x75, 0x74, 0x43, 0x6f,
+  0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x09,
+  0x0a, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x65,
+  0x6c, 0x65, 0x6d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x7b, 0x0a,
+  0x09, 0x09, 0x09, 0x09, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x30, 0x20,
+  0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x32,
+  0x2a, 0x6c, 0x49, 0x64, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x65,
+  0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64, 0x2b,
+  0x31, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x20, 0x65,
+  0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x31, 0x29, 0x20, 0x65, 0x6c, 0x65, 0x6d,
+  0x2e, 0x73, 0x30, 0x31, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x2e,
+  0x73, 0x31, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 0x63,
+  0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64,
+  0x5d, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x30, 0x3b,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x31, 0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x31, 0x5d, 0x20, 0x3d,
+  0x20, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x31, 0x3b, 0x09, 0x09, 0x09,
+  0x09, 0x2f, 0x2f, 0x20, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73,
+  0x20, 0x73, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x32,
+  0x20, 0x45, 0x6c, 0x65, 0x6d, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x0a,
+  0x09, 0x09, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43,
+  0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d,
+  0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x09, 0x09, 0x09, 0x09,
+  0x2f, 0x2f, 0x20, 0x44, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x45, 0x71,
+  0x75, 0x69, 0x68, 0x61, 0x73, 0x68, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x69, 0x6e, 0x67, 0x0a, 0x0a,
+  0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x74, 0x6d, 0x70,
+  0x32, 0x3b, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x7b, 0x0a,
+  0x09, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x30, 0x20,
+  0x3d, 0x20, 0x6c, 0x49, 0x64, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x3b, 0x0a,
+  0x09, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x31, 0x20,
+  0x3d, 0x20, 0x28, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b,
+  0x34, 0x2a, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x30, 0x2b, 0x30, 0x5d,
+  0x20, 0x3e, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b,
+  0x34, 0x2a, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x30, 0x2b, 0x32, 0x5d,
+  0x29, 0x20, 0x3f, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x5e, 0x20, 0x30,
+  0x78, 0x31, 0x29, 0x20, 0x3a, 0x20, 0x6c, 0x49, 0x64, 0x3b, 0x0a, 0x0a,
+  0x09, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30,
+  0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x3d, 0x20,
+  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x32, 0x2a, 0x74,
+  0x6d, 0x70, 0x32, 0x2e, 0x73, 0x31, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09,
+  0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x32, 0x2a,
+  0x6c, 0x49, 0x64, 0x2b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x32, 0x2a, 0x74, 0x6d, 0x70, 0x32,
+  0x2e, 0x73, 0x31, 0x2b, 0x31, 0x5d, 0x3b, 0x09, 0x09, 0x2f, 0x2f, 0x20,
+  0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x73, 0x6f, 0x72,
+  0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x34, 0x20, 0x45, 0x6c, 0x65,
+  0x6d, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x09,
+  0x09, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c,
+  0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f,
+  0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x0a,
+  0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c,
+  0x20, 0x38, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d,
+  0x70, 0x32, 0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64, 0x20,
+  0x3e, 0x3e, 0x20, 0x32, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d,
+  0x70, 0x32, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x38, 0x2a, 0x74, 0x6d, 0x70, 0x32,
+  0x2e, 0x73, 0x30, 0x2b, 0x30, 0x5d, 0x20, 0x3e, 0x20, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x38, 0x2a, 0x74, 0x6d, 0x70, 0x32,
+  0x2e, 0x73, 0x30, 0x2b, 0x34, 0x5d, 0x29, 0x20, 0x3f, 0x20, 0x28, 0x6c,
+  0x49, 0x64, 0x20, 0x5e, 0x20, 0x30, 0x78, 0x32, 0x29, 0x20, 0x3a, 0x20,
+  0x6c, 0x49, 0x64, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 0x63,
+  0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64,
+  0x2b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
+  0x68, 0x30, 0x5b, 0x32, 0x2a, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x31,
+  0x2b, 0x30, 0x5d, 0x3b, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x45, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x65, 0x64,
+  0x20, 0x62, 0x79, 0x20, 0x38, 0x20, 0x45, 0x6c, 0x65, 0x6d, 0x0a, 0x09,
+  0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b,
+  0x32, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x73,
+  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x32, 0x2a, 0x74, 0x6d,
+  0x70, 0x32, 0x2e, 0x73, 0x31, 0x2b, 0x31, 0x5d, 0x3b, 0x0a, 0x09, 0x09,
+  0x09, 0x7d, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x62, 0x61, 0x72,
+  0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43,
+  0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45,
+  0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x66,
   0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x7b,
   0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x30,
-  0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x3b,
+  0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64, 0x20, 0x3e, 0x3e, 0x20, 0x33, 0x3b,
   0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x31,
   0x20, 0x3d, 0x20, 0x28, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31,
-  0x5b, 0x34, 0x2a, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x30, 0x2b, 0x30,
-  0x5d, 0x20, 0x3e, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31,
-  0x5b, 0x34, 0x2a, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x30, 0x2b, 0x32,
-  0x5d, 0x29, 0x20, 0x3f, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x5e, 0x20,
-  0x30, 0x78, 0x31, 0x29, 0x20, 0x3a, 0x20, 0x6c, 0x49, 0x64, 0x3b, 0x0a,
-  0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
-  0x30, 0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x3d,
-  0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x32, 0x2a,
-  0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x31, 0x5d, 0x3b, 0x0a, 0x09, 0x09,
-  0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x32,
-  0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x32, 0x2a, 0x74, 0x6d, 0x70,
-  0x32, 0x2e, 0x73, 0x31, 0x2b, 0x31, 0x5d, 0x3b, 0x09, 0x09, 0x2f, 0x2f,
-  0x20, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x73, 0x6f,
-  0x72, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x34, 0x20, 0x45, 0x6c,
-  0x65, 0x6d, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x0a,
-  0x09, 0x09, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43,
-  0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d,
-  0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09,
-  0x0a, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20,
-  0x3c, 0x20, 0x38, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74,
-  0x6d, 0x70, 0x32, 0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64,
-  0x20, 0x3e, 0x3e, 0x20, 0x32, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74,
-  0x6d, 0x70, 0x32, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x38, 0x2a, 0x74, 0x6d, 0x70,
-  0x32, 0x2e, 0x73, 0x30, 0x2b, 0x30, 0x5d, 0x20, 0x3e, 0x20, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x38, 0x2a, 0x74, 0x6d, 0x70,
-  0x32, 0x2e, 0x73, 0x30, 0x2b, 0x34, 0x5d, 0x29, 0x20, 0x3f, 0x20, 0x28,
-  0x6c, 0x49, 0x64, 0x20, 0x5e, 0x20, 0x30, 0x78, 0x32, 0x29, 0x20, 0x3a,
-  0x20, 0x6c, 0x49, 0x64, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x73,
-  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x32, 0x2a, 0x6c, 0x49,
-  0x64, 0x2b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x30, 0x5b, 0x32, 0x2a, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73,
-  0x31, 0x2b, 0x30, 0x5d, 0x3b, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x45, 0x6c,
-  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x65,
-  0x64, 0x20, 0x62, 0x79, 0x20, 0x38, 0x20, 0x45, 0x6c, 0x65, 0x6d, 0x0a,
-  0x09, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31,
-  0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x31, 0x5d, 0x20, 0x3d, 0x20,
-  0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x32, 0x2a, 0x74,
-  0x6d, 0x70, 0x32, 0x2e, 0x73, 0x31, 0x2b, 0x31, 0x5d, 0x3b, 0x0a, 0x09,
-  0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x62, 0x61,
-  0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f,
-  0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43,
-  0x45, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x69,
-  0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x38, 0x29, 0x20,
-  0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73,
-  0x30, 0x20, 0x3d, 0x20, 0x6c, 0x49, 0x64, 0x20, 0x3e, 0x3e, 0x20, 0x33,
-  0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73,
-  0x31, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x5b, 0x31, 0x36, 0x2a, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x30, 0x2b,
+  0x30, 0x5d, 0x20, 0x3e, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
   0x31, 0x5b, 0x31, 0x36, 0x2a, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x30,
-  0x2b, 0x30, 0x5d, 0x20, 0x3e, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63,
-  0x68, 0x31, 0x5b, 0x31, 0x36, 0x2a, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73,
-  0x30, 0x2b, 0x38, 0x5d, 0x29, 0x20, 0x3f, 0x20, 0x28, 0x6c, 0x49, 0x64,
-  0x20, 0x5e, 0x20, 0x30, 0x78, 0x34, 0x29, 0x20, 0x3a, 0x20, 0x6c, 0x49,
-  0x64, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x30, 0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x30,
-  0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31,
-  0x5b, 0x32, 0x2a, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x31, 0x2b, 0x30,
-  0x5d, 0x3b, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x45, 0x6c, 0x65, 0x6d, 0x65,
-  0x6e, 0x74, 0x73, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x62,
-  0x79, 0x20, 0x31, 0x36, 0x20, 0x45, 0x6c, 0x65, 0x6d, 0x0a, 0x09, 0x09,
-  0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x32,
-  0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63,
-  0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x32, 0x2a, 0x74, 0x6d, 0x70,
-  0x32, 0x2e, 0x73, 0x31, 0x2b, 0x31, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09,
-  0x7d, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x62, 0x61, 0x72, 0x72,
-  0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41,
-  0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29,
-  0x3b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x41, 0x6c, 0x6c,
-  0x20, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x73, 0x6f,
-  0x72, 0x74, 0x65, 0x64, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09,
-  0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x3d, 0x20,
-  0x30, 0x29, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b,
-  0x30, 0x5d, 0x20, 0x3d, 0x20, 0x61, 0x64, 0x64, 0x72, 0x3b, 0x0a, 0x0a,
-  0x09, 0x09, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43,
-  0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d,
-  0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09,
-  0x09, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61,
-  0x74, 0x63, 0x68, 0x31, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09,
-  0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3c,
+  0x2b, 0x38, 0x5d, 0x29, 0x20, 0x3f, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20,
+  0x5e, 0x20, 0x30, 0x78, 0x34, 0x29, 0x20, 0x3a, 0x20, 0x6c, 0x49, 0x64,
+  0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 0x63, 0x72, 0x61, 0x74,
+  0x63, 0x68, 0x30, 0x5b, 0x32, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x30, 0x5d,
+  0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b,
+  0x32, 0x2a, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x31, 0x2b, 0x30, 0x5d,
+  0x3b, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x73, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79,
+  0x20, 0x31, 0x36, 0x20, 0x45, 0x6c, 0x65, 0x6d, 0x0a, 0x09, 0x09, 0x09,
+  0x09, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x32, 0x2a,
+  0x6c, 0x49, 0x64, 0x2b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x32, 0x2a, 0x74, 0x6d, 0x70, 0x32,
+  0x2e, 0x73, 0x31, 0x2b, 0x31, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x7d,
+  0x0a, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69,
+  0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c,
+  0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x41, 0x6c, 0x6c, 0x20,
+  0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x73, 0x6f, 0x72,
+  0x74, 0x65, 0x64, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09,
+  0x69, 0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x3d, 0x20, 0x30,
+  0x29, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x31, 0x5b, 0x30,
+  0x5d, 0x20, 0x3d, 0x20, 0x61, 0x64, 0x64, 0x72, 0x3b, 0x0a, 0x0a, 0x09,
+  0x09, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c,
+  0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f,
+  0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09,
+  0x61, 0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74,
+  0x63, 0x68, 0x31, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09,
+  0x69, 0x66, 0x20, 0x28, 0x28, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3e, 0x3d,
   0x20, 0x32, 0x30, 0x29, 0x20, 0x26, 0x26, 0x20, 0x28, 0x6c, 0x49, 0x64,
-  0x20, 0x3c, 0x20, 0x34, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09,
-  0x09, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x3b, 0x0a,
-  0x09, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x30, 0x20, 0x3d,
-  0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x34, 0x2a,
-  0x6c, 0x49, 0x64, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d,
-  0x70, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74,
-  0x63, 0x68, 0x30, 0x5b, 0x34, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x31, 0x5d,
-  0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x32,
+  0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x29, 0x20, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x4c, 0x6f, 0x73, 0x73, 0x28, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x65, 0x72, 0x73, 0x5b, 0x6c, 0x6f, 0x73, 0x73, 0x42, 0x61, 0x73, 0x65,
+  0x5d, 0x2c, 0x20, 0x6c, 0x6f, 0x73, 0x73, 0x52, 0x65, 0x73, 0x75, 0x6c,
+  0x74, 0x73, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x28, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3c, 0x20, 0x32, 0x30, 0x29,
+  0x20, 0x26, 0x26, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3c, 0x20, 0x34,
+  0x29, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e,
+  0x74, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x74, 0x6d, 0x70, 0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72,
+  0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x34, 0x2a, 0x6c, 0x49, 0x64, 0x5d,
+  0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x31,
   0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b,
-  0x34, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x09,
-  0x09, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20, 0x73,
+  0x34, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x31, 0x5d, 0x3b, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x32, 0x20, 0x3d, 0x20, 0x73,
   0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x30, 0x5b, 0x34, 0x2a, 0x6c, 0x49,
-  0x64, 0x2b, 0x33, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x72,
-  0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x5b, 0x31, 0x20, 0x2b, 0x20, 0x34,
-  0x2a, 0x61, 0x64, 0x64, 0x72, 0x20, 0x2b, 0x20, 0x6c, 0x49, 0x64, 0x5d,
-  0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x7d,
-  0x0a, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x7d, 0x20, 0x0a, 0x09, 0x7d,
-  0x20, 0x20, 0x0a, 0x7d, 0x0a
+  0x64, 0x2b, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x6d,
+  0x70, 0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74,
+  0x63, 0x68, 0x30, 0x5b, 0x34, 0x2a, 0x6c, 0x49, 0x64, 0x2b, 0x33, 0x5d,
+  0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c,
+  0x74, 0x73, 0x5b, 0x31, 0x20, 0x2b, 0x20, 0x34, 0x2a, 0x61, 0x64, 0x64,
+  0x72, 0x20, 0x2b, 0x20, 0x6c, 0x49, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x74,
+  0x6d, 0x70, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09,
+  0x0a, 0x09, 0x09, 0x7d, 0x20, 0x0a, 0x09, 0x7d, 0x20, 0x20, 0x0a, 0x7d,
+  0x0a
 };
-unsigned int __equihash_125_4_cl_len = 34061;
+unsigned int __equihash_125_4_cl_len = 37105;
@@ -4,6 +4,8 @@
 
 #include "zelStratum.h"
 #include "clHost.h"
+#include "cpuHost.h"
+#include "metricsServer.h"
 
 inline vector<string> &split(const string &s, char delim, vector<string> &elems) {
     stringstream ss(s);
@@ -20,7 +22,7 @@ inline vector<string> split(const string &s, char delim) {
     return split(s, delim, elems);
 }
 
-uint32_t cmdParser(vector<string> args, string &host, string &port, string &user, string &pass, bool &debug, bool &cpuMine, vector<int32_t> &devices) {
+uint32_t cmdParser(vector<string> args, string &host, string &port, string &user, string &pass, bool &debug, bool &cpuMine, bool &force3G, bool &hostIndexes, int32_t &cpuThreads, zelMiner::collisionMode &collision, bool &autotune, bool &profile, bool &lossStats, bool &benchmark, zelMiner::benchmarkSettings &bench, int32_t &metricsPort, vector<int32_t> &devices) {
 	bool hostSet = false;
 	bool apiSet = false;
 
@@ -72,10 +74,116 @@ uint32_t cmdParser(vector<string> args, string &host, string &port, string &user
 				}
 			}
 
+			if (args[i].compare("--cpu-threads")  == 0) {
+				if (i+1 < args.size()) {
+					cpuThreads = stoi(args[i+1]);
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--collision")  == 0) {
+				if (i+1 < args.size()) {
+					if (args[i+1].compare("list") == 0) collision = zelMiner::collisionList;
+					if (args[i+1].compare("sort") == 0) collision = zelMiner::collisionSort;
+					if (args[i+1].compare("auto") == 0) collision = zelMiner::collisionAuto;
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--autotune")  == 0) {
+				autotune = true;
+			}
+
+			if (args[i].compare("--profile")  == 0) {
+				profile = true;
+			}
+
+			if (args[i].compare("--loss-stats")  == 0) {
+				lossStats = true;
+			}
+
+			if (args[i].compare("--benchmark")  == 0) {
+				benchmark = true;
+			}
+
+			if (args[i].compare("--bench-iterations")  == 0) {
+				if (i+1 < args.size()) {
+					bench.iterations = stoul(args[i+1]);
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--bench-seconds")  == 0) {
+				if (i+1 < args.size()) {
+					bench.seconds = stod(args[i+1]);
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--bench-seed")  == 0) {
+				if (i+1 < args.size()) {
+					bench.seed = stoull(args[i+1]);
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--bench-header")  == 0) {
+				if (i+1 < args.size()) {
+					bench.header = args[i+1];
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--bench-nonce")  == 0) {
+				if (i+1 < args.size()) {
+					bench.startNonce = stoul(args[i+1]);
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--bench-verify")  == 0) {
+				if (i+1 < args.size()) {
+					bench.verify = stoul(args[i+1]);
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--bench-json")  == 0) {
+				if (i+1 < args.size()) {
+					bench.jsonFile = args[i+1];
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--metrics")  == 0) {
+				if (i+1 < args.size()) {
+					metricsPort = stoi(args[i+1]);
+					i++;
+					continue;
+				}
+			}
+
 			if (args[i].compare("--enable-cpu")  == 0) {
 				cpuMine = true;
 			}
 
+			if (args[i].compare("--force-3g")  == 0) {
+				force3G = true;
+			}
+
+			if (args[i].compare("--host-indexes")  == 0) {
+				hostIndexes = true;
+			}
+
 			if (args[i].compare("--debug")  == 0) {
 				debug = true;
 			}
@@ -88,8 +196,11 @@ uint32_t cmdParser(vector<string> args, string &host, string &port, string &user
 	}
 
 	uint32_t result = 0;
-	if (!hostSet) result += 1;
-	if (!apiSet) result += 2;
+	if (!hostSet && !benchmark) result += 1;
+	if (!apiSet && !benchmark) result += 2;
+
+	// Without a limit the benchmark runs a fixed number of iterations
+	if ((bench.iterations == 0) && (bench.seconds <= 0)) bench.iterations = 200;
 
 	if (devices.size() == 0) devices.assign(1,-1);
 	sort(devices.begin(), devices.end());
@@ -109,10 +220,20 @@ int main(int argc, char* argv[]) {
 
 	bool debug = false;
 	bool cpuMine = false;
+	bool force3G = false;
+	bool hostIndexes = false;
 	bool useTLS = true;
+	int32_t cpuThreads = -1;
+	zelMiner::collisionMode collision = zelMiner::collisionList;
+	bool autotune = false;
+	bool profile = false;
+	bool lossStats = false;
+	bool benchmark = false;
+	zelMiner::benchmarkSettings bench;
+	int32_t metricsPort = -1;
 	vector<int32_t> devices;
 
-	uint32_t parsing = cmdParser(cmdLineArgs, host, port, user, pass, debug, cpuMine, devices);
+	uint32_t parsing = cmdParser(cmdLineArgs, host, port, user, pass, debug, cpuMine, force3G, hostIndexes, cpuThreads, collision, autotune, profile, lossStats, benchmark, bench, metricsPort, devices);
 
 	cout << "-====================================-" << endl;
 	cout << "          ZelHash OpenCL miner        " << endl;
@@ -135,6 +256,22 @@ int main(int argc, char* argv[]) {
 		cout << " --pass <password>		A password for pool login if required (optional)" << endl;
 		cout << " --devices <numbers>		A comma seperated list of devices that should be used for mining (default: all in system)" << endl; 
 		cout << " --enable-cpu			Enable mining on OpenCL CPU devices" << endl;
+		cout << " --force-3g			Use the low memory kernel on all devices, it is picked automatically below 4 GB" << endl;
+		cout << " --host-indexes			Keep the round 0 indexes in pinned host memory to save about 280 MByte of device memory" << endl;
+		cout << " --cpu-threads <number>		Enable the native CPU solver with this many threads (0: all cores)" << endl;
+		cout << " --collision <list|sort|auto>	Collision search strategy, auto times both on each device (default: list)" << endl;
+		cout << " --autotune			Tune the kernel parameters of each device and store them in zelMiner-tuning.json" << endl;
+		cout << " --profile			Times every kernel and prints percentiles and memory bandwidth with the statistics" << endl;
+		cout << " --loss-stats			Uses an instrumented kernel that counts the elements and solutions dropped on the GPU" << endl;
+		cout << " --metrics <port>		Serves Prometheus metrics on http://<host>:<port>/metrics" << endl;
+		cout << " --benchmark			Mines an offline job without pool and prints the results as JSON" << endl;
+		cout << " --bench-iterations <number>	Iterations per device in the benchmark (default: 200)" << endl;
+		cout << " --bench-seconds <number>	Run the benchmark for this time instead of a number of iterations" << endl;
+		cout << " --bench-seed <number>		Seed of the benchmark header (default: 0)" << endl;
+		cout << " --bench-header <hex>		Fixed 108 byte benchmark header instead of a seeded one" << endl;
+		cout << " --bench-nonce <number>		First nonce of the benchmark (default: 0)" << endl;
+		cout << " --bench-json <file>		Also write the benchmark result to this file" << endl;
+		cout << " --bench-verify <number>	Check the solutions of the first iterations with the CPU solver" << endl;
 		cout << " --version			Prints the version number" << endl;
 		exit(0);
 	}
@@ -147,12 +284,53 @@ int main(int argc, char* argv[]) {
 	cout << "Setup OpenCL devices:" << endl;
 	cout << "=====================" << endl;
 	
-	myClHost.setup(&myStratum, devices, cpuMine, false);
+	bool useGPUs = myClHost.setup(&myStratum, devices, cpuMine, force3G, hostIndexes, collision, autotune, profile, lossStats);
+
+	if (benchmark) {
+		if (!useGPUs) {
+			cout << "No compatible OpenCL devices found or all are deselected. Closing zelMiner." << endl;
+			exit(0);
+		}
+
+		if (!myStratum.setOfflineJob(bench.seed, bench.header, bench.startNonce)) {
+			cout << "Error: The benchmark header must be 108 bytes of hex" << endl;
+			exit(0);
+		}
+
+		cout << endl;
+		cout << "Benchmark:" << endl;
+		cout << "==========" << endl;
+
+		exit(myClHost.benchmark(bench) ? 0 : 1);
+	}
+
+	if (!useGPUs && (cpuThreads < 0)) {
+		cout << "No compatible OpenCL devices found or all are deselected. Closing zelMiner." << endl;
+		exit(0);
+	}
+
+	zelMiner::cpuHost myCpuHost;
+
+	if (cpuThreads >= 0) {
+		cout << endl;
+		cout << "Setup native CPU solver:" << endl;
+		cout << "========================" << endl;
+
+		myCpuHost.setup(&myStratum, cpuThreads, collision);
+	}
 
 	cout << endl;
 	cout << "Waiting for work from stratum:" << endl;
 	cout << "==============================" << endl;
 
+	// The metrics are served by the stratum thread
+	zelMiner::metricsServer metrics(myStratum.ioService());
+	if (metricsPort >= 0) {
+		metrics.addSource([&myStratum](stringstream &ss) { myStratum.writeMetrics(ss); });
+		if (useGPUs) metrics.addSource([&myClHost](stringstream &ss) { myClHost.writeMetrics(ss); });
+		metrics.start(metricsPort);
+	}
+
 	myStratum.startWorking();
 
 	while (!myStratum.hasWork()) {
@@ -162,7 +340,13 @@ int main(int argc, char* argv[]) {
 	cout << endl;
 	cout << "Start mining:" << endl;
 	cout << "=============" << endl;
-	myClHost.startMining();
+
+	if (useGPUs) {
+		if (cpuThreads >= 0) thread(&zelMiner::cpuHost::startMining, &myCpuHost).detach();
+		myClHost.startMining();
+	} else {
+		myCpuHost.startMining();
+	}
 }
 
 #if defined(_MSC_VER) && (_MSC_VER >= 1900)
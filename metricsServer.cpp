@@ -0,0 +1,79 @@
+// ZelHash OpenCL Miner
+// HTTP Endpoint for Prometheus Metrics
+
+#include "metricsServer.h"
+
+#include <iostream>
+
+namespace zelMiner {
+
+void metricsServer::addSource(function<void(stringstream&)> source) {
+	sources.push_back(source);
+}
+
+
+bool metricsServer::start(uint16_t port) {
+	try {
+		acceptor.reset(new tcp::acceptor(io_service, tcp::endpoint(tcp::v4(), port)));
+	} catch (const boost::system::system_error &e) {
+		cout << "Could not open metrics port " << port << ": " << e.what() << endl;
+		return false;
+	}
+
+	cout << "Metrics available on http://0.0.0.0:" << port << "/metrics" << endl;
+	accept();
+	return true;
+}
+
+
+void metricsServer::accept() {
+	shared_ptr<connection> conn = make_shared<connection>(io_service);
+	acceptor->async_accept(conn->socket, [this, conn](const boost::system::error_code &err) { handleAccept(conn, err); });
+}
+
+
+void metricsServer::handleAccept(shared_ptr<connection> conn, const boost::system::error_code &err) {
+	if (!err) {
+		boost::asio::async_read_until(conn->socket, conn->request, "\r\n\r\n",
+			[this, conn](const boost::system::error_code &err, size_t) { handleRequest(conn, err); });
+	}
+
+	accept();
+}
+
+
+// Only the request line matters, every response closes the connection
+void metricsServer::handleRequest(shared_ptr<connection> conn, const boost::system::error_code &err) {
+	if (err) return;
+
+	std::istream is(&conn->request);
+	string method, path;
+	is >> method >> path;
+
+	stringstream body;
+	string status = "200 OK";
+
+	if ((method.compare("GET") == 0) && ((path.compare("/metrics") == 0) || (path.compare("/") == 0))) {
+		for (uint32_t i=0; i<sources.size(); i++) sources[i](body);
+	} else {
+		status = "404 Not Found";
+		body << "Not found\n";
+	}
+
+	string text = body.str();
+	stringstream ss;
+	ss << "HTTP/1.1 " << status << "\r\n";
+	ss << "Content-Type: text/plain; version=0.0.4\r\n";
+	ss << "Content-Length: " << text.size() << "\r\n";
+	ss << "Connection: close\r\n\r\n";
+	ss << text;
+	conn->response = ss.str();
+
+	boost::asio::async_write(conn->socket, boost::asio::buffer(conn->response),
+		[conn](const boost::system::error_code &, size_t) {
+			boost::system::error_code ignored;
+			conn->socket.shutdown(tcp::socket::shutdown_both, ignored);
+		});
+}
+
+}
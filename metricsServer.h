@@ -0,0 +1,70 @@
+// ZelHash OpenCL Miner
+// HTTP Endpoint for Prometheus Metrics
+// Copyright 2019 Wilke Trei
+
+#ifndef zelMinerMetricsServer_H
+#define zelMinerMetricsServer_H
+
+#include <string>
+#include <sstream>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <cstdint>
+
+#include <boost/asio.hpp>
+
+using namespace std;
+using boost::asio::ip::tcp;
+
+namespace zelMiner {
+
+// Serves GET /metrics in the Prometheus text format. The server only queues its work
+// on the given io_service, the handlers run on the thread that runs the io_service.
+// Every source appends its metrics to the response, sources must be thread safe.
+class metricsServer {
+	private:
+	boost::asio::io_service &io_service;
+	unique_ptr<tcp::acceptor> acceptor;
+	vector< function<void(stringstream&)> > sources;
+
+	struct connection {
+		tcp::socket socket;
+		boost::asio::streambuf request;
+		string response;
+
+		connection(boost::asio::io_service &io) : socket(io) { }
+	};
+
+	void accept();
+	void handleAccept(shared_ptr<connection>, const boost::system::error_code&);
+	void handleRequest(shared_ptr<connection>, const boost::system::error_code&);
+
+	public:
+	metricsServer(boost::asio::io_service &io) : io_service(io) { }
+
+	void addSource(function<void(stringstream&)>);
+	bool start(uint16_t);
+};
+
+
+// Writes the HELP and TYPE lines of a metric
+inline void metricHeader(stringstream &ss, const char* name, const char* type, const char* help) {
+	ss << "# HELP " << name << " " << help << "\n";
+	ss << "# TYPE " << name << " " << type << "\n";
+}
+
+
+// Escapes a label value, device names may contain anything
+inline string metricLabel(const string &value) {
+	string result;
+	for (uint32_t i=0; i<value.size(); i++) {
+		if ((value[i] == '"') || (value[i] == '\\')) result.push_back('\\');
+		if ((uint8_t) value[i] >= 0x20) result.push_back(value[i]);
+	}
+	return result;
+}
+
+}
+
+#endif
@@ -0,0 +1,53 @@
+// ZelHash OpenCL Miner
+// Worker Pool for Solution Validation and Submission
+
+#include "solutionQueue.h"
+
+#include <cstring>
+
+namespace zelMiner {
+
+void solutionQueue::start(zelStratum* stratumIn, uint32_t count) {
+	stratum = stratumIn;
+	nextWorker = 0;
+
+	for (uint32_t i=0; i<count; i++) {
+		workers.push_back(unique_ptr<worker>(new worker()));
+		thread(&solutionQueue::run, this, workers.back().get()).detach();
+	}
+}
+
+
+// Called from the OpenCL callbacks, only copies the solution and wakes a worker
+void solutionQueue::submit(const zelStratum::WorkDescription &wd, const uint32_t* indexes) {
+	solutionJob job;
+	job.wd = wd;
+	memcpy(job.indexes, indexes, sizeof(job.indexes));
+
+	worker* w = workers[nextWorker.fetch_add(1, memory_order_relaxed) % workers.size()].get();
+	w->queue.push(job);
+
+	// The worker tests for new jobs while it holds the mutex, so taking it here after
+	// the push orders the notify behind that test and no wake up gets lost
+	{
+		lock_guard<mutex> lock(w->sleepMutex);
+	}
+	w->wakeUp.notify_one();
+}
+
+
+void solutionQueue::run(worker* w) {
+	solutionJob job;
+
+	while (true) {
+		if (w->queue.pop(job)) {
+			stratum->handleSolution(job.wd, job.indexes);
+			continue;
+		}
+
+		unique_lock<mutex> lock(w->sleepMutex);
+		w->wakeUp.wait(lock, [w] { return !w->queue.empty(); });
+	}
+}
+
+}
@@ -0,0 +1,100 @@
+// ZelHash OpenCL Miner
+// Worker Pool for Solution Validation and Submission
+// Copyright 2019 Wilke Trei
+
+#ifndef zelMinerSolutionQueue_H
+#define zelMinerSolutionQueue_H
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+#include "zelStratum.h"
+
+namespace zelMiner {
+
+// Lock free multi producer, single consumer queue. Producers only do one atomic
+// exchange, so they never wait for each other or for the consumer.
+template<typename T> class mpscQueue {
+	private:
+	struct node {
+		atomic<node*> next;
+		T value;
+	};
+
+	atomic<node*> head;		// Producers append here
+	node* tail;			// Consumer side, always points to an already consumed node
+
+	public:
+	mpscQueue() {
+		tail = new node();
+		tail->next.store(NULL, memory_order_relaxed);
+		head.store(tail, memory_order_relaxed);
+	}
+
+	~mpscQueue() {
+		T value;
+		while (pop(value));
+		delete tail;
+	}
+
+	void push(const T &value) {
+		node* n = new node();
+		n->value = value;
+		n->next.store(NULL, memory_order_relaxed);
+
+		node* prev = head.exchange(n, memory_order_acq_rel);
+		prev->next.store(n, memory_order_release);
+	}
+
+	// Consumer only, false while a producer has not finished its push yet
+	bool empty() const {
+		return (tail->next.load(memory_order_acquire) == NULL);
+	}
+
+	// Returns false if the queue is empty or a producer has not finished its push yet
+	bool pop(T &value) {
+		node* next = tail->next.load(memory_order_acquire);
+		if (next == NULL) return false;
+
+		value = next->value;
+		delete tail;
+		tail = next;
+		return true;
+	}
+};
+
+
+// Solutions are handed from the OpenCL callbacks to a few validation workers, each
+// worker owns one queue and the producers distribute the solutions round robin
+class solutionQueue {
+	private:
+	struct solutionJob {
+		zelStratum::WorkDescription wd;
+		uint32_t indexes[16];
+	};
+
+	struct worker {
+		mpscQueue<solutionJob> queue;
+		mutex sleepMutex;
+		condition_variable wakeUp;
+	};
+
+	vector< unique_ptr<worker> > workers;
+	atomic<uint32_t> nextWorker;
+
+	zelStratum* stratum;
+
+	void run(worker*);
+
+	public:
+	void start(zelStratum*, uint32_t);
+	void submit(const zelStratum::WorkDescription&, const uint32_t*);
+};
+
+}
+
+#endif
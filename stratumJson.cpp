@@ -0,0 +1,266 @@
+// ZelHash OpenCL Miner
+// Zero Copy JSON Reader for Stratum Messages
+
+#include "stratumJson.h"
+
+namespace zelMiner {
+
+// Nesting deeper than this is not a stratum message
+static const uint32_t maxDepth = 16;
+
+static const jsonValue missingValue;
+
+struct jsonCursor {
+	const char* pos;
+	const char* end;
+
+	void skipSpace() {
+		while ((pos < end) && ((*pos == ' ') || (*pos == '\t') || (*pos == '\r') || (*pos == '\n'))) pos++;
+	}
+
+	bool take(char c) {
+		skipSpace();
+		if ((pos < end) && (*pos == c)) {
+			pos++;
+			return true;
+		}
+		return false;
+	}
+};
+
+
+static bool readValue(jsonCursor &cur, jsonValue &value, uint32_t depth);
+
+
+static bool readString(jsonCursor &cur, string_view &text) {
+	if (!cur.take('"')) return false;
+
+	const char* start = cur.pos;
+	while (cur.pos < cur.end) {
+		if (*cur.pos == '\\') {
+			cur.pos += 2;
+			continue;
+		}
+		if (*cur.pos == '"') {
+			text = string_view(start, cur.pos - start);
+			cur.pos++;
+			return true;
+		}
+		cur.pos++;
+	}
+	return false;
+}
+
+
+static bool readLiteral(jsonCursor &cur, const char* literal, uint32_t len) {
+	if ((uint32_t) (cur.end - cur.pos) < len) return false;
+	if (string_view(cur.pos, len).compare(string_view(literal, len)) != 0) return false;
+	cur.pos += len;
+	return true;
+}
+
+
+// Reads the elements of an array (items may be NULL to only skip it)
+static bool readArray(jsonCursor &cur, jsonValue* items, uint32_t maxItems, uint32_t &count, uint32_t depth) {
+	count = 0;
+	if (!cur.take('[')) return false;
+	if (cur.take(']')) return true;
+
+	do {
+		jsonValue item;
+		if (!readValue(cur, item, depth+1)) return false;
+		if ((items != NULL) && (count < maxItems)) items[count] = item;
+		count++;
+	} while (cur.take(','));
+
+	if (items != NULL) count = (count < maxItems) ? count : maxItems;
+	return cur.take(']');
+}
+
+
+static bool readObject(jsonCursor &cur, uint32_t depth) {
+	if (!cur.take('{')) return false;
+	if (cur.take('}')) return true;
+
+	do {
+		string_view key;
+		jsonValue member;
+		if (!readString(cur, key) || !cur.take(':')) return false;
+		if (!readValue(cur, member, depth+1)) return false;
+	} while (cur.take(','));
+
+	return cur.take('}');
+}
+
+
+static bool readValue(jsonCursor &cur, jsonValue &value, uint32_t depth) {
+	if (depth > maxDepth) return false;
+
+	cur.skipSpace();
+	if (cur.pos >= cur.end) return false;
+
+	const char* start = cur.pos;
+	uint32_t count;
+
+	switch (*cur.pos) {
+		case '"':
+			value.type = jsonString;
+			return readString(cur, value.text);
+		case '[':
+			value.type = jsonArray;
+			if (!readArray(cur, NULL, 0, count, depth)) return false;
+			break;
+		case '{':
+			value.type = jsonObject;
+			if (!readObject(cur, depth)) return false;
+			break;
+		case 't':
+			value.type = jsonBool;
+			if (!readLiteral(cur, "true", 4)) return false;
+			break;
+		case 'f':
+			value.type = jsonBool;
+			if (!readLiteral(cur, "false", 5)) return false;
+			break;
+		case 'n':
+			value.type = jsonNull;
+			if (!readLiteral(cur, "null", 4)) return false;
+			break;
+		default:
+			value.type = jsonNumber;
+			while ((cur.pos < cur.end) && (((*cur.pos >= '0') && (*cur.pos <= '9')) || (*cur.pos == '-') 
+			       || (*cur.pos == '+') || (*cur.pos == '.') || (*cur.pos == 'e') || (*cur.pos == 'E'))) cur.pos++;
+			if (cur.pos == start) return false;
+	}
+
+	value.text = string_view(start, cur.pos - start);
+	return true;
+}
+
+
+// Member names are compared like the case insensitive property tree did before
+static bool keyIs(string_view key, const char* name) {
+	uint32_t i = 0;
+	for (; i<key.size(); i++) {
+		if (name[i] == 0) return false;
+		char c = key[i];
+		if ((c >= 'A') && (c <= 'Z')) c += 'a' - 'A';
+		if (c != name[i]) return false;
+	}
+	return (name[i] == 0);
+}
+
+
+bool jsonValue::isTrue() const {
+	return (type == jsonBool) && (text[0] == 't');
+}
+
+
+// Numbers and numeric strings, the fallback for everything else
+int64_t jsonValue::asInt(int64_t fallback) const {
+	if (((type != jsonNumber) && (type != jsonString)) || (text.size() == 0)) return fallback;
+
+	uint32_t i = 0;
+	bool negative = (text[0] == '-');
+	if (negative) i++;
+	if (i == text.size()) return fallback;
+
+	int64_t result = 0;
+	for (; i<text.size(); i++) {
+		if ((text[i] < '0') || (text[i] > '9')) return fallback;
+		result = 10*result + (text[i] - '0');
+	}
+	return negative ? -result : result;
+}
+
+
+bool stratumMessage::parse(string_view line) {
+	id = -1;
+	method = string_view();
+	result = jsonValue();
+	error = jsonValue();
+	paramCount = 0;
+	resultCount = 0;
+	errorCount = 0;
+
+	jsonCursor cur = {line.data(), line.data() + line.size()};
+	if (!cur.take('{')) return false;
+
+	if (!cur.take('}')) {
+		do {
+			string_view key;
+			jsonValue member;
+			const char* valueStart;
+
+			if (!readString(cur, key) || !cur.take(':')) return false;
+			cur.skipSpace();
+			valueStart = cur.pos;
+			if (!readValue(cur, member, 1)) return false;
+
+			if (keyIs(key, "id")) id = member.asInt(-1);
+			if (keyIs(key, "method") && (member.type == jsonString)) method = member.text;
+			if (keyIs(key, "error")) {
+				error = member;
+				if (member.type == jsonArray) {
+					jsonCursor items = {valueStart, cur.pos};
+					readArray(items, errorItems, maxItems, errorCount, 1);
+				}
+			}
+
+			if (keyIs(key, "result")) {
+				result = member;
+				if (member.type == jsonArray) {
+					jsonCursor items = {valueStart, cur.pos};
+					readArray(items, resultItems, maxItems, resultCount, 1);
+				}
+			}
+
+			if (keyIs(key, "params") && (member.type == jsonArray)) {
+				jsonCursor items = {valueStart, cur.pos};
+				readArray(items, params, maxItems, paramCount, 1);
+			}
+		} while (cur.take(','));
+
+		if (!cur.take('}')) return false;
+	}
+
+	return true;
+}
+
+
+const jsonValue& stratumMessage::param(uint32_t i) const {
+	return (i < paramCount) ? params[i] : missingValue;
+}
+
+
+const jsonValue& stratumMessage::resultItem(uint32_t i) const {
+	return (i < resultCount) ? resultItems[i] : missingValue;
+}
+
+
+const jsonValue& stratumMessage::errorItem(uint32_t i) const {
+	return (i < errorCount) ? errorItems[i] : missingValue;
+}
+
+
+static inline int32_t hexValue(char c) {
+	if ((c >= '0') && (c <= '9')) return c - '0';
+	if ((c >= 'a') && (c <= 'f')) return c - 'a' + 10;
+	if ((c >= 'A') && (c <= 'F')) return c - 'A' + 10;
+	return -1;
+}
+
+
+bool appendHex(string_view hex, vector<uint8_t> &out) {
+	if ((hex.size() & 1) != 0) return false;
+
+	for (size_t i = 0; i < hex.size(); i += 2) {
+		int32_t hi = hexValue(hex[i]);
+		int32_t lo = hexValue(hex[i+1]);
+		if ((hi < 0) || (lo < 0)) return false;
+		out.push_back((uint8_t) ((hi << 4) | lo));
+	}
+	return true;
+}
+
+}
@@ -0,0 +1,64 @@
+// ZelHash OpenCL Miner
+// Zero Copy JSON Reader for Stratum Messages
+// Copyright 2019 Wilke Trei
+
+#ifndef zelMinerStratumJson_H
+#define zelMinerStratumJson_H
+
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+
+namespace zelMiner {
+
+enum jsonType { jsonMissing, jsonNull, jsonBool, jsonNumber, jsonString, jsonArray, jsonObject };
+
+// One value of a message. The text points into the parsed line, strings are given
+// without quotes and escapes are not decoded (stratum only sends hex and ids).
+struct jsonValue {
+	jsonType type = jsonMissing;
+	string_view text;
+
+	bool isTrue() const;
+	int64_t asInt(int64_t) const;
+};
+
+
+// Reads the members of a stratum message that the miner handles: id, method, result,
+// error and the elements of the params, result and error arrays. Nothing is copied or
+// allocated, the line must stay valid while the message is used.
+class stratumMessage {
+	public:
+	static const uint32_t maxItems = 16;
+
+	int64_t id;
+	string_view method;
+	jsonValue result;
+	jsonValue error;
+
+	jsonValue params[maxItems];
+	uint32_t paramCount;
+
+	jsonValue resultItems[maxItems];		// Only if result is an array
+	uint32_t resultCount;
+
+	jsonValue errorItems[maxItems];			// [code, message, traceback]
+	uint32_t errorCount;
+
+	bool parse(string_view);
+
+	// Elements of an array value, empty values beyond the end
+	const jsonValue& param(uint32_t i) const;
+	const jsonValue& resultItem(uint32_t i) const;
+	const jsonValue& errorItem(uint32_t i) const;
+};
+
+
+// Appends the bytes of a hex string, false if it contains anything else
+bool appendHex(string_view, vector<uint8_t> &);
+
+}
+
+#endif
@@ -0,0 +1,589 @@
+// ZelHash OpenCL Miner
+// Mock Stratum Pool for Local End to End Tests
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <set>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+
+#include <boost/asio.hpp>
+
+#include "../stratumJson.h"
+#include "../equihashVerify.h"
+#include "../crypto/sha256.c"
+
+using namespace std;
+using boost::asio::ip::tcp;
+
+namespace zelMiner {
+
+typedef std::chrono::steady_clock poolClock;
+
+static double msSince(poolClock::time_point start) {
+	return std::chrono::duration<double, std::milli>(poolClock::now() - start).count();
+}
+
+
+struct poolSettings {
+	uint16_t port = 3333;
+	string target = "7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff";
+	string poolNonce = "a1b2c3d4";
+	uint64_t seed = 1;
+	vector<string> script;
+	uint32_t reportInterval = 30;			// Seconds, 0 only reports at the end
+};
+
+
+struct poolJob {
+	string id;
+	vector<uint8_t> header;				// The 108 bytes the miner puts together from the notify
+	uint32_t epoch;					// Clean jobs before and including this one
+	poolClock::time_point notifyTime;
+	bool sent = false;				// A miner was connected when the job went out
+	bool shared = false;
+	set<string> submitted;
+};
+
+
+struct poolSession {
+	tcp::socket socket;
+	mutex writeMutex;
+	bool authorized = false;
+	bool shared = false;
+	poolClock::time_point authorizeTime;
+
+	poolSession(boost::asio::io_service &io) : socket(io) { }
+};
+
+
+struct poolStats {
+	uint32_t connections = 0;
+	uint32_t jobs = 0;
+	uint32_t cleanJobs = 0;
+	uint64_t submitted = 0;
+	uint64_t accepted = 0;
+	uint64_t stale = 0;
+	uint64_t invalid = 0;
+	uint64_t aboveTarget = 0;
+	uint64_t duplicate = 0;
+
+	vector<double> firstShareMs;			// Authorize to the first accepted share of a connection
+	vector<double> notifyShareMs;			// Notify to the first accepted share of a job
+	vector<double> reconnectMs;			// Disconnect to the next subscribe
+};
+
+
+// Reads the 16 indices of 26 bit each from the 52 byte minimal encoding
+static void expandSolution(const uint8_t* in, uint32_t* indices) {
+	uint64_t acc = 0;
+	uint32_t accBits = 0;
+	uint32_t pos = 0;
+
+	for (uint32_t i=0; i<16; i++) {
+		while (accBits < 26) {
+			acc = (acc << 8) | in[pos++];
+			accBits += 8;
+		}
+		accBits -= 26;
+		indices[i] = (acc >> accBits) & 0x3FFFFFF;
+	}
+}
+
+
+static string toHex(const uint8_t* data, size_t len) {
+	static const char hexDigits[] = "0123456789abcdef";
+	string out;
+	for (size_t c=0; c<len; c++) {
+		out.push_back(hexDigits[data[c] >> 4]);
+		out.push_back(hexDigits[data[c] & 0xF]);
+	}
+	return out;
+}
+
+
+static void printTimes(const char* name, vector<double> times) {
+	if (times.size() == 0) return;
+
+	sort(times.begin(), times.end());
+	cout << "   " << name << ": p50 " << times[(times.size()-1) / 2] << " ms, p90 " << times[(uint32_t) (0.9 * (times.size()-1) + 0.5)]
+	     << " ms, max " << times.back() << " ms (" << times.size() << ")" << endl;
+}
+
+
+class mockPool {
+	private:
+	poolSettings settings;
+	boost::asio::io_service io;
+
+	mutex poolMutex;				// Everything below
+	vector< shared_ptr<poolSession> > sessions;
+	map<string, poolJob> jobs;
+	deque<string> jobOrder;
+	string currentJob;
+	uint32_t epoch = 0;
+	vector<uint8_t> target;
+	vector<uint8_t> poolNonce;
+	uint32_t responseDelay = 0;			// Milliseconds before each reply
+	bool disconnected = false;
+	poolClock::time_point disconnectTime;
+	poolStats stats;
+	mt19937_64 generator;
+
+	static const uint32_t jobHistory = 64;
+
+	void send(poolSession &, const string &);
+	void broadcast(const string &);
+	string notifyMessage(const poolJob &, bool);
+	string targetMessage();
+
+	void newJob(bool);
+	void disconnectAll();
+	void runScript();
+
+	void serve(shared_ptr<poolSession>);
+	void handleSubmit(poolSession &, const stratumMessage &);
+	string checkShare(poolJob &, const stratumMessage &);
+
+	public:
+	bool setup(const poolSettings &);
+	void run();
+	void report();
+};
+
+
+bool mockPool::setup(const poolSettings &settingsIn) {
+	settings = settingsIn;
+	generator.seed(settings.seed);
+
+	if (!appendHex(settings.target, target) || (target.size() != 32)) return false;
+	if (!appendHex(settings.poolNonce, poolNonce) || (poolNonce.size() > 28)) return false;
+	return true;
+}
+
+
+void mockPool::send(poolSession &session, const string &line) {
+	lock_guard<mutex> lock(session.writeMutex);
+	boost::system::error_code err;
+	boost::asio::write(session.socket, boost::asio::buffer(line), err);
+}
+
+
+// Must be called with the pool mutex held
+void mockPool::broadcast(const string &line) {
+	for (uint32_t i=0; i<sessions.size(); i++) {
+		if (sessions[i]->authorized) send(*sessions[i], line);
+	}
+}
+
+
+string mockPool::notifyMessage(const poolJob &job, bool clean) {
+	const uint8_t* h = job.header.data();
+	stringstream ss;
+	ss << "{\"id\":null,\"method\":\"mining.notify\",\"params\":[\"" << job.id << "\",\"" << toHex(h, 4) << "\",\""
+	   << toHex(&h[4], 32) << "\",\"" << toHex(&h[36], 32) << "\",\"" << toHex(&h[68], 32) << "\",\""
+	   << toHex(&h[100], 4) << "\",\"" << toHex(&h[104], 4) << "\"," << (clean ? "true" : "false") << ",\"ZelProof\"]}\n";
+	return ss.str();
+}
+
+
+string mockPool::targetMessage() {
+	return "{\"id\":null,\"method\":\"mining.set_target\",\"params\":[\"" + toHex(target.data(), 32) + "\"]}\n";
+}
+
+
+// Must be called with the pool mutex held
+void mockPool::newJob(bool clean) {
+	poolJob job;
+	stringstream ss;
+	ss << hex << ++stats.jobs;
+	job.id = ss.str();
+
+	// Version 4, random previous block, merkle root and reserved hash, current time and fixed bits
+	job.header.assign(108, (uint8_t) 0);
+	job.header[0] = 4;
+	for (uint32_t i=4; i<100; i++) job.header[i] = (uint8_t) generator();
+	uint32_t now = (uint32_t) time(NULL);
+	memcpy(&job.header[100], &now, 4);
+	job.header[104] = 0xff; job.header[105] = 0xff; job.header[106] = 0x0f; job.header[107] = 0x1f;
+
+	if (clean) {
+		epoch++;
+		stats.cleanJobs++;
+	}
+	job.epoch = epoch;
+	job.notifyTime = poolClock::now();
+
+	currentJob = job.id;
+	jobs[job.id] = job;
+	jobOrder.push_back(job.id);
+	if (jobOrder.size() > jobHistory) {
+		jobs.erase(jobOrder.front());
+		jobOrder.pop_front();
+	}
+
+	jobs[job.id].sent = (sessions.size() > 0);
+	broadcast(notifyMessage(jobs[job.id], clean));
+	cout << "Job " << job.id << (clean ? " (clean)" : "") << " sent to " << sessions.size() << " connections" << endl;
+}
+
+
+// The miners see a lost connection and reconnect on their own
+void mockPool::disconnectAll() {
+	lock_guard<mutex> lock(poolMutex);
+	for (uint32_t i=0; i<sessions.size(); i++) {
+		boost::system::error_code err;
+		sessions[i]->socket.shutdown(tcp::socket::shutdown_both, err);
+	}
+
+	if (sessions.size() > 0) {
+		disconnected = true;
+		disconnectTime = poolClock::now();
+	}
+	cout << "Closed " << sessions.size() << " connections" << endl;
+}
+
+
+// Runs the commands of the script, one per line:
+//   notify [clean]	send a new job
+//   target <hex>	send a new target
+//   wait <ms>		pause the script
+//   delay <ms>		wait this long before every reply from now on
+//   disconnect		close all connections
+//   report		print the statistics
+//   repeat		start the script again
+//   stop		print the statistics and quit
+void mockPool::runScript() {
+	poolClock::time_point lastReport = poolClock::now();
+
+	for (uint32_t line=0; line<settings.script.size(); line++) {
+		istringstream cmd(settings.script[line]);
+		string op, arg;
+		cmd >> op >> arg;
+
+		if ((op.size() == 0) || (op[0] == '#')) continue;
+
+		if (op.compare("notify") == 0) {
+			lock_guard<mutex> lock(poolMutex);
+			newJob(arg.compare("clean") == 0);
+		} else if (op.compare("target") == 0) {
+			lock_guard<mutex> lock(poolMutex);
+			vector<uint8_t> newTarget;
+			if (appendHex(arg, newTarget) && (newTarget.size() == 32)) {
+				target = newTarget;
+				broadcast(targetMessage());
+			} else {
+				cout << "Script line " << line+1 << ": target needs 64 hex digits" << endl;
+			}
+		} else if (op.compare("wait") == 0) {
+			this_thread::sleep_for(std::chrono::milliseconds(atoi(arg.c_str())));
+		} else if (op.compare("delay") == 0) {
+			lock_guard<mutex> lock(poolMutex);
+			responseDelay = atoi(arg.c_str());
+		} else if (op.compare("disconnect") == 0) {
+			disconnectAll();
+		} else if (op.compare("report") == 0) {
+			report();
+		} else if (op.compare("repeat") == 0) {
+			line = (uint32_t) -1;
+		} else if (op.compare("stop") == 0) {
+			break;
+		} else {
+			cout << "Script line " << line+1 << ": unknown command " << op << endl;
+		}
+
+		if ((settings.reportInterval > 0) && (msSince(lastReport) >= 1000.0 * settings.reportInterval)) {
+			report();
+			lastReport = poolClock::now();
+		}
+	}
+
+	report();
+	exit(0);
+}
+
+
+// Reads the messages of one miner until the connection is closed
+void mockPool::serve(shared_ptr<poolSession> session) {
+	boost::asio::streambuf buffer;
+
+	while (true) {
+		boost::system::error_code err;
+		size_t bytesRead = boost::asio::read_until(session->socket, buffer, "\n", err);
+		if (err) break;
+
+		string line(static_cast<const char*>(buffer.data().data()), bytesRead);
+		buffer.consume(bytesRead);
+
+		stratumMessage msg;
+		if (!msg.parse(line)) {
+			cout << "Could not parse: " << line;
+			continue;
+		}
+
+		uint32_t delay;
+		{
+			lock_guard<mutex> lock(poolMutex);
+			delay = responseDelay;
+		}
+		if (delay > 0) this_thread::sleep_for(std::chrono::milliseconds(delay));
+
+		if (msg.method.compare("mining.subscribe") == 0) {
+			{
+				lock_guard<mutex> lock(poolMutex);
+				if (disconnected) {
+					stats.reconnectMs.push_back(msSince(disconnectTime));
+					disconnected = false;
+				}
+			}
+
+			stringstream ss;
+			ss << "{\"id\":" << msg.id << ",\"result\":[null,\"" << toHex(poolNonce.data(), poolNonce.size()) << "\"],\"error\":null}\n";
+			send(*session, ss.str());
+		}
+
+		// Like most pools the current target and job follow the authorization
+		if (msg.method.compare("mining.authorize") == 0) {
+			stringstream ss;
+			ss << "{\"id\":" << msg.id << ",\"result\":true,\"error\":null}\n";
+			send(*session, ss.str());
+
+			lock_guard<mutex> lock(poolMutex);
+			session->authorized = true;
+			session->authorizeTime = poolClock::now();
+			send(*session, targetMessage());
+			if (jobs.count(currentJob) > 0) send(*session, notifyMessage(jobs[currentJob], true));
+		}
+
+		if (msg.method.compare("mining.submit") == 0) {
+			handleSubmit(*session, msg);
+		}
+	}
+
+	lock_guard<mutex> lock(poolMutex);
+	sessions.erase(remove(sessions.begin(), sessions.end(), session), sessions.end());
+	if (!disconnected) {
+		disconnected = true;
+		disconnectTime = poolClock::now();
+	}
+	cout << "Miner disconnected" << endl;
+}
+
+
+// Returns the reason why a share is rejected, empty if it is good.
+// Must be called with the pool mutex held.
+string mockPool::checkShare(poolJob &job, const stratumMessage &msg) {
+	if (job.epoch != epoch) {
+		stats.stale++;
+		return "stale";
+	}
+
+	string_view nonceHex = msg.param(3).text;
+	string_view solutionHex = msg.param(4).text;
+
+	vector<uint8_t> header = job.header;
+	header.insert(header.end(), poolNonce.begin(), poolNonce.end());
+	vector<uint8_t> solution;
+
+	bool ok = appendHex(nonceHex, header) && (header.size() == 140);
+	ok = ok && appendHex(solutionHex, solution) && (solution.size() == 53) && (solution[0] == 52);
+	if (!ok) {
+		stats.invalid++;
+		return "malformed";
+	}
+
+	string key = string(nonceHex) + string(solutionHex);
+	if (job.submitted.count(key) > 0) {
+		stats.duplicate++;
+		return "duplicate";
+	}
+	job.submitted.insert(key);
+
+	uint32_t indices[16];
+	expandSolution(&solution[1], indices);
+	if (!verifyEquihash(header.data(), indices)) {
+		stats.invalid++;
+		return "invalid solution";
+	}
+
+	// Double SHA-256 of header and solution, compared as a little endian number
+	header.insert(header.end(), solution.begin(), solution.end());
+	uint8_t hash0[32];
+	uint8_t hash1[32];
+	Sha256_Onestep(header.data(), header.size(), hash0);
+	Sha256_Onestep(hash0, 32, hash1);
+
+	for (int32_t i=31; i>=0; i--) {
+		if (hash1[i] != target[31-i]) {
+			if (hash1[i] > target[31-i]) {
+				stats.aboveTarget++;
+				return "above target";
+			}
+			break;
+		}
+	}
+
+	return "";
+}
+
+
+void mockPool::handleSubmit(poolSession &session, const stratumMessage &msg) {
+	string reason;
+	{
+		lock_guard<mutex> lock(poolMutex);
+		stats.submitted++;
+
+		string id(msg.param(1).text);
+		if (jobs.count(id) == 0) {
+			stats.stale++;
+			reason = "unknown job";
+		} else {
+			poolJob &job = jobs[id];
+			reason = checkShare(job, msg);
+
+			if (reason.empty()) {
+				stats.accepted++;
+				if (!job.shared && job.sent) stats.notifyShareMs.push_back(msSince(job.notifyTime));
+				if (!session.shared) stats.firstShareMs.push_back(msSince(session.authorizeTime));
+				job.shared = true;
+				session.shared = true;
+			}
+		}
+	}
+
+	stringstream ss;
+	if (reason.empty()) {
+		ss << "{\"id\":" << msg.id << ",\"result\":true,\"error\":null}\n";
+	} else {
+		ss << "{\"id\":" << msg.id << ",\"result\":false,\"error\":[23,\"" << reason << "\",null]}\n";
+		cout << "Share rejected: " << reason << endl;
+	}
+	send(session, ss.str());
+}
+
+
+void mockPool::report() {
+	lock_guard<mutex> lock(poolMutex);
+	cout << fixed << setprecision(1);
+	cout << "Mock pool statistics:" << endl;
+	cout << "   Connections " << stats.connections << ", jobs " << stats.jobs << " (" << stats.cleanJobs << " clean)" << endl;
+	cout << "   Shares submitted " << stats.submitted << ", accepted " << stats.accepted << ", stale " << stats.stale
+	     << ", invalid " << stats.invalid << ", above target " << stats.aboveTarget << ", duplicate " << stats.duplicate << endl;
+	if (stats.submitted > 0) cout << "   Stale share rate " << 100.0 * stats.stale / stats.submitted << " %" << endl;
+	printTimes("Time to first share", stats.firstShareMs);
+	printTimes("Notify to first share", stats.notifyShareMs);
+	printTimes("Reconnect time", stats.reconnectMs);
+}
+
+
+void mockPool::run() {
+	tcp::acceptor acceptor(io, tcp::endpoint(tcp::v4(), settings.port));
+	cout << "Mock pool listening on port " << settings.port << endl;
+
+	thread(&mockPool::runScript, this).detach();
+
+	while (true) {
+		shared_ptr<poolSession> session = make_shared<poolSession>(io);
+		boost::system::error_code err;
+		acceptor.accept(session->socket, err);
+		if (err) continue;
+
+		{
+			lock_guard<mutex> lock(poolMutex);
+			sessions.push_back(session);
+			stats.connections++;
+		}
+
+		cout << "Miner connected" << endl;
+		thread(&mockPool::serve, this, session).detach();
+	}
+}
+
+}
+
+
+int main(int argc, char* argv[]) {
+	zelMiner::poolSettings settings;
+	string scriptFile;
+	uint32_t jobInterval = 30000;
+	uint32_t cleanEvery = 1;
+	uint32_t disconnectEvery = 0;
+	uint32_t delay = 0;
+	double duration = 0;
+
+	for (int i=1; i<argc; i++) {
+		string arg(argv[i]);
+		string value = (i+1 < argc) ? argv[i+1] : "";
+
+		if (arg.compare("--port") == 0) { settings.port = atoi(value.c_str()); i++; continue; }
+		if (arg.compare("--target") == 0) { settings.target = value; i++; continue; }
+		if (arg.compare("--pool-nonce") == 0) { settings.poolNonce = value; i++; continue; }
+		if (arg.compare("--seed") == 0) { settings.seed = strtoull(value.c_str(), NULL, 10); i++; continue; }
+		if (arg.compare("--script") == 0) { scriptFile = value; i++; continue; }
+		if (arg.compare("--job-interval") == 0) { jobInterval = atoi(value.c_str()); i++; continue; }
+		if (arg.compare("--clean-every") == 0) { cleanEvery = max(1, atoi(value.c_str())); i++; continue; }
+		if (arg.compare("--disconnect-every") == 0) { disconnectEvery = atoi(value.c_str()); i++; continue; }
+		if (arg.compare("--delay") == 0) { delay = atoi(value.c_str()); i++; continue; }
+		if (arg.compare("--duration") == 0) { duration = atof(value.c_str()); i++; continue; }
+		if (arg.compare("--report") == 0) { settings.reportInterval = atoi(value.c_str()); i++; continue; }
+
+		cout << "Usage: zelMiner-mock-pool [options]" << endl;
+		cout << " --port <number>		Port to listen on (default: 3333)" << endl;
+		cout << " --target <hex>			Share target, 64 hex digits (default: 7fff...)" << endl;
+		cout << " --pool-nonce <hex>		Pool part of the nonce (default: a1b2c3d4)" << endl;
+		cout << " --seed <number>		Seed of the job headers (default: 1)" << endl;
+		cout << " --job-interval <ms>		Time between two jobs (default: 30000)" << endl;
+		cout << " --clean-every <number>		Every n-th job is clean (default: 1)" << endl;
+		cout << " --disconnect-every <number>	Close all connections after every n-th job (default: never)" << endl;
+		cout << " --delay <ms>			Wait before every reply (default: 0)" << endl;
+		cout << " --duration <seconds>		Print the statistics and quit after this time" << endl;
+		cout << " --report <seconds>		Interval of the statistics (default: 30, 0: only at the end)" << endl;
+		cout << " --script <file>		Run the commands of this file instead of the job options above" << endl;
+		return 0;
+	}
+
+	if (!scriptFile.empty()) {
+		ifstream file(scriptFile);
+		if (!file.good()) {
+			cout << "Could not read script " << scriptFile << endl;
+			return 1;
+		}
+
+		string line;
+		while (getline(file, line)) settings.script.push_back(line);
+	} else {
+		// Build the script from the options, one period covers the clean and disconnect cycles
+		if (delay > 0) settings.script.push_back("delay " + to_string(delay));
+
+		uint32_t period = cleanEvery * max<uint32_t>(1, disconnectEvery);
+		uint32_t total = (duration > 0) ? max<uint32_t>(1, (uint32_t) (1000.0 * duration / jobInterval)) : period;
+
+		for (uint32_t j=0; j<total; j++) {
+			settings.script.push_back((j % cleanEvery == 0) ? "notify clean" : "notify");
+			settings.script.push_back("wait " + to_string(jobInterval));
+			if ((disconnectEvery > 0) && ((j+1) % disconnectEvery == 0)) settings.script.push_back("disconnect");
+		}
+
+		settings.script.push_back((duration > 0) ? "stop" : "repeat");
+	}
+
+	zelMiner::mockPool pool;
+	if (!pool.setup(settings)) {
+		cout << "Target must be 64 and the pool nonce at most 56 hex digits" << endl;
+		return 1;
+	}
+
+	pool.run();
+	return 0;
+}
@@ -4,23 +4,21 @@
 
 
 #include "zelStratum.h"
+#include "metricsServer.h"
 #include "crypto/sha256.c"
 #include "crypto/blake2b.h"
 
-#ifdef __APPLE__
-#include <libkern/OSByteOrder.h>
-#define htobe32(x) OSSwapHostToBigInt32(x)
-#endif
-
 namespace zelMiner {
 
 // This one ensures that the calling thread can work on immediately
-void zelStratum::queueDataSend(string data) {
-	io_service.post(boost::bind(&zelStratum::syncSend,this, data)); 
+void zelStratum::queueDataSend(string data, bool share) {
+	io_service.post(boost::bind(&zelStratum::syncSend,this, data, share)); 
 }
 
-// Function to add a string into the socket write queue
-void zelStratum::syncSend(string data) {
+// Function to add a string into the socket write queue. The pool answers
+// the shares in order, so their send times are queued for the round trip time.
+void zelStratum::syncSend(string data, bool share) {
+	if (share) shareSendTimes.push_back(std::chrono::steady_clock::now());
 	writeRequests.push_back(data);
 	activateWrite();
 }
@@ -78,14 +76,24 @@ void zelStratum::connect() {
 			 cout << "Stratum error: " <<  _e.what() << endl;
 		}
 
-		workId = "-1";
+		publishJob(std::shared_ptr<const jobSnapshot>());
+		updateMutex.lock();
+		recentJobs.clear();				// The next subscription brings a new pool nonce
+		updateMutex.unlock();
+
 		io_service.reset();
 		socket->close();
+		connected = false;
+		shareSendTimes.clear();
 
 		cout << "Lost connection to ZEL stratum server" << endl;
 		cout << "Trying to connect in 5 seconds"<< endl;
 
-		std::this_thread::sleep_for(std::chrono::seconds(5));
+		// Keep running the io_service while waiting, other users of it (metrics) go on
+		boost::asio::steady_timer retry(io_service, std::chrono::seconds(5));
+		retry.async_wait([this](const boost::system::error_code&) { io_service.stop(); });
+		io_service.run();
+		io_service.reset();
 	}		
 }
 
@@ -94,10 +102,12 @@ void zelStratum::connect() {
 void zelStratum::handleConnect(const boost::system::error_code& err, tcp::resolver::iterator endpoint_iterator) {
 	if (!err) {
 	cout << "Connected to pool." << endl;
+	connected = true;
+	connects++;
 
       	// The connection was successful. Listen to incomming messages
 	boost::asio::async_read_until(*socket, responseBuffer, "\n",
-	boost::bind(&zelStratum::readStratum, this, boost::asio::placeholders::error));
+	boost::bind(&zelStratum::readStratum, this, boost::asio::placeholders::error, boost::asio::placeholders::bytes_transferred));
 
 	// Send auth here !!!!
 
@@ -115,70 +125,72 @@ void zelStratum::handleConnect(const boost::system::error_code& err, tcp::resolv
 
 			socket->async_connect(endpoint,
 			boost::bind(&zelStratum::handleConnect, this, boost::asio::placeholders::error, ++endpoint_iterator));
-		} 
+		} else {
+			// No handler is left for this connection, but the io_service may have other work
+			io_service.stop();
+		}
 	} 	
 }
 
 
 
-// Simple helper function that casts a hex string into byte array
-vector<uint8_t> parseHex (string input) {
-	vector<uint8_t> result ;
-	result.reserve(input.length() / 2);
-	for (uint32_t i = 0; i < input.length(); i += 2){
-		uint32_t byte;
-		std::istringstream hex_byte(input.substr(i, 2));
-		hex_byte >> std::hex >> byte;
-		result.push_back(static_cast<unsigned char>(byte));
-	}
-	return result;
-}
-
 // An other helper function that computes the blake2b output of the first 128 byte of the block header
-void zelStratum::preComputeBlake() {
+void zelStratum::preComputeBlake(jobSnapshot &job) {
 	blake2bInstance blakeInst;
 	blakeInst.init(64,125,4, "ZelProof");
 
 	vector<uint8_t> tmpHeader;
-	tmpHeader.insert(tmpHeader.end(), blockHeader.begin(), blockHeader.end());
-	tmpHeader.insert(tmpHeader.end(), poolNonce.begin(), poolNonce.end());
+	tmpHeader.insert(tmpHeader.end(), job.blockHeader.begin(), job.blockHeader.end());
+	tmpHeader.insert(tmpHeader.end(), job.poolNonce.begin(), job.poolNonce.end());
 
 	while (tmpHeader.size() < 128) tmpHeader.push_back((uint8_t) 0);
 
 	uint8_t* msg = tmpHeader.data();
 	blakeInst.update(msg,128,0);
-	serverWork.assign(64,0);
-	blakeInst.ret_state((uint64_t*) serverWork.data());	
+	blakeInst.ret_state(job.midstate);	
+}
+
+
+// Everything of the share check and submission that only depends on the job
+void zelStratum::preComputeShare(jobSnapshot &job) {
+	memset(job.headerTemplate, 0, 140);
+	memcpy(job.headerTemplate, job.blockHeader.data(), min<size_t>(job.blockHeader.size(), 140));
+	size_t pool = min<size_t>(job.poolNonce.size(), 140 - min<size_t>(job.blockHeader.size(), 140));
+	memcpy(&job.headerTemplate[min<size_t>(job.blockHeader.size(), 140)], job.poolNonce.data(), pool);
+
+	// The client nonce only changes the last 4 bytes, so the first two blocks are the same for all solutions
+	Sha256_Init(&job.headerMidstate);
+	Sha256_Update(&job.headerMidstate, job.headerTemplate, 128);
+
+	job.submitPrefix = "{\"id\":4 ,\"method\":\"mining.submit\",\"params\":[\"" + user + "\",\"" + job.workId + "\",\"" 
+			+ job.timeStr + "\",\"";
 }
 
 
 // Main stratum read function, will be called on every received data
-void zelStratum::readStratum(const boost::system::error_code& err) {
+void zelStratum::readStratum(const boost::system::error_code& err, size_t bytesRead) {
 	if (!err) {
-		// We just read something without problem.
-		std::istream is(&responseBuffer);
-		std::string response;
-		getline(is, response);
+		// The line is parsed where it was received, the buffer is only released afterwards
+		const char* data = static_cast<const char*>(responseBuffer.data().data());
+		string_view response(data, bytesRead);
+		while ((response.size() > 0) && ((response.back() == '\n') || (response.back() == '\r'))) response.remove_suffix(1);
 
 		if (debug) cout << "Incomming Stratum: " << response << endl;
 
-		// Parse the input to a property tree
-		pt::iptree jsonTree;
-		try {
-			istringstream jsonStream(response);
-			pt::read_json(jsonStream,jsonTree);
-
-			int id = jsonTree.get<int>("id", -1);
+		stratumMessage msg;
+		if (!msg.parse(response)) {
+			cout << "Json parse error: " << response.substr(0,64) << endl; 
+		} else {
 			// If id >= 0 it is a reply to a send message
 
 			// Reply to subscribe
-			if (id == 1) {
-				int exists = jsonTree.count("result");
+			if (msg.id == 1) {
+				const jsonValue &nonceStr = msg.resultItem(1);
 
-				if (exists > 0) {
+				if (nonceStr.type == jsonString) {
 					// Read the pool part of nonce
-					string nonceStr = element_at<string>(jsonTree, "result", 1);
-					poolNonce = parseHex(nonceStr);
+					poolNonce.clear();
+					appendHex(nonceStr.text, poolNonce);
 
 					cout << "Miner subscribed to pool, sending authorization request" << endl;
 
@@ -190,12 +202,8 @@ void zelStratum::readStratum(const boost::system::error_code& err) {
 
 
 			// Reply to authorize
-			if (id == 2) {
-				int exists = jsonTree.count("result");
-				bool isAuthorized = false;
-				if (exists > 0) {
-					isAuthorized = jsonTree.get<bool>("result");
-				}
+			if (msg.id == 2) {
+				bool isAuthorized = msg.result.isTrue();
 
 			       	if (!isAuthorized) {
 					cout << "Fatal Error: Miner not authorized, Closing Miner" << endl;
@@ -206,269 +214,344 @@ void zelStratum::readStratum(const boost::system::error_code& err) {
 			}
 
 			// Reply to a submitted share
-			if (id == 4) {
-				int exists = jsonTree.count("result");
-				if (exists > 0) {
-					bool accepted_share = jsonTree.get<bool>("result", false);
-					
-					if (accepted_share) {
-						cout << "Share accepted" << endl;
-						sharesAcc++;
-					} else {
-						cout << "Share rejected" << endl;
-						sharesRej++;
-					}
+			if ((msg.id == 4) && (msg.result.type != jsonMissing)) {
+				if (shareSendTimes.size() > 0) {
+					lastRtt = std::chrono::duration<double>(std::chrono::steady_clock::now() - shareSendTimes.front()).count();
+					rttSum += lastRtt;
+					rttCount++;
+					shareSendTimes.pop_front();
+				}
+
+				// Error 21 is "job not found", pools send it for stale shares
+				string_view reason = msg.errorItem(1).text;
+				bool stale = (msg.errorItem(0).asInt(0) == 21);
+				stale = stale || (reason.find("stale") != string_view::npos) || (reason.find("Stale") != string_view::npos);
+
+				if (msg.result.isTrue()) {
+					cout << "Share accepted" << endl;
+					sharesAcc++;
+				} else if (stale) {
+					cout << "Share rejected (stale)" << endl;
+					sharesStale++;
+				} else {
+					cout << "Share rejected" << endl;
+					sharesRej++;
 				}
 			}
 
-			
-			string method = jsonTree.get<string>("method", "null");
 			// If method is set, it is a push method from the stratum server
 
 			// We got a new target
-			if (method.compare("mining.set_target") == 0) {
+			if ((msg.method.compare("mining.set_target") == 0) && (msg.param(0).type == jsonString)) {
+				string_view targetStr = msg.param(0).text;
+
 				updateMutex.lock();
-				target = parseHex(element_at<string>(jsonTree, "params", 0));
+				target.clear();
+				appendHex(targetStr, target);
 				updateMutex.unlock();
 
-				cout << "Target received: " << element_at<string>(jsonTree, "params", 0).substr(0,16) << endl; 
+				cout << "Target received: " << targetStr.substr(0,16) << endl; 
 			}
 
 			// We got a new block header / work
-			if (method.compare("mining.notify") == 0) {
-				
-				std::stringstream ssHeader;
-				ssHeader << element_at<string>(jsonTree, "params", 1) << element_at<string>(jsonTree, "params", 2) << element_at<string>(jsonTree, "params", 3)
-		         		 << element_at<string>(jsonTree, "params", 4) << element_at<string>(jsonTree, "params", 5) << element_at<string>(jsonTree, "params", 6);
-
-				blockHeader = parseHex(ssHeader.str());
-				
+			if ((msg.method.compare("mining.notify") == 0) && (msg.paramCount >= 7)) {
+
+				// Pools that do not send clean_jobs get the old behaviour, every job replaces the last
+				bool cleanJob = (msg.param(7).type == jsonBool) ? msg.param(7).isTrue() : true;
+
+				std::shared_ptr<const jobSnapshot> previous = currentOwner;
+
+				// The job snapshot is the only allocation of a notify
+				std::shared_ptr<jobSnapshot> job = std::make_shared<jobSnapshot>();
+				job->job = ++jobCount;
+				job->workId = msg.param(0).text;
+				job->timeStr = msg.param(5).text; 
+
+				job->blockHeader.reserve(140);
+				for (uint32_t i=1; i<7; i++) appendHex(msg.param(i).text, job->blockHeader);
+
+				job->poolNonce = poolNonce;
+				job->target = target;
+				preComputeBlake(*job);
+				preComputeShare(*job);
+
+				// The first job after a reconnect starts a new epoch as well
+				cleanJob = cleanJob || !previous;
+				if (cleanJob) {
+					job->cleanEpoch = ++cleanCount;
+					job->cleanTime = std::chrono::steady_clock::now();
+				} else {
+					job->cleanEpoch = previous->cleanEpoch;
+					job->cleanTime = previous->cleanTime;
+				}
+				uint32_t epoch = job->cleanEpoch;
+				lastNotify = std::chrono::steady_clock::now();
+
 				updateMutex.lock();
-				workId = element_at<string>(jsonTree, "params", 0);
-				timeStr = element_at<string>(jsonTree, "params", 5); 
-				preComputeBlake();
+				if (cleanJob) recentJobs.clear();
+				recentJobs.push_front(job);
+				if (recentJobs.size() > jobHistory) recentJobs.pop_back();
 				updateMutex.unlock();
 
-				cout << "New job received with id " << element_at<string>(jsonTree, "params", 0) << endl;
+				// From here on the miners work on the new job
+				publishJob(job);
+
+				if (cleanJob && cleanJobHandler) cleanJobHandler(epoch);
+
+				cout << "New job received with id " << job->workId << (cleanJob ? " (clean)" : "") << endl;
 
 				t_current = time(NULL);
 				cout << "Solutions (A/R): " << sharesAcc << " / " << sharesRej << " Uptime: " << (int)(t_current-t_start) << " sec" << endl; 
 			}
-
-			
-
-		} catch(const pt::ptree_error &e) {
-			cout << "Json parse error: " << e.what() << endl; 
 		}
 
+		responseBuffer.consume(bytesRead);
+
 		// Prepare to continue reading
 		boost::asio::async_read_until(*socket, responseBuffer, "\n",
-        	boost::bind(&zelStratum::readStratum, this, boost::asio::placeholders::error));
+        	boost::bind(&zelStratum::readStratum, this, boost::asio::placeholders::error, boost::asio::placeholders::bytes_transferred));
+	} else {
+		// The connection is gone, connect() starts a new one
+		io_service.stop();
 	}
 }
 
 
+// The offline job has the layout of a notify header: version, previous block, merkle root,
+// reserved hash, time and bits. Its target is 0, so no solution is ever submitted.
+bool zelStratum::setOfflineJob(uint64_t seed, string headerHex, uint32_t startNonce) {
+	std::shared_ptr<jobSnapshot> job = std::make_shared<jobSnapshot>();
+
+	if (!headerHex.empty()) {
+		if (!appendHex(headerHex, job->blockHeader) || (job->blockHeader.size() != 108)) return false;
+	} else {
+		// The raw engine output is the same on all platforms, unlike the distributions
+		std::mt19937_64 generator(seed);
+		job->blockHeader.assign(4, (uint8_t) 0);
+		job->blockHeader[0] = 4;
+		while (job->blockHeader.size() < 108) job->blockHeader.push_back((uint8_t) generator());
+	}
+
+	job->job = ++jobCount;
+	job->cleanEpoch = ++cleanCount;
+	job->cleanTime = std::chrono::steady_clock::now();
+	job->workId = "offline";
+	job->poolNonce.clear();
+	job->target.assign(32, (uint8_t) 0);
+	preComputeBlake(*job);
+	preComputeShare(*job);
+
+	updateMutex.lock();
+	recentJobs.clear();
+	recentJobs.push_front(job);
+	updateMutex.unlock();
+
+	nonce = startNonce;
+	lastNotify = std::chrono::steady_clock::now();
+	publishJob(job);
+	return true;
+}
+
+
 // Checking if we have valid work, else the GPUs will pause
 bool zelStratum::hasWork() {
-	return (workId.compare("-1") != 0);
+	jobReader reader(*this);
+	return (reader.job != NULL);
 }
 
 
-// function the clHost class uses to fetch new work
+// Makes a snapshot the current job. Called by the stratum thread, or before it runs.
+// The replaced slot gets the number of readers that entered it, the readers that left
+// already made its count negative. If that sums up to 0 nobody uses it any more.
+void zelStratum::publishJob(std::shared_ptr<const jobSnapshot> job) {
+	uint32_t index = 0;
+	while (slots[index].inUse.load(memory_order_acquire)) {
+		index++;
+		if (index < jobSlots) continue;
+
+		// Every slot is held by a reader, the first one to leave indexs one
+		index = 0;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	slots[index].job = job;
+	slots[index].outstanding.store(0, memory_order_relaxed);
+	slots[index].inUse.store(true, memory_order_relaxed);
+
+	uint64_t previous = currentJob.exchange(((uint64_t) index) << 32, memory_order_acq_rel);
+	jobSlot &replaced = slots[previous >> 32];
+
+	int64_t entered = previous & 0xFFFFFFFF;
+	if (replaced.outstanding.fetch_add(entered, memory_order_acq_rel) + entered == 0) releaseSlot(replaced);
+
+	currentOwner = job;
+}
+
+
+void zelStratum::releaseSlot(jobSlot &slot) {
+	slot.job.reset();
+	slot.inUse.store(false, memory_order_release);
+}
+
+
+// function the clHost class uses to fetch new work, takes no lock and allocates nothing
 void zelStratum::getWork(WorkDescription& wd, uint8_t* dataOut) {
 
 	// nonce is atomic, so every time we call this will get a nonce increased by one
 	uint32_t cliNonce = nonce.fetch_add(1);
 	wd.nonce = cliNonce;  
 	
-	updateMutex.lock();
-
-	wd.workId = workId;
-	memcpy(dataOut, serverWork.data(), 64);
+	jobReader reader(*this);
+	const jobSnapshot* job = reader.job;
+	if (job == NULL) {
+		wd.job = 0;
+		wd.epoch = 0;
+		memset(dataOut, 0, 64);
+		return;
+	}
 
-	updateMutex.unlock();
+	wd.job = job->job;
+	wd.epoch = job->cleanEpoch;
+	memcpy(dataOut, job->midstate, 64);
 }
 
 
-void CompressArray(const unsigned char* in, size_t in_len,
-                   unsigned char* out, size_t out_len,
-                   size_t bit_len, size_t byte_pad) {
-	assert(bit_len >= 8);
-	assert(8*sizeof(uint32_t) >= bit_len);
-
-	size_t in_width { (bit_len+7)/8 + byte_pad };
-	assert(out_len == (bit_len*in_len/in_width + 7)/8);
-
-	uint32_t bit_len_mask { ((uint32_t)1 << bit_len) - 1 };
-
-	// The acc_bits least-significant bits of acc_value represent a bit sequence
-	// in big-endian order.
-	size_t acc_bits = 0;
-	uint32_t acc_value = 0;
-
-	size_t j = 0;
-	for (size_t i = 0; i < out_len; i++) {
-		// When we have fewer than 8 bits left in the accumulator, read the next
-		// input element.
-		if (acc_bits < 8) {
-			if (j < in_len) {
-				acc_value = acc_value << bit_len;
-				for (size_t x = byte_pad; x < in_width; x++) {
-					acc_value = acc_value | (
-					(
-					// Apply bit_len_mask across byte boundaries
-					in[j + x] & ((bit_len_mask >> (8 * (in_width - x - 1))) & 0xFF)
-					) << (8 * (in_width - x - 1))); // Big-endian
-				}
-				j += in_width;
-				acc_bits += bit_len;
-			}
-			else {
-				acc_value <<= 8 - acc_bits;
-				acc_bits += 8 - acc_bits;;
-			}
-		}
-
-		acc_bits -= 8;
-		out[i] = (acc_value >> acc_bits) & 0xFF;
-	}
+void zelStratum::setCleanJobHandler(std::function<void(uint32_t)> handler) {
+	cleanJobHandler = handler;
 }
 
-#ifdef WIN32
 
-inline uint32_t htobe32(uint32_t x)
-{
-    return (((x & 0xff000000U) >> 24) | ((x & 0x00ff0000U) >> 8) |
-        ((x & 0x0000ff00U) << 8) | ((x & 0x000000ffU) << 24));
+uint32_t zelStratum::getCleanEpoch() {
+	jobReader reader(*this);
+	return (reader.job != NULL) ? reader.job->cleanEpoch : 0;
 }
 
 
-#endif // WIN32
-
-// Big-endian so that lexicographic array comparison is equivalent to integer comparison
-void EhIndexToArray(const uint32_t i, unsigned char* array) {
-	static_assert(sizeof(uint32_t) == 4, "");
-	uint32_t bei = htobe32(i);
-	memcpy(array, &bei, sizeof(uint32_t));
+// Time since the given clean job was received, negative if a newer one arrived since
+double zelStratum::msSinceCleanJob(uint32_t epoch) {
+	jobReader reader(*this);
+	if ((reader.job == NULL) || (reader.job->cleanEpoch != epoch)) return -1;
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - reader.job->cleanTime).count();
 }
 
 
-// Helper function that compresses the solution from 32 unsigned integers (128 bytes) to 104 bytes
-std::vector<unsigned char> GetMinimalFromIndices(std::vector<uint32_t> indices, size_t cBitLen) {
-	assert(((cBitLen+1)+7)/8 <= sizeof(uint32_t));
-	size_t lenIndices { indices.size()*sizeof(uint32_t) };
-	size_t minLen { (cBitLen+1)*lenIndices/(8*sizeof(uint32_t)) };
-	size_t bytePad { sizeof(uint32_t) - ((cBitLen+1)+7)/8 };
-	std::vector<unsigned char> array(lenIndices);
-	for (size_t i = 0; i < indices.size(); i++) {
-		EhIndexToArray(indices[i], array.data()+(i*sizeof(uint32_t)));
+// Compresses the 16 solution indices into 52 bytes, each index is stored with 26 bits in big-endian bit order
+inline void compressSolution(const uint32_t* indices, uint8_t* out) {
+	uint64_t acc = 0;
+	uint32_t accBits = 0;
+	uint32_t pos = 0;
+
+	for (uint32_t i=0; i<16; i++) {
+		acc = (acc << 26) | (indices[i] & 0x3FFFFFF);
+		accBits += 26;
+
+		while (accBits >= 8) {
+			accBits -= 8;
+			out[pos++] = (uint8_t) (acc >> accBits);
+		}
 	}
-	std::vector<unsigned char> ret(minLen);
-	CompressArray(array.data(), lenIndices, ret.data(), minLen, cBitLen+1, bytePad);
-	return ret;
 }
 
-// Helper function that does target comparison
-inline int32_t cmp_target_256(vector<uint8_t> a, vector<uint8_t> b) {
+
+// Helper function that does target comparison, the hash is compared from its last byte
+inline int32_t cmp_target_256(const uint8_t* a, const vector<uint8_t> &b) {
 	
-    	for (int i = a.size() - 1; i >= 0; i--)
+    	for (int i = 31; i >= 0; i--)
 		if (a[i] != b[b.size() - i - 1])
 	    	return (int32_t)a[i] - b[b.size() - i -1 ];
    	return 0;
 }
 
-bool zelStratum::testSolution(const vector<uint32_t>& indices, WorkDescription& wd, vector<uint8_t> &outNonce, vector<uint8_t> &outSolution) {
 
-	// Check if it is a solution to the current job
-	if (workId.compare(wd.workId) != 0) return false;
+static const char hexDigits[] = "0123456789abcdef";
 
-	// get the compressed representation of the solution and check against target
-	std::vector<uint8_t> compressed;
-	compressed = GetMinimalFromIndices(indices,25);
-
-	vector<uint8_t> fullHeader;
-
-	// Insert block header
-	fullHeader.assign(140,0);
-	for (int c=0; c<blockHeader.size(); c++) {
-		fullHeader[c] = blockHeader[c];
+inline void appendHex(string &out, const uint8_t* data, size_t len) {
+	for (size_t c=0; c<len; c++) {
+		out.push_back(hexDigits[data[c] >> 4]);
+		out.push_back(hexDigits[data[c] & 0xF]);
 	}
+}
 
-	// Pool Nonce
-	for (int c=0; c<poolNonce.size(); c++) {
-		fullHeader[blockHeader.size()+c] = poolNonce[c];
-	}
-
-	// Solution Nonce
-	uint32_t* noncePoint = (uint32_t*) &fullHeader.data()[fullHeader.size()-4];
-	*noncePoint = wd.nonce;
-
-	// This indicates that the following solution should have 52 bytes
-	fullHeader.push_back((uint8_t) 52);
 
-	// Add the solution
-	fullHeader.insert(fullHeader.end(), compressed.begin(), compressed.end());		
+// Returns the snapshot of an older job the pool still accepts, empty if it is too old or was cleaned
+std::shared_ptr<const zelStratum::jobSnapshot> zelStratum::findJob(uint32_t id) {
+	boost::lock_guard<boost::mutex> lock(updateMutex);
+	for (uint32_t i=0; i<recentJobs.size(); i++) {
+		if (recentJobs[i]->job == id) return recentJobs[i];
+	}
+	return std::shared_ptr<const jobSnapshot>();
+}
 
-	// Double sha-256
-	vector<uint8_t> hash0;
-	vector<uint8_t> hash1;
 
-	hash0.assign(32,0);
-	hash1.assign(32,0);
+// Checks a solution against the target of its job. tail receives the last 12 header
+// bytes, the length byte and the compressed solution (65 bytes), as needed for the submission.
+bool zelStratum::testSolution(const uint32_t* indices, const WorkDescription& wd, const jobSnapshot &job, uint8_t* tail) {
 
-	Sha256_Onestep(fullHeader.data(), fullHeader.size(), hash0.data());
-	Sha256_Onestep(hash0.data(), hash0.size(), hash1.data());
+	memcpy(tail, &job.headerTemplate[128], 12);
+	memcpy(&tail[8], &wd.nonce, 4);				// Solution nonce, last 4 bytes of the header
 
-	if (cmp_target_256(hash1, target) < 0) {
-		// The solution is below target
-		
-		// Copy out the length encoding and the solution
-		outSolution.push_back((uint8_t) 52);
-		outSolution.insert(outSolution.end(), compressed.begin(), compressed.end());	
+	// This indicates that the following solution should have 52 bytes
+	tail[12] = 52;
+	compressSolution(indices, &tail[13]);
 
-		// Copy out the client nonce
-		int freeNonceSz = 32 - poolNonce.size();
-		outNonce.assign(freeNonceSz, 0);
-		for (int c=0; c<freeNonceSz; c++) {
-			outNonce[c] = fullHeader[blockHeader.size() + poolNonce.size() + c];
-		}
+	// Double sha-256, starting from the state after the constant part of the header
+	CSha256 sha = job.headerMidstate;
+	uint8_t hash0[32];
+	uint8_t hash1[32];
 
-		return true;
-	} 
+	Sha256_Update(&sha, tail, 65);
+	Sha256_Final(&sha, hash0);
+	Sha256_Onestep(hash0, 32, hash1);
 
-	return false;
+	// The solution is below target
+	return (cmp_target_256(hash1, job.target) < 0);
 }
 
-void zelStratum::submitSolution(vector<uint8_t> cliNonce, vector<uint8_t> comprSol) {
+void zelStratum::submitSolution(const jobSnapshot &job, const uint8_t* tail) {
 
-	
-	stringstream solutionStr;
-	for (int c=0; c<comprSol.size(); c++) {
-		solutionStr << std::setfill('0') << std::setw(2) << std::hex << (unsigned) comprSol[c];
+	// The client nonce are the header bytes behind the pool nonce
+	size_t nonceStart = min<size_t>(job.blockHeader.size() + job.poolNonce.size(), 140);
+	uint8_t cliNonce[140];
+	for (size_t c=nonceStart; c<140; c++) {
+		cliNonce[c-nonceStart] = (c < 128) ? job.headerTemplate[c] : tail[c-128];
 	}
 
-	stringstream nonceStr;
-	for (int c=0; c<cliNonce.size(); c++) {
-		nonceStr << std::setfill('0') << std::setw(2) << std::hex << (unsigned) cliNonce[c];
-	}
-
-	string json = "{\"id\":4 ,\"method\":\"mining.submit\",\"params\":[\"" + user + "\",\"" + workId + "\",\"" 
-			+ timeStr + "\",\"" + nonceStr.str() + "\",\"" + solutionStr.str() + "\"]}\n";
+	string json;
+	json.reserve(job.submitPrefix.size() + 2*(140-nonceStart) + 2*53 + 8);
+	json += job.submitPrefix;
+	appendHex(json, cliNonce, 140-nonceStart);
+	json += "\",\"";
+	appendHex(json, &tail[12], 53);
+	json += "\"]}\n";
 
-	queueDataSend(json);	
+	queueDataSend(json, true);	
 
-	cout << "Submitting solution to job " << workId << endl;
+	cout << "Submitting solution to job " << job.workId << endl;
 }
 
 
-// Will be called by clHost class for check & submit
-void zelStratum::handleSolution(WorkDescription& wd, vector<uint32_t> &indices) {
+// Will be called by the validation workers and the CPU host for check & submit
+void zelStratum::handleSolution(const WorkDescription& wd, const uint32_t* indices) {
 
-	vector<uint8_t> solution;
-	vector<uint8_t> clientNonce;
+	// Check if it is a solution to a job that is still valid, the header and target are the ones of that job.
+	// The common case is the current job, that needs no lock.
+	jobReader reader(*this);
+	const jobSnapshot* job = reader.job;
 
-	if (testSolution(indices, wd, clientNonce,solution)) {
-		submitSolution(clientNonce, solution);
+	std::shared_ptr<const jobSnapshot> older;
+	if ((job == NULL) || (job->job != wd.job)) {
+		older = findJob(wd.job);
+		job = older.get();
+	}
+
+	if (job == NULL) {
+		staleSolutions.fetch_add(1, memory_order_relaxed);
+		return;
+	}
+
+	uint8_t tail[65];
+	if (testSolution(indices, wd, *job, tail)) {
+		submitSolution(*job, tail);
 	}
 }
 
@@ -481,8 +564,7 @@ zelStratum::zelStratum(string hostIn, string portIn, string userIn, string passI
 	pass = passIn;
 	debug = debugIn;
 
-	// Assign the work field and nonce
-	serverWork.assign(64,(uint8_t) 0);
+	// Assign the target and nonce
 	target.assign(32,(uint8_t) 0);
 
 	random_device rd;
@@ -491,9 +573,55 @@ zelStratum::zelStratum(string hostIn, string portIn, string userIn, string passI
 
 	// We pick a random start nonce
 	nonce = distribution(generator);
+	staleSolutions = 0;
+	t_start = time(NULL);
+
+	// No work in the beginning, the current job is the empty snapshot in slot 0
+	for (uint32_t i=0; i<jobSlots; i++) {
+		slots[i].outstanding = 0;
+		slots[i].inUse = false;
+	}
+	slots[0].inUse = true;
+	currentJob = 0;
+}
+
+boost::asio::io_service& zelStratum::ioService() {
+	return io_service;
+}
+
+
+void zelStratum::writeMetrics(stringstream &ss) {
+	string pool = "{pool=\"" + metricLabel(host + ":" + port) + "\"}";
+	string poolLabel = "pool=\"" + metricLabel(host + ":" + port) + "\"";
+
+	metricHeader(ss, "zelminer_pool_connected", "gauge", "1 while the miner is connected to the pool");
+	ss << "zelminer_pool_connected" << pool << " " << (connected ? 1 : 0) << "\n";
+
+	metricHeader(ss, "zelminer_pool_connects_total", "counter", "Successful connections to the pool, all but the first are reconnects");
+	ss << "zelminer_pool_connects_total" << pool << " " << connects << "\n";
+
+	metricHeader(ss, "zelminer_shares_total", "counter", "Submitted shares by the answer of the pool");
+	ss << "zelminer_shares_total{" << poolLabel << ",result=\"accepted\"} " << sharesAcc << "\n";
+	ss << "zelminer_shares_total{" << poolLabel << ",result=\"rejected\"} " << sharesRej << "\n";
+	ss << "zelminer_shares_total{" << poolLabel << ",result=\"stale\"} " << sharesStale << "\n";
+
+	metricHeader(ss, "zelminer_solutions_stale_total", "counter", "Solutions dropped because their job was replaced by a clean job");
+	ss << "zelminer_solutions_stale_total " << staleSolutions.load(memory_order_relaxed) << "\n";
+
+	metricHeader(ss, "zelminer_pool_rtt_seconds", "summary", "Time from sending a share to the answer of the pool");
+	ss << "zelminer_pool_rtt_seconds_sum" << pool << " " << rttSum << "\n";
+	ss << "zelminer_pool_rtt_seconds_count" << pool << " " << rttCount << "\n";
+
+	metricHeader(ss, "zelminer_pool_last_rtt_seconds", "gauge", "Round trip time of the last share");
+	ss << "zelminer_pool_last_rtt_seconds" << pool << " " << lastRtt << "\n";
+
+	if (hasWork()) {
+		metricHeader(ss, "zelminer_job_age_seconds", "gauge", "Time since the last job notify");
+		ss << "zelminer_job_age_seconds" << pool << " " << std::chrono::duration<double>(std::chrono::steady_clock::now() - lastNotify).count() << "\n";
+	}
 
-	// No work in the beginning
-	workId = "-1";
+	metricHeader(ss, "zelminer_uptime_seconds", "gauge", "Time since the miner started");
+	ss << "zelminer_uptime_seconds " << (uint64_t) (time(NULL) - t_start) << "\n";
 }
 
 } // End namespace
@@ -10,19 +10,22 @@
 #include <vector>
 #include <deque>
 #include <random>
+#include <chrono>
+#include <functional>
+#include <atomic>
+#include <memory>
 
 #include <boost/scoped_ptr.hpp>
 #include <boost/asio.hpp>
 #include <boost/bind.hpp>
 #include <boost/thread.hpp>
 
-#include <boost/property_tree/ptree.hpp>
-#include <boost/property_tree/json_parser.hpp>
+#include "crypto/sha256.h"
+#include "stratumJson.h"
 
 using namespace std;
 using namespace boost::asio;
 using boost::asio::ip::tcp;
-namespace pt = boost::property_tree;
 
 namespace zelMiner {
 
@@ -36,14 +39,28 @@ class zelStratum {
 
 	struct WorkDescription
 	{
-		string workId;
+		uint32_t job;			// Sequence number of the job, see jobSnapshot
 		uint32_t nonce;
+		uint32_t epoch;			// Number of clean jobs received before this work
 	};
 
+	// Publishes a job for mining without a pool, built from the given header (hex) or a seeded one
+	bool setOfflineJob(uint64_t, string, uint32_t);
+
 	bool hasWork();
 	void getWork(WorkDescription&, uint8_t*);
 
-	void handleSolution(WorkDescription&, std::vector<uint32_t>&);
+	// Clean jobs make all older work worthless. The handler is called from the stratum
+	// thread with the new epoch, so the miners can abort what they are working on.
+	void setCleanJobHandler(std::function<void(uint32_t)>);
+	uint32_t getCleanEpoch();
+	double msSinceCleanJob(uint32_t);
+
+	void handleSolution(const WorkDescription&, const uint32_t*);	// 16 indices
+
+	// The metrics server runs on the stratum io_service, so writeMetrics is only called from the stratum thread
+	boost::asio::io_service& ioService();
+	void writeMetrics(stringstream&);
 
 
 	private:
@@ -62,56 +79,118 @@ class zelStratum {
 	string pass;
 	bool debug = true;
 
-	// Storage for received work
-	string workId;
-	string timeStr;
-	std::vector<uint8_t> blockHeader;
-	std::vector<uint8_t> serverWork;
+	// Storage for received work. Every job is built completely by the stratum thread
+	// and then published, it never changes afterwards. Readers only need the pointer.
+	struct jobSnapshot {
+		uint32_t job;					// Increases with every notify
+		uint32_t cleanEpoch;				// Number of clean jobs up to this one
+		std::chrono::steady_clock::time_point cleanTime;	// Receive time of the last clean job
+		string workId;
+		string timeStr;
+		std::vector<uint8_t> blockHeader;
+		std::vector<uint8_t> poolNonce;
+		vector<uint8_t> target;
+		uint64_t midstate[8];				// BLAKE2b state after the first 128 bytes
+
+		// Share check, only the last 65 bytes of the header and solution are hashed per solution
+		uint8_t headerTemplate[140];			// Header, pool nonce and zero client nonce
+		CSha256 headerMidstate;				// SHA-256 state after the first 128 bytes
+		string submitPrefix;				// mining.submit up to the client nonce
+	};
+
+	// The current job is published through plain atomics, std::atomic_load on a shared_ptr
+	// takes a lock inside the standard library. Each published snapshot sits in one of the
+	// slots below. currentJob holds the slot index in the upper 32 bits and counts the readers
+	// that entered it in the lower ones, so a reader gets the snapshot and its reference with
+	// one fetch_add. Readers leave on the slot itself, and the slot is released by whoever
+	// brings its count to zero after it was replaced, the publisher or the last reader.
+	struct jobSlot {
+		std::shared_ptr<const jobSnapshot> job;
+		std::atomic<int64_t> outstanding;		// Entries handed over at the replacement minus exits
+		std::atomic<bool> inUse;
+	};
+
+	static const uint32_t jobSlots = 64;
+	jobSlot slots[jobSlots];
+	std::atomic<uint64_t> currentJob;
+
+	std::shared_ptr<const jobSnapshot> currentOwner;	// Only used by the publishing thread
+	void publishJob(std::shared_ptr<const jobSnapshot>);
+	static void releaseSlot(jobSlot&);
+
+	// Keeps the current snapshot alive while it is in scope, it may be NULL
+	class jobReader {
+		jobSlot* slot;
+		public:
+		const jobSnapshot* job;
+		jobReader(zelStratum &s) {
+			uint64_t current = s.currentJob.fetch_add(1, memory_order_acq_rel);
+			slot = &s.slots[current >> 32];
+			job = slot->job.get();
+		}
+		~jobReader() {
+			if (slot->outstanding.fetch_sub(1, memory_order_acq_rel) == 1) releaseSlot(*slot);
+		}
+	};
+
 	std::atomic<uint32_t> nonce;
+
+	// Values of the next job, only used by the stratum thread
 	vector<uint8_t> target;
 	std::vector<uint8_t> poolNonce;
+	uint32_t jobCount = 0;
+	uint32_t cleanCount = 0;
+
+	// Jobs the pool still accepts solutions for, newest first. A clean job clears them.
+	static const uint32_t jobHistory = 4;
+	std::deque< std::shared_ptr<const jobSnapshot> > recentJobs;
+	std::shared_ptr<const jobSnapshot> findJob(uint32_t);
+
+	std::function<void(uint32_t)> cleanJobHandler;
 
 	// Stat
 	uint64_t sharesAcc = 0;
 	uint64_t sharesRej = 0;
+	uint64_t sharesStale = 0;
 	time_t t_start, t_current;
 
+	// Connection statistics, only used by the stratum thread
+	bool connected = false;
+	uint32_t connects = 0;
+	std::chrono::steady_clock::time_point lastNotify;
+	std::deque<std::chrono::steady_clock::time_point> shareSendTimes;	// Submits waiting for the reply
+	double lastRtt = 0;
+	double rttSum = 0;
+	uint64_t rttCount = 0;
+
+	// Solutions of jobs the pool does not accept any more, counted by the validation workers
+	std::atomic<uint64_t> staleSolutions;
+
 	//Stratum sending subsystem
 	bool activeWrite = false;
-	void queueDataSend(string);
-	void syncSend(string);
+	void queueDataSend(string, bool = false);
+	void syncSend(string, bool);
 	void activateWrite();
 	void writeHandler(const boost::system::error_code&);	
 	std::deque<string> writeRequests;
 
 	// Stratum receiving subsystem
-	void readStratum(const boost::system::error_code&);
+	void readStratum(const boost::system::error_code&, size_t);
 	boost::mutex updateMutex;
 
 	// Connection handling
 	void connect();
 	void handleConnect(const boost::system::error_code& err,  tcp::resolver::iterator);
 
-	void preComputeBlake();
+	void preComputeBlake(jobSnapshot&);
+	void preComputeShare(jobSnapshot&);
 
 	// Solution Check & Submit
-	bool testSolution(const vector<uint32_t>&, WorkDescription&, vector<uint8_t>&, vector<uint8_t>&);
-	void submitSolution(vector<uint8_t>, vector<uint8_t>);	
+	bool testSolution(const uint32_t*, const WorkDescription&, const jobSnapshot&, uint8_t*);
+	void submitSolution(const jobSnapshot&, const uint8_t*);	
 };
 
 
-template <typename T = std::string> 
-T element_at(pt::iptree const& tree, std::string name, size_t n) {
-    auto r = tree.get_child(name).equal_range("");
-
-    for (; r.first != r.second && n; --n) ++r.first;
-
-    if (n || r.first==r.second)
-        throw std::range_error("index out of bounds");
-
-    return r.first->second.get_value<T>();
-}
-
 #endif 
 
 }